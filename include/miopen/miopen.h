@@ -198,6 +198,28 @@ MIOPEN_EXPORT miopenStatus_t miopenCreate(miopenHandle_t* handle);
 MIOPEN_EXPORT miopenStatus_t miopenCreateWithStream(miopenHandle_t* handle,
                                                     miopenAcceleratorQueue_t stream);
 
+#ifdef MIOPEN_BETA_API
+/*! @brief Create a MIOpen handle that shares the compiled kernels and caches of another handle.
+ *
+ * The child handle is bound to its own accelerator queue but shares the program and kernel
+ * cache, the invoker cache and the other host-side caches of the parent, so kernels compiled or
+ * loaded through any of them are reused by all. The databases are shared by all handles of the
+ * process anyway. The child uses the allocator of the parent.
+ *
+ * The shared state is reference counted: the parent and its children may be destroyed with
+ * miopenDestroy in any order. The queue must belong to the device (HIP) or the context
+ * (OpenCL) of the parent.
+ * @param handle     A pointer to a MIOpen handle type (output)
+ * @param parent     MIOpen handle to share the caches with (input)
+ * @param stream     An accelerator queue type (input)
+ *
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenCreateChildHandle(miopenHandle_t* handle,
+                                                     miopenHandle_t parent,
+                                                     miopenAcceleratorQueue_t stream);
+#endif
+
 /*! @brief Destroys the MIOpen handle.
  *
  * This is called when breaking down the MIOpen environment.
@@ -5647,6 +5669,24 @@ MIOPEN_EXPORT miopenStatus_t miopenSetFindOptionPreallocatedTensor(miopenFindOpt
 MIOPEN_EXPORT miopenStatus_t miopenSetFindOptionAttachBinaries(miopenFindOptions_t options,
                                                                unsigned attach);
 
+/*! @brief Sets how the time of each solution is measured during find and tuning.
+ *
+ * After warmup_runs runs, each solution is run until the 95% confidence interval of its median
+ * time is narrower than confidence_interval (relative to the median), or until max_runs runs.
+ * Outlier runs are rejected. Solutions that are clearly slower than the best one are dropped
+ * early. By default, 1 warm-up run, up to 10 runs and 0.02 are used.
+ *
+ * @param options             Options object to update
+ * @param warmup_runs         Number of runs which are not measured
+ * @param max_runs            Max number of measured runs, must be positive
+ * @param confidence_interval Relative half-width of the confidence interval to stop at
+ * @return                    miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenSetFindOptionTimingPolicy(miopenFindOptions_t options,
+                                                             size_t warmup_runs,
+                                                             size_t max_runs,
+                                                             float confidence_interval);
+
 /*! @brief The miopenSolution object describes a prepared solution.
  */
 MIOPEN_DECLARE_OBJECT(miopenSolution);
@@ -5669,6 +5709,117 @@ MIOPEN_EXPORT miopenStatus_t miopenFindSolutions(miopenHandle_t handle,
                                                  size_t* numSolutions,
                                                  size_t maxSolutions);
 
+#ifdef MIOPEN_BETA_API
+
+/*! @brief Callback reporting the progress of a find.
+ *
+ * It is called from the thread running the find after each measured solution.
+ *
+ * @param userData  Pointer passed to miopenSetFindOptionProgressCallback
+ * @param done      Number of solutions measured so far
+ * @param total     Number of solutions to measure, may grow while the find runs
+ * @param bestTime  Best time measured so far in milliseconds
+ */
+typedef void (*miopenFindProgressCallback)(void* userData,
+                                           size_t done,
+                                           size_t total,
+                                           float bestTime);
+
+/*! @brief Sets the callback reporting the progress of the find.
+ *
+ * @param options    Options object to update
+ * @param callback   Callback to call, null to remove it
+ * @param userData   Pointer passed to the callback
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenSetFindOptionProgressCallback(
+    miopenFindOptions_t options, miopenFindProgressCallback callback, void* userData);
+
+/*! @brief The miopenFindFuture object holds the results of a find running in the background.
+ */
+MIOPEN_DECLARE_OBJECT(miopenFindFuture);
+
+/*! @brief Starts finding solutions to a problem in the background.
+ *
+ * The background finds are run one at a time, on a stream of their own on the device of the
+ * handle, so the work the application queues to the stream of the handle meanwhile does not
+ * affect the measurements. The problem and the options are copied, but the buffers they reference
+ * must stay valid until the find is complete.
+ *
+ * @param handle       Handle to execute the kernels
+ * @param problem      Problem to solve
+ * @param options      Find options. When null default values would be used
+ * @param maxSolutions Limits the amount of results
+ * @param future       Pointer to the future to create
+ * @return             miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenFindSolutionsAsync(miopenHandle_t handle,
+                                                      miopenProblem_t problem,
+                                                      miopenFindOptions_t options,
+                                                      size_t maxSolutions,
+                                                      miopenFindFuture_t* future);
+
+/*! @brief Checks whether the find is complete without blocking.
+ *
+ * @param future     Future to check
+ * @param isReady    Set to 1 when the find is complete, 0 otherwise
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenFindFutureIsReady(miopenFindFuture_t future, int* isReady);
+
+/*! @brief Blocks until the find is complete.
+ *
+ * @param future     Future to wait for
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenFindFutureWait(miopenFindFuture_t future);
+
+/*! @brief Asks the find to stop early.
+ *
+ * The find returns the solutions measured so far and the best configs the stopped searches have
+ * found, which are not stored in the databases. The solutions are marked as partial, see
+ * miopenGetSolutionIsPartial. The finds queued after this one are not affected.
+ *
+ * @param future     Future of the find to stop
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenFindFutureCancel(miopenFindFuture_t future);
+
+/*! @brief Waits for the find and returns its results. May be called once per future.
+ *
+ * Returns the error of the find, if it failed.
+ *
+ * @param future       Future of the find
+ * @param solutions    Pointer to the first result. Must not be null
+ * @param numSolutions Pointer to the amount of results. Ignored if null
+ * @param maxSolutions Limits the amount of results
+ * @return             miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenFindFutureGetSolutions(miopenFindFuture_t future,
+                                                          miopenSolution_t* solutions,
+                                                          size_t* numSolutions,
+                                                          size_t maxSolutions);
+
+/*! @brief Checks whether the solution is a result of a cancelled find.
+ *
+ * The search or the measurement of a partial solution has been cut short. The time of a solution
+ * which has been built but not measured is the maximum float value.
+ *
+ * @param solution   Solution to check
+ * @param isPartial  Set to 1 when the solution is partial, 0 otherwise
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenGetSolutionIsPartial(miopenSolution_t solution, int* isPartial);
+
+/*! @brief Destroys the future, cancelling the find and waiting for it to stop.
+ *
+ * @param future     Future to destroy
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenDestroyFindFuture(miopenFindFuture_t future);
+
+#endif // MIOPEN_BETA_API
+
 /*! @brief Values of a tensor or scalar argument for the miopenRunSolution function.
  */
 struct miopenTensorArgument_t
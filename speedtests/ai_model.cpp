@@ -0,0 +1,127 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/config.h>
+#include <miopen/db_path.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK || MIOPEN_ENABLE_AI_KERNEL_TUNING
+#include <miopen/conv/heuristics/compiled_model.hpp>
+
+#include <fdeep/fdeep.hpp>
+
+// Compares frugally-deep with CompiledModel on the TunaNet and KernelTuningNet models: the time
+// to load a model from the JSON and from the prebuilt binary, and the latency of one query.
+
+namespace {
+
+template <class F>
+double MeasureUs(std::size_t iterations, F&& f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < iterations; ++i)
+        f();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+}
+
+fdeep::tensor_shape ToFdeepShape(const std::vector<std::size_t>& shape)
+{
+    if(shape.size() == 1)
+        return fdeep::tensor_shape(shape[0]);
+    return fdeep::tensor_shape(shape[0], shape[1]);
+}
+
+void Run(const miopen::fs::path& path, const miopen::fs::path& binary)
+{
+    const auto load_iterations  = std::size_t{10};
+    const auto query_iterations = std::size_t{1000};
+
+    const auto fdeep_load_us = MeasureUs(load_iterations, [&]() {
+        fdeep::load_model(path.string(), true, fdeep::dev_null_logger);
+    });
+    const auto json_load_us = MeasureUs(
+        load_iterations, [&]() { miopen::ai::CompiledModel::FromJsonFile(path); });
+    const auto model = miopen::ai::CompiledModel::FromJsonFile(path);
+    model.SaveBinary(binary);
+    const auto binary_load_us = MeasureUs(
+        load_iterations, [&]() { miopen::ai::CompiledModel::FromBinaryFile(binary); });
+
+    // Small values are valid inputs for the embeddings too.
+    auto inputs       = miopen::ai::CompiledModel::Tensors{};
+    auto fdeep_inputs = fdeep::tensors{};
+    for(const auto& shape : model.GetInputShapes())
+    {
+        const auto fdeep_shape = ToFdeepShape(shape);
+        inputs.emplace_back(fdeep_shape.volume(), 0.25f);
+        fdeep_inputs.emplace_back(fdeep_shape, inputs.back());
+    }
+    const auto fdeep_model    = fdeep::load_model(path.string(), false, fdeep::dev_null_logger);
+    const auto fdeep_query_us = MeasureUs(query_iterations, [&]() {
+        fdeep_model.predict(fdeep_inputs);
+    });
+    const auto query_us = MeasureUs(query_iterations, [&]() { model.Predict(inputs); });
+
+    std::cout << path.filename().string() << std::endl
+              << "    load: frugally-deep " << fdeep_load_us / 1000 << " ms, JSON "
+              << json_load_us / 1000 << " ms, binary " << binary_load_us / 1000 << " ms"
+              << std::endl
+              << "    query: frugally-deep " << fdeep_query_us << " us, compiled " << query_us
+              << " us" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    auto models = std::vector<miopen::fs::path>{};
+    for(int i = 1; i < argc; ++i)
+        models.emplace_back(argv[i]);
+    if(models.empty())
+    {
+        for(const auto& name : {"gfx942.tn.model",
+                                "gfx942_ConvHipIgemmGroupXdlops_encoder.ktn.model",
+                                "gfx942_ConvHipIgemmGroupXdlops_decoder.ktn.model"})
+            models.push_back(miopen::GetSystemDbPath() / name);
+    }
+
+    const miopen::TmpDir dir{"ai_model"};
+    for(const auto& model : models)
+        Run(model, dir.path / "model.bin");
+    return 0;
+}
+#else
+int main()
+{
+    std::cout << "AI heuristics are disabled" << std::endl;
+    return 0;
+}
+#endif
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/handle.hpp>
+#include <miopen/datatype.hpp>
+#include <miopen/kernel_info.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+// An application with one handle per stream creates N handles, each followed by its first call,
+// which builds or loads the programs of the kernels it runs. Compares N full handles with one
+// parent and N - 1 child handles sharing its caches. The first call only prepares the invoker of
+// a small kernel, nothing is launched. Resident memory is only reported on Linux, and is most
+// meaningful with one mode per process: speedtest_child_handles [N] [full|child].
+
+namespace {
+
+double ResidentMiB()
+{
+#ifndef _WIN32
+    std::ifstream statm("/proc/self/statm");
+    std::size_t size = 0, resident = 0;
+    if(statm >> size >> resident)
+        return static_cast<double>(resident * sysconf(_SC_PAGESIZE)) / (1024 * 1024);
+#endif
+    return 0;
+}
+
+void FirstCall(miopen::Handle& handle)
+{
+    const auto kernel = miopen::solver::KernelInfo{
+        "-DSUBTENSOR_OP_WITH_SCALAR=SUBTENSOR_OP_WITH_SCALAR_SET" +
+            miopen::GetDataTypeKernelParams(miopenFloat) + " -DWORK_LENGTH_0=1024",
+        {256, 1, 1},
+        {1024, 1, 1},
+        "MIOpenSubTensorOpWithScalarKernel.cl",
+        "SubTensorOpWithScalar1d"};
+    const auto invoker = handle.PrepareInvoker(
+        [](const std::vector<miopen::Kernel>&) {
+            return [](const miopen::Handle&, const miopen::AnyInvokeParams&) {};
+        },
+        {kernel});
+    handle.RegisterInvoker(invoker, miopen::NetworkConfig{"child_handles"}, "SetTensor");
+}
+
+using Clock = std::chrono::steady_clock;
+
+double Ms(Clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+void Run(const std::string& mode, std::size_t handles_num)
+{
+    const auto rss_before = ResidentMiB();
+    auto handles          = std::vector<std::unique_ptr<miopen::Handle>>{};
+    auto create           = Clock::duration::zero();
+    auto first_call       = Clock::duration::zero();
+
+    for(std::size_t i = 0; i < handles_num; ++i)
+    {
+        const auto start = Clock::now();
+        if(mode == "child" && !handles.empty())
+            handles.push_back(
+                std::make_unique<miopen::Handle>(*handles.front(), handles.front()->GetStream()));
+        else
+            handles.push_back(std::make_unique<miopen::Handle>());
+        const auto created = Clock::now();
+        FirstCall(*handles.back());
+        create += created - start;
+        first_call += Clock::now() - created;
+    }
+
+    std::cout << mode << ": " << Ms(create) / handles_num << " ms to create, "
+              << Ms(first_call) / handles_num << " ms to first call per handle, "
+              << ResidentMiB() - rss_before << " MiB resident for " << handles_num << " handles"
+              << std::endl;
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    const std::size_t handles_num = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 16;
+    const auto mode               = argc > 2 ? std::string{argv[2]} : std::string{};
+
+    if(mode.empty() || mode == "full")
+        Run("full", handles_num);
+    if(mode.empty() || mode == "child")
+        Run("child", handles_num);
+    return 0;
+}
@@ -0,0 +1,168 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/handle.hpp>
+#include <miopen/kernel_cache.hpp>
+#include <miopen/solver_id.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Many inference threads sharing one handle look up the kernels and invokers of a few hundred
+// shapes. Compares the sharded KernelCache with the same cache behind one mutex, which is what
+// sharing a handle used to amount to, and measures invoker lookups through the handle. Nothing
+// is launched, so this runs with the HIPNOGPU backend.
+
+namespace {
+
+class MutexKernelCache
+{
+public:
+    void AddKernel(const miopen::KernelCache::Key& key, std::size_t index)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        cache.AddKernel(key, miopen::Kernel{}, index);
+    }
+
+    bool Find(const std::string& algorithm, const std::string& network_config) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return !cache.GetKernels(algorithm, network_config)->empty();
+    }
+
+private:
+    mutable std::mutex mutex;
+    miopen::KernelCache cache;
+};
+
+class ShardedKernelCache
+{
+public:
+    void AddKernel(const miopen::KernelCache::Key& key, std::size_t index)
+    {
+        cache.AddKernel(key, miopen::Kernel{}, index);
+    }
+
+    bool Find(const std::string& algorithm, const std::string& network_config) const
+    {
+        return !cache.GetKernels(algorithm, network_config)->empty();
+    }
+
+private:
+    miopen::KernelCache cache;
+};
+
+std::vector<std::string> MakeConfigs(std::size_t shapes)
+{
+    auto configs = std::vector<std::string>{};
+    for(std::size_t i = 0; i < shapes; ++i)
+    {
+        configs.push_back(std::to_string(64 + i % 7 * 32) + "x" + std::to_string(7 + i % 50) +
+                          "x" + std::to_string(7 + i % 50) + "x3x3x" + std::to_string(i) +
+                          "x1x1xNCHWxFP16x1x1x1x1x1x1x1xFxDefault");
+    }
+    return configs;
+}
+
+/// Returns lookups per second over all threads.
+template <class Lookup>
+double Run(std::size_t threads, std::size_t lookups, std::size_t shapes, Lookup lookup)
+{
+    std::atomic<std::size_t> misses{0};
+    const auto start = std::chrono::steady_clock::now();
+    auto workers     = std::vector<std::thread>{};
+    for(std::size_t t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&, t]() {
+            for(std::size_t i = 0; i < lookups; ++i)
+            {
+                if(!lookup((i * 31 + t) % shapes))
+                    ++misses;
+            }
+        });
+    }
+    for(auto& worker : workers)
+        worker.join();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    if(misses != 0)
+        std::cout << "Unexpected misses: " << misses << std::endl;
+    const auto total = static_cast<double>(threads * lookups);
+    return total / std::chrono::duration<double>(elapsed).count();
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    const std::size_t shapes  = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 300;
+    const std::size_t lookups = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 200000;
+    const auto max_threads    = std::max(1u, std::thread::hardware_concurrency());
+    const auto configs        = MakeConfigs(shapes);
+    const auto solver         = miopen::solver::Id{"ConvDirectNaiveConvFwd"};
+
+    auto handle = miopen::Handle{};
+    for(const auto& config : configs)
+    {
+        handle.RegisterInvoker([](const miopen::Handle&, const miopen::AnyInvokeParams&) {},
+                               miopen::NetworkConfig{config},
+                               solver.ToString());
+    }
+
+    std::cout << shapes << " shapes, " << lookups << " lookups per thread" << std::endl;
+    for(std::size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        MutexKernelCache mutex_cache;
+        ShardedKernelCache sharded_cache;
+        for(const auto& config : configs)
+        {
+            mutex_cache.AddKernel({"algo", config}, 0);
+            sharded_cache.AddKernel({"algo", config}, 0);
+        }
+
+        const auto mutex_rate   = Run(threads, lookups, shapes, [&](auto i) {
+            return mutex_cache.Find("algo", configs[i]);
+        });
+        const auto sharded_rate = Run(threads, lookups, shapes, [&](auto i) {
+            return sharded_cache.Find("algo", configs[i]);
+        });
+        const auto invoker_rate = Run(threads, lookups, shapes, [&](auto i) {
+            return handle.GetInvoker(miopen::NetworkConfig{configs[i]}, solver).has_value();
+        });
+        std::cout << threads << " threads: kernels+mutex " << mutex_rate / 1e6
+                  << " M lookups/s, KernelCache " << sharded_rate / 1e6
+                  << " M lookups/s, Handle::GetInvoker " << invoker_rate / 1e6 << " M lookups/s"
+                  << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,145 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/invoker_cache.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Simulates the steady state of an inference loop: many threads sharing a handle look up the
+// invokers of a few hundred shapes. Compares InvokerCache with an ordered map behind a mutex,
+// which is how the invokers were stored before.
+
+namespace {
+
+class MutexMapCache
+{
+public:
+    void Register(const miopen::InvokerCache::Key& key, const miopen::Invoker& invoker)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        invokers[key.first][key.second] = invoker;
+    }
+
+    std::optional<miopen::Invoker> Get(const std::string& network_config,
+                                       const std::string& solver_id) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto item = invokers.find(network_config);
+        if(item == invokers.end())
+            return std::nullopt;
+        const auto invoker = item->second.find(solver_id);
+        if(invoker == item->second.end())
+            return std::nullopt;
+        return invoker->second;
+    }
+
+private:
+    mutable std::mutex mutex;
+    std::map<std::string, std::map<std::string, miopen::Invoker>> invokers;
+};
+
+std::vector<miopen::InvokerCache::Key> MakeKeys(std::size_t shapes)
+{
+    const std::vector<std::string> solvers = {"ConvBinWinograd3x3U",
+                                              "ConvHipImplicitGemmFwdXdlops",
+                                              "GemmFwd1x1_0_1",
+                                              "ConvDirectNaiveConvFwd"};
+    auto keys = std::vector<miopen::InvokerCache::Key>{};
+    for(std::size_t i = 0; i < shapes; ++i)
+    {
+        const auto config = std::to_string(64 + i % 7 * 32) + "x" + std::to_string(7 + i % 50) +
+                            "x" + std::to_string(7 + i % 50) + "x3x3x" + std::to_string(i) +
+                            "x1x1xNCHWxFP16x1x1x1x1x1x1x1xFxDefault";
+        keys.emplace_back(config, solvers[i % solvers.size()]);
+    }
+    return keys;
+}
+
+template <class Cache>
+double Run(Cache& cache,
+           const std::vector<miopen::InvokerCache::Key>& keys,
+           std::size_t threads,
+           std::size_t lookups)
+{
+    for(const auto& key : keys)
+        cache.Register(key, [](const miopen::Handle&, const miopen::AnyInvokeParams&) {});
+
+    std::atomic<std::size_t> misses{0};
+    const auto start = std::chrono::steady_clock::now();
+    auto workers     = std::vector<std::thread>{};
+    for(std::size_t t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&, t]() {
+            for(std::size_t i = 0; i < lookups; ++i)
+            {
+                const auto& key = keys[(i * 31 + t) % keys.size()];
+                if(!cache.Get(key.first, key.second))
+                    ++misses;
+            }
+        });
+    }
+    for(auto& worker : workers)
+        worker.join();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    if(misses != 0)
+        std::cout << "Unexpected misses: " << misses << std::endl;
+    const auto total = static_cast<double>(threads * lookups);
+    return total / std::chrono::duration<double>(elapsed).count();
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    const std::size_t shapes  = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 300;
+    const std::size_t lookups = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000000;
+    const auto max_threads    = std::max(1u, std::thread::hardware_concurrency());
+    const auto keys           = MakeKeys(shapes);
+
+    std::cout << shapes << " shapes, " << lookups << " lookups per thread" << std::endl;
+    for(std::size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        MutexMapCache mutex_map;
+        miopen::InvokerCache invoker_cache;
+        const auto mutex_map_rate     = Run(mutex_map, keys, threads, lookups);
+        const auto invoker_cache_rate = Run(invoker_cache, keys, threads, lookups);
+        std::cout << threads << " threads: map+mutex " << mutex_map_rate / 1e6
+                  << " M lookups/s, InvokerCache " << invoker_cache_rate / 1e6 << " M lookups/s"
+                  << std::endl;
+    }
+    return 0;
+}
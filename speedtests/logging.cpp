@@ -0,0 +1,104 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/env.hpp>
+#include <miopen/logger.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+// Measures the time a logging thread spends in the MIOPEN_LOG_* macros, for each MIOPEN_LOG_LEVEL,
+// with the messages written to stderr synchronously and with MIOPEN_LOG_ASYNC. The log goes to
+// /dev/null or to a file. The environment variables are read once, so each configuration is run in
+// a child process: speedtest_logging [iterations] [log file].
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template <class F>
+double NsPerCall(std::size_t iterations, F&& f)
+{
+    const auto start = Clock::now();
+    for(std::size_t i = 0; i < iterations; ++i)
+        f(i);
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / iterations;
+}
+
+int RunChild(std::size_t iterations, const char* log_file)
+{
+    if(std::freopen(log_file, "w", stderr) == nullptr)
+        return 1;
+
+    const auto warning = NsPerCall(iterations, [](auto i) { MIOPEN_LOG_W("warning " << i); });
+    const auto info    = NsPerCall(iterations, [](auto i) { MIOPEN_LOG_I("info " << i); });
+    const auto info2   = NsPerCall(iterations, [](auto i) { MIOPEN_LOG_I2("info2 " << i); });
+    const auto trace   = NsPerCall(iterations, [](auto i) { MIOPEN_LOG_T("trace " << i); });
+
+    const auto start = Clock::now();
+    miopen::LogFlush();
+    const auto flush = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    std::cout << std::fixed << std::setprecision(1) << std::setw(10) << warning << std::setw(10)
+              << info << std::setw(10) << info2 << std::setw(10) << trace << std::setw(12) << flush
+              << std::endl;
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    if(argc > 3 && std::string{argv[1]} == "--child")
+        return RunChild(std::strtoull(argv[2], nullptr, 10), argv[3]);
+
+    const auto iterations = argc > 1 ? std::string{argv[1]} : std::string{"100000"};
+    const auto log_file   = argc > 2 ? std::string{argv[2]} : std::string{"/dev/null"};
+
+    // Large enough to not drop anything, dropped messages would be unfairly cheap.
+    miopen::env::setEnvironmentVariable("MIOPEN_LOG_ASYNC_CAPACITY", "65536");
+
+    std::cout << "ns per call on the logging thread, ms to flush at the end" << std::endl;
+    std::cout << "level mode          W         I        I2         T       flush" << std::endl;
+    for(const auto* async : {"0", "1"})
+    {
+        for(auto level = 1; level <= 7; ++level)
+        {
+            miopen::env::setEnvironmentVariable("MIOPEN_LOG_LEVEL", std::to_string(level));
+            miopen::env::setEnvironmentVariable("MIOPEN_LOG_ASYNC", async);
+            std::cout << std::setw(5) << level << (async[0] == '1' ? " async" : " sync ")
+                      << std::flush;
+            const auto command = std::string{argv[0]} + " --child " + iterations + " " + log_file;
+            if(std::system(command.c_str()) != 0)
+                return 1;
+        }
+    }
+    return 0;
+}
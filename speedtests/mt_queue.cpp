@@ -0,0 +1,132 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/mt_queue.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Compares the lock-free ThreadSafeQueue with the previous implementation, a std::queue under a
+// mutex with two condition variables, for several numbers of producers and consumers sharing a
+// small bounded queue.
+
+namespace {
+
+template <typename T>
+class MutexQueue
+{
+    std::mutex mutex;
+    std::condition_variable cond_var;
+    std::condition_variable not_full;
+    std::queue<T> queue;
+    std::size_t capacity;
+
+public:
+    explicit MutexQueue(std::size_t capacity_) : capacity(capacity_) {}
+
+    bool push(T&& item)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            not_full.wait(lock, [&] { return queue.size() < capacity; });
+            queue.push(item);
+        }
+        cond_var.notify_one();
+        return true;
+    }
+
+    T pop()
+    {
+        T ret = [&]() {
+            std::unique_lock<std::mutex> lock(mutex);
+            cond_var.wait(lock, [&] { return !queue.empty(); });
+            T front = queue.front();
+            queue.pop();
+            return front;
+        }();
+        not_full.notify_one();
+        return ret;
+    }
+};
+
+/// Returns millions of items passed through the queue per second.
+template <class Queue>
+double Measure(std::size_t items, int producers, int consumers, std::size_t capacity)
+{
+    Queue queue(capacity);
+    std::vector<std::thread> threads;
+    const auto start = std::chrono::steady_clock::now();
+
+    for(auto p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&, p] {
+            for(auto i = static_cast<std::size_t>(p); i < items; i += producers)
+                queue.push(std::vector<int>(4, static_cast<int>(i)));
+        });
+    }
+    for(auto c = 0; c < consumers; ++c)
+    {
+        threads.emplace_back([&, c] {
+            for(auto i = static_cast<std::size_t>(c); i < items; i += consumers)
+                queue.pop();
+        });
+    }
+    for(auto& thread : threads)
+        thread.join();
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return items / std::chrono::duration<double, std::micro>(elapsed).count();
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    const std::size_t items    = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    const std::size_t capacity = 64;
+
+    std::cout << std::thread::hardware_concurrency() << " hardware threads, " << items
+              << " items, capacity " << capacity << std::endl;
+
+    for(const auto& [producers, consumers] : {std::pair{1, 1}, {1, 4}, {4, 1}, {4, 4}})
+    {
+        using Item          = std::vector<int>;
+        const auto mutexed  = Measure<MutexQueue<Item>>(items, producers, consumers, capacity);
+        const auto lockfree = Measure<ThreadSafeQueue<Item>>(items, producers, consumers, capacity);
+        std::cout << producers << "p/" << consumers << "c: mutex " << mutexed
+                  << " M items/s, lock free " << lockfree << " M items/s, speedup "
+                  << lockfree / mutexed << "x" << std::endl;
+    }
+
+    return 0;
+}
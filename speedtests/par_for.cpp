@@ -0,0 +1,146 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/par_for.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Compares par_for on the shared pool with the previous implementation, which spawned and
+// joined threadsize threads per call, each with an equal static chunk. Small loops measure the
+// overhead per call, skewed loops the load balance.
+
+namespace {
+
+template <class F>
+void SpawnPerCall(std::size_t n, F f)
+{
+    const auto threadsize =
+        std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()), n / 8);
+    if(threadsize <= 1)
+    {
+        for(std::size_t i = 0; i < n; i++)
+            f(i);
+        return;
+    }
+
+    const std::size_t grainsize = (n + threadsize - 1) / threadsize;
+    auto threads                = std::vector<std::thread>{};
+    for(std::size_t start = 0; start < n; start += grainsize)
+    {
+        threads.emplace_back([=] {
+            for(std::size_t i = start; i < std::min(n, start + grainsize); i++)
+                f(i);
+        });
+    }
+    for(auto& thread : threads)
+        thread.join();
+}
+
+/// Busy work of about cost nanoseconds-ish, the result is kept so it's not optimized out.
+double Work(std::size_t cost)
+{
+    double x = 1.0;
+    for(std::size_t k = 0; k < cost; ++k)
+        x = std::sqrt(x + static_cast<double>(k));
+    return x;
+}
+
+template <class Loop>
+double Measure(std::size_t calls, std::size_t n, Loop loop)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for(std::size_t c = 0; c < calls; ++c)
+        loop(n);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::micro>(elapsed).count() / calls;
+}
+
+void Report(const std::string& name, double spawn_us, double pool_us)
+{
+    std::cout << name << ": spawn per call " << spawn_us << " us, pool " << pool_us
+              << " us, speedup " << spawn_us / pool_us << "x" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    const std::size_t calls = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000;
+    std::atomic<double> sink{0};
+
+    std::cout << std::thread::hardware_concurrency() << " hardware threads, " << calls
+              << " calls per loop" << std::endl;
+
+    for(std::size_t n : {64, 1024})
+    {
+        const auto small = [&](std::size_t i) {
+            if(Work(16 + i % 4) < 0)
+                sink = sink + 1;
+        };
+        const auto spawn = Measure(calls, n, [&](auto size) { SpawnPerCall(size, small); });
+        const auto pool  = Measure(calls, n, [&](auto size) { miopen::par_for(size, small); });
+        Report("small, n=" + std::to_string(n), spawn, pool);
+    }
+
+    {
+        // the last eighth of the iterations costs 64 times more, as with mixed problem sizes
+        constexpr std::size_t n = 4096;
+        const auto skewed       = [&](std::size_t i) {
+            if(Work(i >= n - n / 8 ? 4096 : 64) < 0)
+                sink = sink + 1;
+        };
+        const auto spawn =
+            Measure(calls / 10 + 1, n, [&](auto size) { SpawnPerCall(size, skewed); });
+        const auto pool =
+            Measure(calls / 10 + 1, n, [&](auto size) { miopen::par_for(size, skewed); });
+        Report("skewed, n=" + std::to_string(n), spawn, pool);
+    }
+
+    {
+        // an outer loop over a few items, each with an inner parallel loop
+        const auto inner = [&](std::size_t i) {
+            if(Work(32 + i % 8) < 0)
+                sink = sink + 1;
+        };
+        const auto spawn = Measure(calls / 10 + 1, 16, [&](auto size) {
+            SpawnPerCall(size * 8, [&](auto) { SpawnPerCall(256, inner); });
+        });
+        const auto pool  = Measure(calls / 10 + 1, 16, [&](auto size) {
+            miopen::par_for(size * 8, [&](auto) { miopen::par_for(256, inner); });
+        });
+        Report("nested, 128x256", spawn, pool);
+    }
+
+    return sink > 0 ? 1 : 0;
+}
@@ -0,0 +1,111 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/batchnorm/problem_description.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/problem_key.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Measures the host overhead of building the keys of the hot-path caches: formatting the text
+// keys on every call versus a binary key and a lookup of the formatted text.
+
+namespace {
+
+template <class F>
+double MeasureNs(std::size_t iterations, F&& f)
+{
+    std::size_t total_size = 0;
+    const auto start       = std::chrono::steady_clock::now();
+    for(std::size_t i = 0; i < iterations; ++i)
+        total_size += f();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const auto time    = std::chrono::duration<double, std::nano>(elapsed).count();
+    if(total_size == 0)
+        std::cout << "Unexpected empty keys" << std::endl;
+    return time / static_cast<double>(iterations);
+}
+
+template <class F>
+void Compare(const std::string& name, std::size_t iterations, F&& f)
+{
+    miopen::ProblemKeyTextCache::SetEnabled(false);
+    const auto text_ns = MeasureNs(iterations, f);
+    miopen::ProblemKeyTextCache::SetEnabled(true);
+    const auto key_ns = MeasureNs(iterations, f);
+    std::cout << name << ": text " << text_ns << " ns, binary key " << key_ns << " ns per call"
+              << std::endl;
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    const std::size_t iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    const auto in      = miopen::TensorDescriptor{miopenHalf, {16, 64, 56, 56}};
+    const auto weights = miopen::TensorDescriptor{miopenHalf, {64, 64, 3, 3}};
+    const auto out     = miopen::TensorDescriptor{miopenHalf, {16, 64, 56, 56}};
+    const auto conv    = miopen::ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}};
+    const auto conv_problem =
+        miopen::conv::ProblemDescription{in, weights, out, conv, miopen::conv::Direction::Forward};
+
+    Compare("conv::ProblemDescription::MakeNetworkConfig", iterations, [&]() {
+        return conv_problem.MakeNetworkConfig().ToString().size();
+    });
+    Compare("conv::ProblemDescription::Serialize", iterations, [&]() {
+        std::ostringstream ss;
+        conv_problem.Serialize(ss);
+        return ss.str().size();
+    });
+
+    // The steady state of a network: a few hundred problems in turns.
+    auto problems = std::vector<miopen::conv::ProblemDescription>{};
+    for(int i = 0; i < 300; ++i)
+    {
+        const auto pad = miopen::ConvolutionDescriptor{{i, i}, {1, 1}, {1, 1}};
+        problems.emplace_back(in, weights, out, pad, miopen::conv::Direction::Forward);
+    }
+    auto next = std::size_t{0};
+    Compare("conv::ProblemDescription::MakeNetworkConfig, 300 problems", iterations, [&]() {
+        return problems[next++ % problems.size()].MakeNetworkConfig().ToString().size();
+    });
+
+    const auto scale_bias = miopen::TensorDescriptor{miopenFloat, {1, 64, 1, 1}};
+    const auto bn_problem = miopen::batchnorm::ProblemDescription{
+        miopenBNSpatial, in, out, scale_bias, 1.0, 1e-5, true, true};
+
+    Compare("batchnorm::ProblemDescription::MakeNetworkConfig", iterations, [&]() {
+        return bn_problem.MakeNetworkConfig().ToString().size();
+    });
+
+    return 0;
+}
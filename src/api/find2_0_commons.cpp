@@ -28,6 +28,8 @@
 
 #include <miopen/common.hpp>
 #include <miopen/errors.hpp>
+#include <miopen/find_async.hpp>
+#include <miopen/find_monitor.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/problem.hpp>
 #include <miopen/search_options.hpp>
@@ -38,6 +40,8 @@
 #include <nlohmann/json.hpp>
 #include <boost/hof/match.hpp>
 
+#include <algorithm>
+
 template <class OperationDescriptor>
 static miopenStatus_t MakeProblem(miopenProblem_t* problem,
                                   OperationDescriptor operatorDesc,
@@ -268,6 +272,27 @@ miopenStatus_t miopenSetFindOptionAttachBinaries(miopenFindOptions_t options, un
     });
 }
 
+miopenStatus_t miopenSetFindOptionTimingPolicy(miopenFindOptions_t options,
+                                               size_t warmup_runs,
+                                               size_t max_runs,
+                                               float confidence_interval)
+{
+    MIOPEN_LOG_FUNCTION(options, warmup_runs, max_runs, confidence_interval);
+
+    return miopen::try_([&] {
+        if(max_runs == 0)
+            MIOPEN_THROW(miopenStatusBadParm, "At least one measured run is required");
+        if(!(confidence_interval >= 0.0f))
+            MIOPEN_THROW(miopenStatusBadParm, "Confidence interval must be non-negative");
+
+        auto& policy               = miopen::deref(options).timing_policy;
+        policy.warmup_runs         = warmup_runs;
+        policy.max_runs            = max_runs;
+        policy.min_runs            = std::min(policy.min_runs, max_runs);
+        policy.confidence_interval = confidence_interval;
+    });
+}
+
 miopenStatus_t miopenFindSolutions(miopenHandle_t handle,
                                    miopenProblem_t problem,
                                    miopenFindOptions_t options,
@@ -303,6 +328,107 @@ miopenStatus_t miopenFindSolutions(miopenHandle_t handle,
     });
 }
 
+miopenStatus_t miopenSetFindOptionProgressCallback(miopenFindOptions_t options,
+                                                   miopenFindProgressCallback callback,
+                                                   void* userData)
+{
+    MIOPEN_LOG_FUNCTION(options, userData);
+
+    return miopen::try_([&] {
+        auto& monitor = miopen::deref(options).monitor;
+
+        if(callback == nullptr)
+        {
+            monitor = nullptr;
+            return;
+        }
+
+        monitor = std::make_shared<miopen::FindMonitor>(
+            [callback, userData](std::size_t done, std::size_t total, float best_time) {
+                callback(userData, done, total, best_time);
+            });
+    });
+}
+
+miopenStatus_t miopenFindSolutionsAsync(miopenHandle_t handle,
+                                        miopenProblem_t problem,
+                                        miopenFindOptions_t options,
+                                        size_t maxSolutions,
+                                        miopenFindFuture_t* future)
+{
+    MIOPEN_LOG_FUNCTION(handle, problem, options, maxSolutions, future);
+
+    return miopen::try_([&] {
+        auto& handle_deref        = miopen::deref(handle);
+        const auto& problem_deref = miopen::deref(problem);
+
+        std::visit([](auto&& problem) { problem.LogDriverCommand(); }, problem_deref.item);
+
+        auto options_deref = options == nullptr ? miopen::FindOptions{} : miopen::deref(options);
+
+        miopen::deref(future) = new miopen::FindFuture{
+            handle_deref, problem_deref, std::move(options_deref), maxSolutions};
+    });
+}
+
+miopenStatus_t miopenFindFutureIsReady(miopenFindFuture_t future, int* isReady)
+{
+    MIOPEN_LOG_FUNCTION(future, isReady);
+    return miopen::try_([&] { miopen::deref(isReady) = miopen::deref(future).IsReady() ? 1 : 0; });
+}
+
+miopenStatus_t miopenFindFutureWait(miopenFindFuture_t future)
+{
+    MIOPEN_LOG_FUNCTION(future);
+    return miopen::try_([&] { miopen::deref(future).Wait(); });
+}
+
+miopenStatus_t miopenFindFutureCancel(miopenFindFuture_t future)
+{
+    MIOPEN_LOG_FUNCTION(future);
+    return miopen::try_([&] { miopen::deref(future).Cancel(); });
+}
+
+miopenStatus_t miopenFindFutureGetSolutions(miopenFindFuture_t future,
+                                            miopenSolution_t* solutions,
+                                            size_t* numSolutions,
+                                            size_t maxSolutions)
+{
+    MIOPEN_LOG_FUNCTION(future, solutions, numSolutions, maxSolutions);
+
+    return miopen::try_([&] {
+        auto solutions_deref = miopen::deref(future).Get();
+
+        if(solutions_deref.size() > maxSolutions)
+            solutions_deref.resize(maxSolutions);
+
+        for(auto i = 0; i < solutions_deref.size(); ++i)
+        {
+            auto& theSolution = miopen::deref(solutions + i);
+            theSolution       = new miopen::Solution{std::move(solutions_deref[i])};
+        }
+
+        if(numSolutions != nullptr)
+            *numSolutions = solutions_deref.size();
+    });
+}
+
+miopenStatus_t miopenGetSolutionIsPartial(miopenSolution_t solution, int* isPartial)
+{
+    MIOPEN_LOG_FUNCTION(solution);
+
+    return miopen::try_([&] {
+        const auto& solution_deref = miopen::deref(solution);
+        *isPartial                 = solution_deref.IsPartial() ? 1 : 0;
+    });
+}
+
+miopenStatus_t miopenDestroyFindFuture(miopenFindFuture_t future)
+{
+    MIOPEN_LOG_FUNCTION(future);
+    return miopen::try_([&] { miopen_destroy_object(future); });
+}
+
 inline std::ostream& operator<<(std::ostream& stream, const miopenTensorArgument_t& tensor)
 {
     switch(tensor.id)
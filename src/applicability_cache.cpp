@@ -0,0 +1,355 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/applicability_cache.hpp>
+
+#include <miopen/any_solver.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/db_path.hpp>
+#include <miopen/env.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/lock_file.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/stringutils.hpp>
+#include <miopen/tensor.hpp>
+#include <miopen/version.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#ifdef _WIN32
+#define environ _environ
+#else
+extern char** environ; // NOLINT (cppcoreguidelines-avoid-non-const-global-variables)
+#endif
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_DISABLE_APPLICABILITY_CACHE)
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_APPLICABILITY_CACHE_PERSIST)
+
+namespace miopen {
+
+namespace {
+
+constexpr std::size_t bits_per_word = 64;
+
+std::string ToHex(const std::vector<std::uint64_t>& words)
+{
+    std::ostringstream ss;
+    ss << std::hex;
+    for(std::size_t i = 0; i < words.size(); ++i)
+        ss << (i == 0 ? "" : ",") << words[i];
+    return ss.str();
+}
+
+std::optional<std::vector<std::uint64_t>> FromHex(const std::string& str)
+{
+    auto words = std::vector<std::uint64_t>{};
+    for(const auto& item : SplitDelim(str, ','))
+    {
+        char* end        = nullptr;
+        const auto value = std::strtoull(item.c_str(), &end, 16);
+        if(item.empty() || *end != '\0')
+            return std::nullopt;
+        words.push_back(value);
+    }
+    return words;
+}
+
+std::string GetVersion(const Handle& handle)
+{
+    return std::to_string(MIOPEN_VERSION_MAJOR) + "." + std::to_string(MIOPEN_VERSION_MINOR) +
+           "." + std::to_string(MIOPEN_VERSION_PATCH) + "." +
+           MIOPEN_STRINGIZE(MIOPEN_VERSION_TWEAK) + " " + handle.GetTargetProperties().DbId();
+}
+
+fs::path GetPath(const Handle& handle)
+{
+#if !MIOPEN_DISABLE_USERDB
+    if(!env::enabled(MIOPEN_APPLICABILITY_CACHE_PERSIST))
+        return {};
+    const auto& udb = GetUserDbPath();
+    if(udb.empty())
+        return {};
+    return udb / (handle.GetDbBasename() + "." + GetUserDbSuffix() + ".applicability.txt");
+#else
+    std::ignore = handle;
+    return {};
+#endif
+}
+
+} // namespace
+
+std::optional<bool> ApplicabilityCache::Entry::Get(std::uint64_t solver_id) const
+{
+    const auto word = solver_id / bits_per_word;
+    const auto mask = std::uint64_t{1} << (solver_id % bits_per_word);
+    if(word >= checked.size() || (checked[word] & mask) == 0)
+        return std::nullopt;
+    return (applicable[word] & mask) != 0;
+}
+
+void ApplicabilityCache::Entry::Set(std::uint64_t solver_id, bool is_applicable)
+{
+    const auto word = solver_id / bits_per_word;
+    const auto mask = std::uint64_t{1} << (solver_id % bits_per_word);
+    if(word >= checked.size())
+    {
+        checked.resize(word + 1);
+        applicable.resize(word + 1);
+    }
+    checked[word] |= mask;
+    if(is_applicable)
+        applicable[word] |= mask;
+    else
+        applicable[word] &= ~mask;
+}
+
+void ApplicabilityCache::Entry::Merge(const Entry& other)
+{
+    if(other.checked.size() > checked.size())
+    {
+        checked.resize(other.checked.size());
+        applicable.resize(other.checked.size());
+    }
+    for(std::size_t i = 0; i < other.checked.size(); ++i)
+    {
+        checked[i] |= other.checked[i];
+        applicable[i] = (applicable[i] & ~other.checked[i]) | other.applicable[i];
+    }
+}
+
+std::string ApplicabilityCache::Entry::ToString() const
+{
+    return ToHex(checked) + " " + ToHex(applicable);
+}
+
+std::optional<ApplicabilityCache::Entry>
+ApplicabilityCache::Entry::FromString(const std::string& str)
+{
+    const auto fields = SplitSpaceSeparated(str);
+    if(fields.size() != 2)
+        return std::nullopt;
+    auto checked    = FromHex(fields[0]);
+    auto applicable = FromHex(fields[1]);
+    if(!checked || !applicable || checked->size() != applicable->size())
+        return std::nullopt;
+    return Entry{std::move(*checked), std::move(*applicable)};
+}
+
+ApplicabilityCache::~ApplicabilityCache()
+{
+    try
+    {
+        Save();
+    }
+    catch(...)
+    {
+        // Never throw from the destructor, the cache is only an optimization.
+    }
+}
+
+void ApplicabilityCache::Open(const fs::path& path_, const std::string& version_)
+{
+    std::call_once(opened, [&]() {
+        std::lock_guard<std::shared_mutex> lock(mutex);
+        path    = path_;
+        version = version_;
+        if(path.empty())
+            return;
+        for(auto& [key, entry] : Load())
+            entries[key].Merge(entry);
+        MIOPEN_LOG_I2("Loaded " << entries.size() << " problems from " << path);
+    });
+}
+
+ApplicabilityCache::Entry ApplicabilityCache::Get(const std::string& key) const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    const auto found = entries.find(key);
+    return found != entries.end() ? found->second : Entry{};
+}
+
+void ApplicabilityCache::Set(const std::string& key, std::uint64_t solver_id, bool is_applicable)
+{
+    std::lock_guard<std::shared_mutex> lock(mutex);
+    entries[key].Set(solver_id, is_applicable);
+    if(!path.empty())
+        unsaved[key].Set(solver_id, is_applicable);
+}
+
+ApplicabilityCache::Entries ApplicabilityCache::Load() const
+{
+    Entries loaded;
+    std::ifstream in(path);
+    std::string line;
+    if(!std::getline(in, line) || line != version)
+    {
+        if(in)
+            MIOPEN_LOG_I("Ignoring " << path << " written for " << line);
+        return loaded;
+    }
+    while(std::getline(in, line))
+    {
+        const auto separator = line.find(';');
+        const auto entry     = separator == std::string::npos
+                                   ? std::nullopt
+                                   : Entry::FromString(line.substr(separator + 1));
+        if(!entry)
+        {
+            MIOPEN_LOG_W("Skipping malformed line in " << path << ": " << line);
+            continue;
+        }
+        loaded[line.substr(0, separator)].Merge(*entry);
+    }
+    return loaded;
+}
+
+void ApplicabilityCache::Save()
+{
+    std::lock_guard<std::shared_mutex> lock(mutex);
+    if(path.empty() || unsaved.empty())
+        return;
+
+    auto& lock_file = LockFile::Get(path + ".lock");
+    std::lock_guard<LockFile> file_lock(lock_file);
+
+    // Other processes may have updated the file since it was read.
+    auto merged = Load();
+    for(const auto& [key, entry] : unsaved)
+        merged[key].Merge(entry);
+    unsaved.clear();
+
+    std::ofstream out(path, std::ios::trunc);
+    out << version << '\n';
+    for(const auto& [key, entry] : merged)
+        out << key << ';' << entry.ToString() << '\n';
+    if(!out)
+        MIOPEN_LOG_W("Unable to save applicability cache to " << path);
+}
+
+ConvApplicability::ConvApplicability(const ExecutionContext& ctx_,
+                                     const conv::ProblemDescription& problem_)
+    : ctx(ctx_), problem(problem_)
+{
+    if(env::enabled(MIOPEN_DEBUG_DISABLE_APPLICABILITY_CACHE))
+        return;
+
+    auto& handle = ctx.GetStream();
+    cache        = &handle.GetApplicabilityCache();
+    cache->Open(GetPath(handle), GetVersion(handle));
+
+    key   = GetApplicabilityKey(ctx, problem);
+    entry = cache->Get(key);
+}
+
+bool ConvApplicability::IsApplicable(solver::Id solver_id)
+{
+    if(cache == nullptr)
+        return solver_id.GetSolver().IsApplicable(ctx, problem);
+
+    const auto known = entry.Get(solver_id.Value());
+    if(known)
+        return *known;
+
+    const auto is_applicable = solver_id.GetSolver().IsApplicable(ctx, problem);
+    entry.Set(solver_id.Value(), is_applicable);
+    cache->Set(key, solver_id.Value(), is_applicable);
+    return is_applicable;
+}
+
+std::string GetApplicabilityKey(const ExecutionContext& ctx,
+                                const conv::ProblemDescription& problem)
+{
+    // The result of IsApplicable() depends on the problem, the context and the environment.
+    // Serialize() is the perf-db key, it leaves out properties that some solvers check.
+    std::ostringstream ss;
+    problem.Serialize(ss);
+
+    const auto print_strides = [&](const TensorDescriptor& desc) {
+        ss << ' ';
+        for(const auto stride : desc.GetStrides())
+            ss << stride << 'x';
+    };
+    print_strides(problem.GetIn());
+    print_strides(problem.GetWeights());
+    print_strides(problem.GetOut());
+
+    const auto& conv = problem.GetConv();
+    ss << ' ' << problem.GetAlphaBetaCase() << ' ' << conv.mode << conv.paddingMode;
+    for(const auto pad : conv.GetTransposeConvPads())
+        ss << 'x' << pad;
+    // The fp8 rounding seed is left out, every descriptor gets a random one.
+    ss << ' ' << conv.attribute.Get(MIOPEN_CONVOLUTION_ATTRIB_FP16_ALT_IMPL) << ','
+       << conv.attribute.Get(MIOPEN_CONVOLUTION_ATTRIB_DETERMINISTIC) << ','
+       << conv.attribute.Get(MIOPEN_CONVOLUTION_ATTRIB_FP8_ROUNDING_MODE);
+
+    ss << ' ' << ctx.use_asm_kernels << ctx.use_hip_kernels << ctx.use_opencl_convolutions
+       << ctx.use_dynamic_solutions_only << ctx.rmv.getValue() << ' '
+       << GetApplicabilityEnvFingerprint();
+    return ss.str();
+}
+
+std::string GetApplicabilityEnvFingerprint()
+{
+    // Scanning the environment is too slow for every lookup. It is done again only after
+    // miopen::env has changed it.
+    thread_local auto generation  = std::optional<std::uint64_t>{};
+    thread_local auto fingerprint = std::string{};
+    const auto current            = env::getEnvironmentGeneration();
+    if(generation == current)
+        return fingerprint;
+
+    const std::string prefix = "MIOPEN_DEBUG_";
+    auto vars                = std::vector<std::string>{};
+    for(auto var = environ; var != nullptr && *var != nullptr; ++var)
+    {
+        if(std::string_view{*var}.substr(0, prefix.size()) == prefix)
+            vars.emplace_back(*var);
+    }
+    std::sort(vars.begin(), vars.end());
+
+    // FNV-1a, stable across processes unlike std::hash.
+    auto hash = std::uint64_t{0xcbf29ce484222325};
+    for(const auto& var : vars)
+    {
+        for(const auto c : var + '\n')
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 0x100000001b3;
+        }
+    }
+    std::ostringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+    fingerprint = ss.str();
+    generation  = current;
+    return fingerprint;
+}
+
+} // namespace miopen
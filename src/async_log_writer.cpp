@@ -0,0 +1,147 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/async_log_writer.hpp>
+
+#include <chrono>
+#include <utility>
+
+namespace miopen {
+
+namespace {
+
+// After writing, the writer waits this long for more messages to write them at once, so the
+// logging threads rarely have to wake it up.
+constexpr auto batch_delay = std::chrono::milliseconds{1};
+
+} // namespace
+
+AsyncLogWriter::AsyncLogWriter(std::ostream& stream_, std::size_t capacity)
+    : stream(stream_), queue(capacity), thread([this]() { Run(); })
+{
+}
+
+AsyncLogWriter::~AsyncLogWriter() { Stop(); }
+
+bool AsyncLogWriter::Write(std::string& message)
+{
+    if(stopped.load(std::memory_order_acquire))
+        return false;
+    // An empty message stops the background thread.
+    if(message.empty())
+        return true;
+
+    if(queue.try_push(std::move(message)))
+    {
+        queued.fetch_add(1, std::memory_order_release);
+    }
+    else
+    {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        dropped_total.fetch_add(1, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+void AsyncLogWriter::Flush()
+{
+    const auto target = queued.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(written_mutex);
+    written_cv.wait(lock, [&]() { return written >= target || finished; });
+}
+
+void AsyncLogWriter::Stop()
+{
+    std::lock_guard<std::mutex> stop_lock(stop_mutex);
+    if(stopped.exchange(true, std::memory_order_acq_rel))
+        return;
+
+    queue.push(std::string{});
+    thread.join();
+
+    // Messages queued while stopping.
+    auto batch = std::string{};
+    auto count = std::size_t{0};
+    while(auto message = queue.try_pop())
+    {
+        batch += *message;
+        ++count;
+    }
+    WriteBatch(batch, count);
+
+    {
+        std::lock_guard<std::mutex> lock(written_mutex);
+        finished = true;
+    }
+    written_cv.notify_all();
+}
+
+void AsyncLogWriter::Run()
+{
+    auto batch = std::string{};
+    auto stop  = false;
+
+    while(!stop)
+    {
+        batch      = queue.pop();
+        auto count = std::size_t{1};
+        stop       = batch.empty();
+
+        while(!stop)
+        {
+            auto message = queue.try_pop();
+            if(!message)
+                break;
+            stop = message->empty();
+            batch += *message;
+            ++count;
+        }
+
+        WriteBatch(batch, stop ? count - 1 : count);
+
+        // The messages logged meanwhile stay in the queue, where the crash handler can reach them.
+        if(!stop)
+            std::this_thread::sleep_for(batch_delay);
+    }
+}
+
+void AsyncLogWriter::WriteBatch(std::string& batch, std::size_t count)
+{
+    const auto n_dropped = dropped.exchange(0, std::memory_order_relaxed);
+    if(n_dropped != 0)
+        stream << "MIOpen: " << n_dropped << " log messages have been dropped\n";
+    stream << batch;
+    stream.flush();
+    batch.clear();
+
+    {
+        std::lock_guard<std::mutex> lock(written_mutex);
+        written += count;
+    }
+    written_cv.notify_all();
+}
+
+} // namespace miopen
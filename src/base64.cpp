@@ -0,0 +1,96 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/base64.hpp>
+
+#include <miopen/errors.hpp>
+
+#include <array>
+
+namespace miopen {
+
+namespace {
+
+constexpr const char* symbols = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+} // namespace
+
+std::string EncodeBase64(const std::vector<std::uint8_t>& bytes)
+{
+    auto text = std::string{};
+    text.reserve((bytes.size() + 2) / 3 * 4);
+    uint32_t bits = 0;
+    int bit_count = 0;
+    for(const auto byte : bytes)
+    {
+        bits = (bits << 8) | byte;
+        bit_count += 8;
+        while(bit_count >= 6)
+        {
+            bit_count -= 6;
+            text.push_back(symbols[(bits >> bit_count) & 0x3f]);
+        }
+    }
+    if(bit_count > 0)
+        text.push_back(symbols[(bits << (6 - bit_count)) & 0x3f]);
+    while(text.size() % 4 != 0)
+        text.push_back('=');
+    return text;
+}
+
+std::vector<std::uint8_t> DecodeBase64(const std::string& text)
+{
+    static const auto table = [] {
+        auto values = std::array<int, 256>{};
+        values.fill(-1);
+        for(std::size_t i = 0; i < 64; ++i)
+            values[static_cast<uint8_t>(symbols[i])] = static_cast<int>(i);
+        return values;
+    }();
+
+    auto bytes = std::vector<uint8_t>{};
+    bytes.reserve(text.size() / 4 * 3);
+    uint32_t bits = 0;
+    int bit_count = 0;
+    for(const auto symbol : text)
+    {
+        if(symbol == '=')
+            break;
+        const auto value = table[static_cast<uint8_t>(symbol)];
+        if(value < 0)
+            MIOPEN_THROW(miopenStatusInvalidValue, "Invalid base64 data");
+        bits = (bits << 6) | static_cast<uint32_t>(value);
+        bit_count += 6;
+        if(bit_count >= 8)
+        {
+            bit_count -= 8;
+            bytes.push_back(static_cast<uint8_t>(bits >> bit_count));
+        }
+    }
+    return bytes;
+}
+
+} // namespace miopen
@@ -36,15 +36,34 @@ namespace miopen {
 
 namespace batchnorm {
 
+ProblemKey ProblemDescription::MakeKey() const
+{
+    // Covers everything the network configs print.
+    auto key = ProblemKey{ProblemKey::Kind::Batchnorm};
+    key.Add(direction);
+    key.Add(bn_mode);
+    key.Add(xDesc);
+    key.Add(scaleBiasDesc.GetType());
+    key.Add(resultsave);
+    key.Add(resultrunning);
+    key.Add(useSaved);
+    return key;
+}
+
 NetworkConfig ProblemDescription::MakeNetworkConfig() const
 {
-    switch(direction)
-    {
-    case Direction::ForwardTraining: return MakeForwardTrainingNetworkConfig();
-    case Direction::ForwardInference: return MakeForwardInferenceNetworkConfig();
-    case Direction::Backward: return MakeBackwardNetworkConfig();
-    default: MIOPEN_THROW(miopenStatusInternalError);
-    }
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    thread_local ProblemKeyTextCache cache;
+
+    return NetworkConfig{cache.Get(MakeKey(), [&]() {
+        switch(direction)
+        {
+        case Direction::ForwardTraining: return MakeForwardTrainingNetworkConfig().ToString();
+        case Direction::ForwardInference: return MakeForwardInferenceNetworkConfig().ToString();
+        case Direction::Backward: return MakeBackwardNetworkConfig().ToString();
+        default: MIOPEN_THROW(miopenStatusInternalError);
+        }
+    })};
 }
 
 NetworkConfig ProblemDescription::MakeForwardTrainingNetworkConfig() const
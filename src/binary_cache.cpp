@@ -40,6 +40,7 @@
 #include <miopen/db.hpp>
 #include <miopen/db_path.hpp>
 #include <miopen/target_properties.hpp>
+#include <miopen/trace.hpp>
 #include <miopen/filesystem.hpp>
 #include <fstream>
 #include <iostream>
@@ -155,6 +156,7 @@ std::vector<char> LoadBinary(const TargetProperties& target,
                              const fs::path& name,
                              const std::string& args)
 {
+    MIOPEN_TRACE_SCOPE_DETAIL("binary cache", "LoadBinary", name.string());
     if(miopen::IsCacheDisabled())
         return {};
 
@@ -183,6 +185,7 @@ void SaveBinary(const std::vector<char>& hsaco,
                 const fs::path& name,
                 const std::string& args)
 {
+    MIOPEN_TRACE_SCOPE_DETAIL("binary cache", "SaveBinary", name.string());
     if(miopen::IsCacheDisabled())
         return;
 
@@ -200,6 +203,7 @@ fs::path LoadBinary(const TargetProperties& target,
                     const fs::path& name,
                     const std::string& args)
 {
+    MIOPEN_TRACE_SCOPE_DETAIL("binary cache", "LoadBinary", name.string());
     if(miopen::IsCacheDisabled())
         return {};
 
@@ -220,6 +224,7 @@ fs::path SaveBinary(const fs::path& binary_path,
                     const fs::path& name,
                     const std::string& args)
 {
+    MIOPEN_TRACE_SCOPE_DETAIL("binary cache", "SaveBinary", name.string());
     if(miopen::IsCacheDisabled())
     {
         fs::remove(binary_path);
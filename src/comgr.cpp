@@ -36,6 +36,7 @@
 #include <miopen/logger.hpp>
 #include <miopen/solver/implicitgemm_util.hpp>
 #include <miopen/stringutils.hpp>
+#include <miopen/trace.hpp>
 
 #include <amd_comgr/amd_comgr.h>
 #include <hip/hip_runtime_api.h>
@@ -600,6 +601,7 @@ void BuildOcl(const std::string& name,
               const miopen::TargetProperties& target,
               std::vector<char>& binary)
 {
+    MIOPEN_TRACE_SCOPE_DETAIL("compile", "BuildOcl", name);
     PrintVersion(); // Nice to see in the user's logs.
     try
     {
@@ -653,6 +655,7 @@ void BuildAsm(const std::string& name,
               const miopen::TargetProperties& target,
               std::vector<char>& binary)
 {
+    MIOPEN_TRACE_SCOPE_DETAIL("compile", "BuildAsm", name);
     PrintVersion();
     try
     {
@@ -946,6 +949,7 @@ void BuildHip(const std::string& name,
               const miopen::TargetProperties& target,
               std::vector<char>& binary)
 {
+    MIOPEN_TRACE_SCOPE_DETAIL("compile", "BuildHip", name);
     PrintVersion();
     try
     {
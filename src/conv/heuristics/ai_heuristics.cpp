@@ -26,8 +26,12 @@
 
 #include <miopen/conv/heuristics/ai_heuristics.hpp>
 #if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK || MIOPEN_ENABLE_AI_KERNEL_TUNING
-#include <fdeep/fdeep.hpp>
+#include <miopen/conv/heuristics/compiled_model.hpp>
 #include <miopen/filesystem.hpp>
+#include <miopen/trace.hpp>
+
+#include <numeric>
+#include <optional>
 
 namespace miopen {
 namespace ai {
@@ -126,8 +130,7 @@ public:
     Metadata metadata;
     Model(const std::string& arch)
         : metadata(Metadata(arch)),
-          model(fdeep::load_model(ModelPath(arch), true, fdeep::dev_null_logger)),
-          input_shape(fdeep::tensor_shape(metadata.num_inputs)),
+          model(CompiledModel::Load(ModelPath(arch))),
           offset(metadata.num_outputs - metadata.num_solvers)
     {
     }
@@ -157,16 +160,32 @@ public:
      */
     std::vector<float> Forward(const conv::ProblemDescription& problem) const
     {
-        std::vector<float> features       = ToFeatures(problem);
-        std::vector<fdeep::tensor> output = model.predict({fdeep::tensor(input_shape, features)});
-        std::vector<float> output_vector  = output.front().to_vector();
+        std::vector<float> features      = ToFeatures(problem);
+        std::vector<float> output_vector = model.Predict({features}).front();
         std::vector<float> res(output_vector.begin() + offset, output_vector.end());
         return res;
     }
+    /** Forward many problems through TunaNet in a single batched pass
+     *
+     * @param problems Problems
+     */
+    std::vector<std::vector<float>>
+    Forward(const std::vector<const conv::ProblemDescription*>& problems) const
+    {
+        std::vector<CompiledModel::Tensors> batch;
+        batch.reserve(problems.size());
+        for(const auto problem : problems)
+            batch.push_back({ToFeatures(*problem)});
+
+        std::vector<std::vector<float>> res;
+        res.reserve(problems.size());
+        for(const auto& output : model.PredictBatch(batch))
+            res.emplace_back(output.front().begin() + offset, output.front().end());
+        return res;
+    }
 
 protected:
-    const fdeep::model model;              // TunaNet model
-    const fdeep::tensor_shape input_shape; // Shape of input tensor required by TunaNet
+    const CompiledModel model; // TunaNet model
     const size_t offset; // Some TunaNet models output some "fluff" before they output kernel
                          // probabilites. This offset tells how many indexes of fluff need to
                          // be skipped in order to get to kernel probabilities.
@@ -503,42 +522,38 @@ std::unique_ptr<Model> GetModel(const std::string& device)
     return std::make_unique<Gfx908Model>(); // default model if GPU-specific model is not available
 }
 
-std::vector<uint64_t> PredictSolver(const conv::ProblemDescription& problem,
-                                    const ExecutionContext& ctx,
-                                    const std::string& device)
-{
-    const static std::unique_ptr<Model> model = GetModel(device);
-    if(!model || !model->IsProblemSupported(problem, ctx))
-        return {};
+namespace {
 
-    std::string est_name = ":memory:" + device;
-    auto& db             = AnyRamDb::GetCached(est_name);
-    auto db_res          = db.FindRecord(problem);
-    if(db_res)
+std::optional<std::vector<uint64_t>> FindCachedSolvers(AnyRamDb& db,
+                                                       const conv::ProblemDescription& problem)
+{
+    auto db_res = db.FindRecord(problem);
+    if(!db_res)
+        return std::nullopt;
+
+    MIOPEN_LOG_I2("Cached heuristic (TunaNet) result found");
+    std::vector<uint64_t> db_sol(db_res->size());
+    // cast returned record to solver ids
+    std::transform(db_res->begin(), db_res->end(), db_sol.begin(), [](boost::any id) {
+        return boost::any_cast<uint64_t>(id);
+    });
+    if(miopen::IsLogging(LoggingLevel::Info2))
     {
-        MIOPEN_LOG_I2("Cached heuristic (TunaNet) result found");
-        std::vector<uint64_t> db_sol(db_res->size());
-        // cast returned record to solver ids
-        std::transform(db_res->begin(), db_res->end(), db_sol.begin(), [](boost::any id) {
-            return boost::any_cast<uint64_t>(id);
-        });
-        if(miopen::IsLogging(LoggingLevel::Info2))
-        {
-            std::stringstream ss;
-            for(auto& id : db_sol)
-                ss << solver::Id{id}.ToString() << " ID:" << id << ", ";
-            MIOPEN_LOG_I2("Cached solvers: " << ss.str());
-        }
-        return db_sol;
+        std::stringstream ss;
+        for(auto& id : db_sol)
+            ss << solver::Id{id}.ToString() << " ID:" << id << ", ";
+        MIOPEN_LOG_I2("Cached solvers: " << ss.str());
     }
+    return db_sol;
+}
 
-    MIOPEN_LOG_I2("Evaluating TunaNet");
-    std::vector<float> res = model->Forward(problem); // res[i] gives the probability that the
-                                                      // i-th solver is the fastest for given
-                                                      // problem. ( The exact name of the i-th
-                                                      // solver may be obtained as follows:
-                                                      // model->metadata.solver_map.at(i) )
-
+std::vector<uint64_t> RankSolvers(const Model& model,
+                                  const std::vector<float>& res, // res[i] gives the probability
+                                                                 // that the i-th solver is the
+                                                                 // fastest for given problem.
+                                  AnyRamDb& db,
+                                  const conv::ProblemDescription& problem)
+{
     // sort solvers in order of their probabilities
     std::vector<std::pair<int, float>> sort_res(res.size());
     for(auto idx = 0; idx < res.size(); idx++)
@@ -554,10 +569,10 @@ std::vector<uint64_t> PredictSolver(const conv::ProblemDescription& problem,
     for(const auto& kinder : sort_res)
     {
         const auto id     = kinder.first; // index of solver in probability vector
-        const auto sol_id = solver::Id{model->metadata.solver_map.at(id)};
+        const auto sol_id = solver::Id{model.metadata.solver_map.at(id)};
         if(!sol_id.IsValid())
         {
-            MIOPEN_LOG_I2("Invalid solver " << model->metadata.solver_map.at(id) << " removed");
+            MIOPEN_LOG_I2("Invalid solver " << model.metadata.solver_map.at(id) << " removed");
             continue;
         }
         sol.push_back(sol_id.Value());
@@ -573,6 +588,69 @@ std::vector<uint64_t> PredictSolver(const conv::ProblemDescription& problem,
     }
     return sol;
 }
+
+std::vector<std::vector<uint64_t>>
+PredictSolvers(const std::vector<const conv::ProblemDescription*>& problems,
+               const ExecutionContext& ctx,
+               const std::string& device)
+{
+    MIOPEN_TRACE_SCOPE("ai", "PredictSolvers");
+    const static std::unique_ptr<Model> model = GetModel(device);
+    std::vector<std::vector<uint64_t>> solvers(problems.size());
+    if(!model)
+        return solvers;
+
+    std::string est_name = ":memory:" + device;
+    auto& db             = AnyRamDb::GetCached(est_name);
+
+    // only the problems without cached results go through TunaNet
+    std::vector<std::size_t> pending;
+    std::vector<const conv::ProblemDescription*> batch;
+    for(std::size_t i = 0; i < problems.size(); ++i)
+    {
+        if(!model->IsProblemSupported(*problems[i], ctx))
+            continue;
+        auto cached = FindCachedSolvers(db, *problems[i]);
+        if(cached)
+        {
+            solvers[i] = std::move(*cached);
+            continue;
+        }
+        pending.push_back(i);
+        batch.push_back(problems[i]);
+    }
+    if(batch.empty())
+        return solvers;
+
+    MIOPEN_LOG_I2("Evaluating TunaNet for " << batch.size() << " problem(s)");
+    const auto res = model->Forward(batch); // ( The exact name of the i-th solver may be
+                                            // obtained as follows:
+                                            // model->metadata.solver_map.at(i) )
+    for(std::size_t i = 0; i < pending.size(); ++i)
+        solvers[pending[i]] = RankSolvers(*model, res[i], db, *batch[i]);
+    return solvers;
+}
+
+} // namespace
+
+std::vector<uint64_t> PredictSolver(const conv::ProblemDescription& problem,
+                                    const ExecutionContext& ctx,
+                                    const std::string& device)
+{
+    return std::move(PredictSolvers({&problem}, ctx, device).front());
+}
+
+std::vector<std::vector<uint64_t>>
+PredictSolvers(const std::vector<conv::ProblemDescription>& problems,
+               const ExecutionContext& ctx,
+               const std::string& device)
+{
+    std::vector<const conv::ProblemDescription*> pointers;
+    pointers.reserve(problems.size());
+    for(const auto& problem : problems)
+        pointers.push_back(&problem);
+    return PredictSolvers(pointers, ctx, device);
+}
 } // namespace immed_mode
 #endif // MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
 
@@ -596,31 +674,29 @@ public:
     Metadata metadata;
     Model(const std::string& arch, const std::string& solver)
         : metadata(Metadata(arch, solver)),
-          encoder(fdeep::load_model(EncoderPath(arch, solver), true, fdeep::dev_null_logger)),
-          decoder(fdeep::load_model(DecoderPath(arch, solver), true, fdeep::dev_null_logger))
+          encoder(CompiledModel::Load(EncoderPath(arch, solver))),
+          decoder(CompiledModel::Load(DecoderPath(arch, solver)))
     {
     }
     virtual ~Model() = default;
     /**
-     * Encode the input features into a "context" tensor
+     * Encode the input features of many problems into "context" tensors in one pass
      *
-     * @param features Input features
-     * @param dim Dimension (must be equal to len(features) if transform
-     *            is True and sqrt(len(features)) otherwise)
-     * @param transform Reshape input features into a square matrix?
+     * @param features Input features of each problem, either a flat square matrix or a vector
+     *                 as the encoder of the solver expects
      */
-    fdeep::tensors Encode(const std::vector<float>& features, std::size_t dim, bool transform) const
+    std::vector<CompiledModel::Tensors>
+    Encode(const std::vector<std::vector<float>>& features) const
     {
-        // if transform==True, reshape input features into a matrix of `dim x dim` dimensions.
-        // otherwise, have them as a vector of size `dim`.
-        const auto tensor_shape_depth = transform ? dim : 1;
-        fdeep::tensor input_tensor =
-            fdeep::tensor(fdeep::tensor_shape(dim, tensor_shape_depth), features);
-
-        return encoder.predict({input_tensor});
+        std::vector<CompiledModel::Tensors> batch;
+        batch.reserve(features.size());
+        for(const auto& item : features)
+            batch.push_back({item});
+        return encoder.PredictBatch(batch);
     }
     /**
-     * Decode the next token based on the previous token and the encoded context.
+     * Decode the next token of many problems based on their previous tokens and encoded
+     * contexts.
      *
      * Decoder predicts the next token based on the previous token and the context predicted
      * by the Encoder. A token is a representation of a kernel parameter, i.e., each unique
@@ -628,22 +704,26 @@ public:
      * which signals the end of the decoding process (i.e., all kernel parameters have been
      * obtained).
      *
-     * @param prev_token Previous token
-     * @param context Context vector obtained from encoder
+     * @param prev_tokens Previous token of each problem
+     * @param contexts Context vectors of each problem obtained from encoder or the last decoding
      */
-    fdeep::tensors Decode(const float prev_token, const fdeep::tensors& context) const
+    std::vector<CompiledModel::Tensors>
+    Decode(const std::vector<float>& prev_tokens,
+           const std::vector<const CompiledModel::Tensors*>& contexts) const
     {
-        return decoder.predict(
-            {{fdeep::tensor(fdeep::tensor_shape(1), std::vector<float>(1, prev_token)),
-              context[0],
-              context[1],
-              context[2],
-              context[3]}});
+        std::vector<CompiledModel::Tensors> batch;
+        batch.reserve(prev_tokens.size());
+        for(std::size_t i = 0; i < prev_tokens.size(); ++i)
+        {
+            const auto& context = *contexts[i];
+            batch.push_back({{prev_tokens[i]}, context[0], context[1], context[2], context[3]});
+        }
+        return decoder.PredictBatch(batch);
     }
 
 private:
-    const fdeep::model encoder;
-    const fdeep::model decoder;
+    const CompiledModel encoder;
+    const CompiledModel decoder;
     static std::string EncoderPath(const std::string& arch, const std::string& solver)
     {
         const auto path = GetSystemDbPath() / (arch + "_" + solver + "_encoder.ktn.model");
@@ -706,17 +786,23 @@ bool ModelSetParams(const std::string& arch,
                     bool transform_features,
                     std::function<bool(std::size_t, std::string)> validator)
 {
-    auto model = GetModel(arch, solver);
+    const std::vector<std::vector<float>> batch = {features};
+    const std::vector<std::function<bool(std::size_t, std::string)>> validators = {
+        std::move(validator)};
+    return ModelSetParams(arch, solver, direction, batch, transform_features, validators).front();
+}
 
-    // get context
-    int dim = 0;
-    if(transform_features)
-        dim = std::sqrt(features.size());
-    else
-        dim = features.size();
-    auto start             = std::chrono::high_resolution_clock::now();
-    fdeep::tensors context = model->Encode(features, dim, transform_features);
-    float decoder_input    = 0.0;
+std::vector<bool>
+ModelSetParams(const std::string& arch,
+               const std::string& solver,
+               miopen::conv::Direction direction,
+               const std::vector<std::vector<float>>& features,
+               bool transform_features,
+               const std::vector<std::function<bool(std::size_t, std::string)>>& validators)
+{
+    MIOPEN_TRACE_SCOPE_DETAIL("ai", "ModelSetParams", solver);
+    auto model = GetModel(arch, solver);
+    std::vector<bool> results(features.size(), false);
 
     // set direction string
     std::string dir;
@@ -725,57 +811,83 @@ bool ModelSetParams(const std::string& arch,
     case miopen::conv::Direction::Forward: dir = "fwd"; break;
     case miopen::conv::Direction::BackwardData: dir = "bwd"; break;
     case miopen::conv::Direction::BackwardWeights: dir = "wrw"; break;
-    default: return false;
+    default: return results;
     }
 
-    // run decoder to set kernel parameters
-    for(size_t i = 0, num_tuning_params = 1; i < num_tuning_params; ++i)
+    // get contexts, the features are flat either way and the encoder checks their size
+    std::ignore   = transform_features;
+    auto start    = std::chrono::high_resolution_clock::now();
+    auto contexts = model->Encode(features);
+
+    // run decoder to set kernel parameters, one batch per parameter position with the problems
+    // that still have parameters to set
+    std::vector<float> decoder_inputs(features.size(), 0.0f);
+    std::vector<std::size_t> num_tuning_params(features.size(), 1);
+    std::vector<std::size_t> active(features.size());
+    std::iota(active.begin(), active.end(), 0);
+    for(size_t i = 0; !active.empty(); ++i)
     {
-
-        if(i == 0 && (model->metadata.predict_type == 0u))
-            num_tuning_params = model->metadata.num_tuning_params[dir];
-
-        fdeep::tensors decoder_output = model->Decode(decoder_input, context);
-        auto token_scores             = decoder_output[0].to_vector(); // token_scores[k] gives the
-                                                                       // score of the k-th token
-        // order tokens according to their scores
-        std::priority_queue<std::pair<float, int>> pq;
-        for(int j = 0; j < token_scores.size(); j++)
-            pq.push(std::make_pair(token_scores[j], j)); // sort by value at index
-
-        // find a token whose value is a valid kernel parameter for the i-th position
-        int output_token_index = -1;
-        while(!pq.empty())
+        std::vector<float> batch_inputs;
+        std::vector<const CompiledModel::Tensors*> batch_contexts;
+        for(const auto k : active)
         {
-            // get the token with the highest score and look up its value
-            int token         = pq.top().second;
-            std::string value = model->metadata.tuning_decodings[std::to_string(token)];
-            pq.pop();
+            if(i == 0 && (model->metadata.predict_type == 0u))
+                num_tuning_params[k] = model->metadata.num_tuning_params[dir];
+            batch_inputs.push_back(decoder_inputs[k]);
+            batch_contexts.push_back(&contexts[k]);
+        }
+        auto decoder_outputs = model->Decode(batch_inputs, batch_contexts);
 
-            if(value == "-1") // if token-value is "-1", then decoding has finished
-            {
-                auto stop     = std::chrono::high_resolution_clock::now();
-                auto duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
-                MIOPEN_LOG_I2("Model ran for " << duration.count() << " micro-seconds");
-                return false;
-            }
-            if(validator(i, value)) // if token-value is a valid kernel parameter, it's set
+        std::vector<std::size_t> next_active;
+        for(std::size_t n = 0; n < active.size(); ++n)
+        {
+            const auto k         = active[n];
+            auto& decoder_output = decoder_outputs[n];
+            // token_scores[j] gives the score of the j-th token
+            const auto& token_scores = decoder_output[0];
+            // order tokens according to their scores
+            std::priority_queue<std::pair<float, int>> pq;
+            for(int j = 0; j < token_scores.size(); j++)
+                pq.push(std::make_pair(token_scores[j], j)); // sort by value at index
+
+            // find a token whose value is a valid kernel parameter for the i-th position
+            int output_token_index = -1;
+            while(!pq.empty())
             {
-                output_token_index =
-                    token; // index with largest value that is valid = predicted index
-                if(i == 0 && model->metadata.predict_type != 0u)
-                    num_tuning_params = model->metadata.num_tuning_params[value];
-                break;
+                // get the token with the highest score and look up its value
+                int token         = pq.top().second;
+                std::string value = model->metadata.tuning_decodings[std::to_string(token)];
+                pq.pop();
+
+                if(value == "-1") // if token-value is "-1", then decoding has finished
+                    break;
+                if(validators[k](i, value)) // if token-value is a valid kernel parameter, it's set
+                {
+                    output_token_index =
+                        token; // index with largest value that is valid = predicted index
+                    if(i == 0 && model->metadata.predict_type != 0u)
+                        num_tuning_params[k] = model->metadata.num_tuning_params[value];
+                    break;
+                }
             }
+            if(output_token_index < 0) // decoding has finished or no token is valid
+                continue;
+
+            decoder_inputs[k] = float(output_token_index);
+            contexts[k]       = {decoder_output.begin() + 1, decoder_output.end()};
+            if(i + 1 < num_tuning_params[k])
+                next_active.push_back(k);
+            else
+                results[k] = true;
         }
-        decoder_input = float(output_token_index);
-        context       = {decoder_output.begin() + 1, decoder_output.end()};
+        active = std::move(next_active);
     }
 
     auto stop     = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start);
-    MIOPEN_LOG_I2("Model ran for " << duration.count() << " micro-seconds");
-    return true;
+    MIOPEN_LOG_I2("Model ran for " << duration.count() << " micro-seconds for " << features.size()
+                                   << " problem(s)");
+    return results;
 }
 
 } // namespace tuning
@@ -0,0 +1,950 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/conv/heuristics/compiled_model.hpp>
+
+#include <miopen/base64.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <utility>
+
+namespace miopen {
+namespace ai {
+
+namespace {
+
+constexpr std::array<char, 8> binary_magic = {'M', 'I', 'O', 'P', 'E', 'N', 'A', 'I'};
+constexpr auto lanes                       = CompiledModel::lanes;
+
+std::size_t Blocks(std::size_t size) { return (size + lanes - 1) / lanes; }
+
+/// Rows of the batch a layer multiplies at once: each weights vector is loaded once for all of
+/// them.
+constexpr std::size_t row_tile = 4;
+
+#if defined(__GNUC__) || defined(__clang__)
+static_assert(lanes * sizeof(float) == 32, "The vector type has to match the packing");
+using Vector = float __attribute__((vector_size(32)));
+
+// Loading by reference keeps the vector out of the calling convention when AVX is not enabled.
+void LoadVector(Vector& v, const float* ptr) { std::memcpy(&v, ptr, sizeof(v)); }
+
+void StoreVector(const Vector& v, float* ptr, std::size_t count)
+{
+    std::memcpy(ptr, &v, count * sizeof(float));
+}
+
+template <std::size_t Rows>
+void MatMulTile(const float* const* x,
+                float* const* y,
+                std::size_t n_in,
+                const float* w,
+                const float* bias,
+                std::size_t col,
+                std::size_t count)
+{
+    Vector acc[Rows];
+    auto row = Vector{};
+    for(std::size_t r = 0; r < Rows; ++r)
+    {
+        acc[r] = Vector{};
+        if(bias != nullptr)
+            LoadVector(acc[r], bias + col);
+    }
+    for(std::size_t i = 0; i < n_in; ++i)
+    {
+        LoadVector(row, w + i * lanes);
+        for(std::size_t r = 0; r < Rows; ++r)
+            acc[r] += x[r][i] * row;
+    }
+    for(std::size_t r = 0; r < Rows; ++r)
+        StoreVector(acc[r], y[r] + col, count);
+}
+
+/// A single row has no other rows to hide the latency of the multiply-adds behind, two
+/// accumulators break their dependency chain instead.
+void MatMulRow(const float* x,
+               float* y,
+               std::size_t n_in,
+               const float* w,
+               const float* bias,
+               std::size_t col,
+               std::size_t count)
+{
+    auto acc0 = Vector{};
+    auto acc1 = Vector{};
+    auto row0 = Vector{};
+    auto row1 = Vector{};
+    if(bias != nullptr)
+        LoadVector(acc0, bias + col);
+    std::size_t i = 0;
+    for(; i + 1 < n_in; i += 2)
+    {
+        LoadVector(row0, w + i * lanes);
+        LoadVector(row1, w + (i + 1) * lanes);
+        acc0 += x[i] * row0;
+        acc1 += x[i + 1] * row1;
+    }
+    if(i < n_in)
+    {
+        LoadVector(row0, w + i * lanes);
+        acc0 += x[i] * row0;
+    }
+    acc0 += acc1;
+    StoreVector(acc0, y + col, count);
+}
+
+/// y[r] = x[r] * w + bias for every row, where w is packed in column blocks, see
+/// ModelCompiler::AddMatrix().
+void MatMul(const float* const* x,
+            float* const* y,
+            std::size_t rows,
+            std::size_t n_in,
+            const float* w,
+            const float* bias,
+            std::size_t n_out)
+{
+    for(std::size_t col = 0; col < n_out; col += lanes, w += n_in * lanes)
+    {
+        const auto count = std::min(lanes, n_out - col);
+        auto r           = std::size_t{0};
+        for(; r + row_tile <= rows; r += row_tile)
+            MatMulTile<row_tile>(x + r, y + r, n_in, w, bias, col, count);
+        for(; r < rows; ++r)
+            MatMulRow(x[r], y[r], n_in, w, bias, col, count);
+    }
+}
+#else
+void MatMul(const float* const* x,
+            float* const* y,
+            std::size_t rows,
+            std::size_t n_in,
+            const float* w,
+            const float* bias,
+            std::size_t n_out)
+{
+    for(std::size_t col = 0; col < n_out; col += lanes, w += n_in * lanes)
+    {
+        for(std::size_t r = 0; r < rows; ++r)
+        {
+            float acc[lanes] = {};
+            if(bias != nullptr)
+                std::copy(bias + col, bias + col + lanes, acc);
+            for(std::size_t i = 0; i < n_in; ++i)
+                for(std::size_t l = 0; l < lanes; ++l)
+                    acc[l] += x[r][i] * w[i * lanes + l];
+            std::copy(acc, acc + std::min(lanes, n_out - col), y[r] + col);
+        }
+    }
+}
+#endif
+
+float Activate(CompiledModel::Activation activation, float x)
+{
+    switch(activation)
+    {
+    case CompiledModel::Activation::Linear: return x;
+    case CompiledModel::Activation::Relu: return std::max(x, 0.0f);
+    case CompiledModel::Activation::Sigmoid: return 1.0f / (1.0f + std::exp(-x));
+    case CompiledModel::Activation::HardSigmoid: return std::clamp(0.2f * x + 0.5f, 0.0f, 1.0f);
+    case CompiledModel::Activation::Tanh: return std::tanh(x);
+    }
+    return x;
+}
+
+void Activate(CompiledModel::Activation activation, float* values, std::size_t size)
+{
+    if(activation == CompiledModel::Activation::Linear)
+        return;
+    for(std::size_t i = 0; i < size; ++i)
+        values[i] = Activate(activation, values[i]);
+}
+
+CompiledModel::Activation ParseActivation(const std::string& name)
+{
+    if(name == "linear")
+        return CompiledModel::Activation::Linear;
+    if(name == "relu")
+        return CompiledModel::Activation::Relu;
+    if(name == "sigmoid")
+        return CompiledModel::Activation::Sigmoid;
+    if(name == "hard_sigmoid")
+        return CompiledModel::Activation::HardSigmoid;
+    if(name == "tanh")
+        return CompiledModel::Activation::Tanh;
+    MIOPEN_THROW(miopenStatusInternalError, "AI model: unsupported activation " + name);
+}
+
+/// frugally-deep stores float arrays as a list of separately encoded base64 chunks.
+std::vector<float> DecodeFloats(const nlohmann::json& chunks)
+{
+    auto bytes = std::vector<uint8_t>{};
+    for(const auto& chunk : chunks)
+    {
+        const auto decoded = DecodeBase64(chunk.get<std::string>());
+        bytes.insert(bytes.end(), decoded.begin(), decoded.end());
+    }
+    if(bytes.size() % sizeof(float) != 0)
+        MIOPEN_THROW(miopenStatusInternalError, "AI model: invalid float array");
+    auto values = std::vector<float>(bytes.size() / sizeof(float));
+    std::memcpy(values.data(), bytes.data(), bytes.size());
+    return values;
+}
+
+CompiledModel::Tensors DecodeTensors(const nlohmann::json& tensors)
+{
+    auto result = CompiledModel::Tensors{};
+    for(const auto& tensor : tensors)
+        result.push_back(DecodeFloats(tensor["values"]));
+    return result;
+}
+
+template <class T>
+void Write(std::ostream& stream, const T& value)
+{
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <class T>
+void Write(std::ostream& stream, const std::vector<T>& values)
+{
+    Write(stream, static_cast<uint64_t>(values.size()));
+    stream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+template <class T>
+void Read(std::istream& stream, T& value)
+{
+    if(!stream.read(reinterpret_cast<char*>(&value), sizeof(T)))
+        MIOPEN_THROW(miopenStatusInternalError, "AI model: truncated binary");
+}
+
+template <class T>
+void Read(std::istream& stream, std::vector<T>& values, uint64_t max_size)
+{
+    auto size = uint64_t{};
+    Read(stream, size);
+    if(size > max_size)
+        MIOPEN_THROW(miopenStatusInternalError, "AI model: invalid binary");
+    values.resize(size);
+    if(!stream.read(reinterpret_cast<char*>(values.data()), size * sizeof(T)))
+        MIOPEN_THROW(miopenStatusInternalError, "AI model: truncated binary");
+}
+
+} // namespace
+
+/// Walks the layers of the Keras functional model in dependency order and lays out all of their
+/// tensors one after another in the arena.
+class ModelCompiler
+{
+public:
+    explicit ModelCompiler(const nlohmann::json& json_) : json(json_) {}
+
+    CompiledModel Compile()
+    {
+        const auto& config = json.at("architecture").at("config");
+        auto pending       = std::vector<const nlohmann::json*>{};
+        for(const auto& layer : config.at("layers"))
+            pending.push_back(&layer);
+
+        while(!pending.empty())
+        {
+            const auto ready = std::find_if(pending.begin(), pending.end(), [&](auto layer) {
+                const auto inbound = Inbound(*layer);
+                return std::all_of(inbound.begin(), inbound.end(), [&](const auto& input) {
+                    return tensors.count(input.first) != 0;
+                });
+            });
+            if(ready == pending.end())
+                MIOPEN_THROW(miopenStatusInternalError, "AI model: unresolved layer inputs");
+            AddLayer(**ready);
+            pending.erase(ready);
+        }
+
+        for(const auto& input : config.at("input_layers"))
+        {
+            const auto& tensor = Tensor(input);
+            model.inputs.push_back({tensor.offset, Size(tensor.shape)});
+            model.input_shapes.push_back(tensor.shape);
+        }
+        for(const auto& output : config.at("output_layers"))
+        {
+            const auto& tensor = Tensor(output);
+            model.outputs.push_back({tensor.offset, Size(tensor.shape)});
+        }
+        if(json.contains("tests"))
+        {
+            for(const auto& test : json["tests"])
+                model.tests.push_back({DecodeTensors(test.at("inputs")),
+                                       DecodeTensors(test.at("outputs"))});
+        }
+
+        model.arena_size = arena_size;
+        model.Validate();
+        return std::move(model);
+    }
+
+private:
+    struct TensorInfo
+    {
+        uint32_t offset = 0;
+        std::vector<std::size_t> shape;
+    };
+
+    const nlohmann::json& json;
+    CompiledModel model;
+    std::size_t arena_size = 0;
+    std::map<std::string, std::vector<TensorInfo>> tensors;
+
+    static std::size_t Size(const std::vector<std::size_t>& shape)
+    {
+        auto size = std::size_t{1};
+        for(const auto dim : shape)
+            size *= dim;
+        return size;
+    }
+
+    static uint32_t ToOffset(std::size_t value)
+    {
+        if(value >= CompiledModel::Op::none)
+            MIOPEN_THROW(miopenStatusInternalError, "AI model: too large");
+        return static_cast<uint32_t>(value);
+    }
+
+    /// The names of the input layers and their output indices.
+    static std::vector<std::pair<std::string, std::size_t>> Inbound(const nlohmann::json& layer)
+    {
+        auto inbound     = std::vector<std::pair<std::string, std::size_t>>{};
+        const auto nodes = layer.at("inbound_nodes");
+        if(nodes.empty())
+            return inbound;
+        if(nodes.size() != 1)
+            MIOPEN_THROW(miopenStatusInternalError, "AI model: shared layers are not supported");
+        for(const auto& input : nodes[0])
+            inbound.emplace_back(input.at(0).get<std::string>(), input.at(2).get<std::size_t>());
+        return inbound;
+    }
+
+    const TensorInfo& Tensor(const nlohmann::json& reference) const
+    {
+        const auto& outputs = tensors.at(reference.at(0).get<std::string>());
+        const auto index    = reference.at(2).get<std::size_t>();
+        if(index >= outputs.size())
+            MIOPEN_THROW(miopenStatusInternalError, "AI model: invalid tensor reference");
+        return outputs[index];
+    }
+
+    TensorInfo Allocate(std::vector<std::size_t> shape)
+    {
+        auto tensor = TensorInfo{ToOffset(arena_size), std::move(shape)};
+        arena_size += Size(tensor.shape);
+        return tensor;
+    }
+
+    uint32_t AllocateScratch(std::size_t size)
+    {
+        const auto offset = ToOffset(arena_size);
+        arena_size += size;
+        return offset;
+    }
+
+    std::vector<float> Params(const std::string& layer, const std::string& name) const
+    {
+        return DecodeFloats(json.at("trainable_params").at(layer).at(name));
+    }
+
+    uint32_t AddParams(const std::vector<float>& values)
+    {
+        const auto offset = ToOffset(model.params.size());
+        model.params.insert(model.params.end(), values.begin(), values.end());
+        return offset;
+    }
+
+    /// Packs the row-major n_in x n_out matrix into blocks of `lanes` columns, each stored
+    /// row by row, zero-padded to a whole block.
+    uint32_t AddMatrix(const std::vector<const float*>& rows, std::size_t n_out)
+    {
+        const auto offset = ToOffset(model.params.size());
+        for(std::size_t col = 0; col < n_out; col += lanes)
+        {
+            for(const auto row : rows)
+            {
+                for(std::size_t l = 0; l < lanes; ++l)
+                    model.params.push_back(col + l < n_out ? row[col + l] : 0.0f);
+            }
+        }
+        return offset;
+    }
+
+    uint32_t AddBias(std::vector<float> bias)
+    {
+        bias.resize(Blocks(bias.size()) * lanes, 0.0f);
+        return AddParams(bias);
+    }
+
+    static void CheckSize(const std::vector<float>& values, std::size_t size)
+    {
+        if(values.size() != size)
+            MIOPEN_THROW(miopenStatusInternalError, "AI model: unexpected weights size");
+    }
+
+    void AddLayer(const nlohmann::json& layer)
+    {
+        const auto type    = layer.at("class_name").get<std::string>();
+        const auto name    = layer.at("config").at("name").get<std::string>();
+        const auto& config = layer.at("config");
+        auto inputs        = std::vector<TensorInfo>{};
+        for(const auto& input : Inbound(layer))
+            inputs.push_back(tensors.at(input.first).at(input.second));
+
+        if(type == "InputLayer")
+        {
+            auto shape = config.at("batch_input_shape").get<std::vector<nlohmann::json>>();
+            auto dims  = std::vector<std::size_t>{};
+            for(std::size_t i = 1; i < shape.size(); ++i)
+                dims.push_back(shape[i].get<std::size_t>());
+            tensors[name] = {Allocate(dims)};
+        }
+        else if(type == "Dense")
+            AddDense(name, config, inputs.at(0));
+        else if(type == "ReLU")
+        {
+            if(!config.value("max_value", nlohmann::json{}).is_null() ||
+               config.value("negative_slope", 0.0) != 0.0 || config.value("threshold", 0.0) != 0.0)
+                MIOPEN_THROW(miopenStatusInternalError, "AI model: unsupported ReLU parameters");
+            AddElementwise(name, CompiledModel::OpKind::Relu, inputs);
+        }
+        else if(type == "Add")
+            AddElementwise(name, CompiledModel::OpKind::Add, inputs);
+        else if(type == "Embedding")
+            AddEmbedding(name, config, inputs.at(0));
+        else if(type == "LSTM")
+            AddLstm(name, config, inputs);
+        else
+            MIOPEN_THROW(miopenStatusInternalError, "AI model: unsupported layer " + type);
+    }
+
+    void AddDense(const std::string& name, const nlohmann::json& config, const TensorInfo& input)
+    {
+        const auto in_size = input.shape.back();
+        const auto units   = config.at("units").get<std::size_t>();
+        const auto weights = Params(name, "weights");
+        auto shape         = input.shape;
+        shape.back()       = units;
+        const auto output  = Allocate(shape);
+        CheckSize(weights, in_size * units);
+
+        auto rows = std::vector<const float*>{};
+        for(std::size_t i = 0; i < in_size; ++i)
+            rows.push_back(weights.data() + i * units);
+
+        auto op       = CompiledModel::Op{};
+        op.kind       = CompiledModel::OpKind::Dense;
+        op.activation = ParseActivation(config.at("activation").get<std::string>());
+        op.steps      = ToOffset(Size(input.shape) / in_size);
+        op.in_size    = ToOffset(in_size);
+        op.out_size   = ToOffset(units);
+        op.in[0]      = input.offset;
+        op.out[0]     = output.offset;
+        op.weights    = AddMatrix(rows, units);
+        if(config.at("use_bias").get<bool>())
+        {
+            const auto bias = Params(name, "bias");
+            CheckSize(bias, units);
+            op.bias = AddBias(bias);
+        }
+        model.ops.push_back(op);
+        tensors[name] = {output};
+    }
+
+    void AddElementwise(const std::string& name,
+                        CompiledModel::OpKind kind,
+                        const std::vector<TensorInfo>& inputs)
+    {
+        const auto size = Size(inputs.at(0).shape);
+        if(std::any_of(inputs.begin(), inputs.end(), [&](auto& in) {
+               return Size(in.shape) != size;
+           }))
+            MIOPEN_THROW(miopenStatusInternalError, "AI model: mismatched input shapes");
+        const auto output = Allocate(inputs[0].shape);
+
+        // Each op takes up to 3 inputs, the next ones are added to the output by further ops.
+        for(std::size_t first = 0; first < inputs.size(); first += 2)
+        {
+            auto op     = CompiledModel::Op{};
+            op.kind     = kind;
+            op.out_size = ToOffset(size);
+            op.out[0]   = output.offset;
+            auto slot   = std::size_t{0};
+            if(first != 0)
+                op.in[slot++] = output.offset;
+            for(std::size_t i = first; i < inputs.size() && slot < 3; ++i)
+                op.in[slot++] = inputs[i].offset;
+            model.ops.push_back(op);
+            if(first == 0)
+                ++first;
+        }
+        tensors[name] = {output};
+    }
+
+    void
+    AddEmbedding(const std::string& name, const nlohmann::json& config, const TensorInfo& input)
+    {
+        const auto vocabulary = config.at("input_dim").get<std::size_t>();
+        const auto dim        = config.at("output_dim").get<std::size_t>();
+        const auto weights    = Params(name, "weights");
+        CheckSize(weights, vocabulary * dim);
+        auto shape = input.shape;
+        shape.push_back(dim);
+        const auto output = Allocate(shape);
+
+        auto op     = CompiledModel::Op{};
+        op.kind     = CompiledModel::OpKind::Embedding;
+        op.steps    = ToOffset(Size(input.shape));
+        op.in_size  = ToOffset(vocabulary);
+        op.out_size = ToOffset(dim);
+        op.in[0]    = input.offset;
+        op.out[0]   = output.offset;
+        op.weights  = AddParams(weights);
+        model.ops.push_back(op);
+        tensors[name] = {output};
+    }
+
+    void AddLstm(const std::string& name,
+                 const nlohmann::json& config,
+                 const std::vector<TensorInfo>& inputs)
+    {
+        if(config.value("go_backwards", false) || config.value("stateful", false) ||
+           config.value("time_major", false))
+            MIOPEN_THROW(miopenStatusInternalError, "AI model: unsupported LSTM parameters");
+        const auto& input = inputs.at(0);
+        if(input.shape.size() != 2 || (inputs.size() != 1 && inputs.size() != 3))
+            MIOPEN_THROW(miopenStatusInternalError, "AI model: unsupported LSTM inputs");
+
+        const auto steps             = input.shape[0];
+        const auto in_size           = input.shape[1];
+        const auto units             = config.at("units").get<std::size_t>();
+        const auto weights           = Params(name, "weights");
+        const auto recurrent_weights = Params(name, "recurrent_weights");
+        CheckSize(weights, in_size * 4 * units);
+        CheckSize(recurrent_weights, units * 4 * units);
+
+        // The input and the recurrent products are one: [x, h] * [W; U].
+        auto rows = std::vector<const float*>{};
+        for(std::size_t i = 0; i < in_size; ++i)
+            rows.push_back(weights.data() + i * 4 * units);
+        for(std::size_t i = 0; i < units; ++i)
+            rows.push_back(recurrent_weights.data() + i * 4 * units);
+
+        const auto sequences = config.at("return_sequences").get<bool>();
+        const auto h         = Allocate({units});
+        const auto c         = Allocate({units});
+        const auto sequence  = sequences ? Allocate({steps, units}) : h;
+
+        auto op                 = CompiledModel::Op{};
+        op.kind                 = CompiledModel::OpKind::Lstm;
+        op.activation           = ParseActivation(config.at("activation").get<std::string>());
+        op.recurrent_activation =
+            ParseActivation(config.at("recurrent_activation").get<std::string>());
+        op.steps                = ToOffset(steps);
+        op.in_size              = ToOffset(in_size);
+        op.out_size             = ToOffset(units);
+        op.in[0]                = input.offset;
+        if(inputs.size() == 3)
+        {
+            op.in[1] = inputs[1].offset;
+            op.in[2] = inputs[2].offset;
+        }
+        op.out[0]  = sequences ? sequence.offset : CompiledModel::Op::none;
+        op.out[1]  = h.offset;
+        op.out[2]  = c.offset;
+        op.weights = AddMatrix(rows, 4 * units);
+        op.scratch = AllocateScratch(in_size + units + 4 * units);
+        if(config.at("use_bias").get<bool>())
+        {
+            const auto bias = Params(name, "bias");
+            CheckSize(bias, 4 * units);
+            op.bias = AddBias(bias);
+        }
+        model.ops.push_back(op);
+
+        if(config.value("return_state", false))
+            tensors[name] = {sequence, h, c};
+        else
+            tensors[name] = {sequence};
+    }
+};
+
+void CompiledModel::Validate() const
+{
+    const auto check = [](bool valid) {
+        if(!valid)
+            MIOPEN_THROW(miopenStatusInternalError, "AI model: invalid operation");
+    };
+    const auto in_arena = [&](uint32_t offset, std::size_t size) {
+        check(offset != Op::none && offset + size <= arena_size);
+    };
+    const auto in_params = [&](uint32_t offset, std::size_t size) {
+        check(offset != Op::none && offset + size <= params.size());
+    };
+
+    for(const auto& op : ops)
+    {
+        const std::size_t steps = op.steps;
+        switch(op.kind)
+        {
+        case OpKind::Dense:
+            in_arena(op.in[0], steps * op.in_size);
+            in_arena(op.out[0], steps * op.out_size);
+            in_params(op.weights, Blocks(op.out_size) * lanes * op.in_size);
+            if(op.bias != Op::none)
+                in_params(op.bias, Blocks(op.out_size) * lanes);
+            break;
+        case OpKind::Relu:
+        case OpKind::Add:
+            in_arena(op.out[0], op.out_size);
+            for(const auto in : op.in)
+            {
+                if(in != Op::none)
+                    in_arena(in, op.out_size);
+            }
+            break;
+        case OpKind::Embedding:
+            in_arena(op.in[0], steps);
+            in_arena(op.out[0], steps * op.out_size);
+            in_params(op.weights, std::size_t{op.in_size} * op.out_size);
+            break;
+        case OpKind::Lstm: {
+            const std::size_t units = op.out_size;
+            in_arena(op.in[0], steps * op.in_size);
+            for(const auto in : {op.in[1], op.in[2]})
+            {
+                if(in != Op::none)
+                    in_arena(in, units);
+            }
+            if(op.out[0] != Op::none)
+                in_arena(op.out[0], steps * units);
+            in_arena(op.out[1], units);
+            in_arena(op.out[2], units);
+            in_arena(op.scratch, op.in_size + 5 * units);
+            in_params(op.weights, Blocks(4 * units) * lanes * (op.in_size + units));
+            if(op.bias != Op::none)
+                in_params(op.bias, Blocks(4 * units) * lanes);
+            break;
+        }
+        default: check(false);
+        }
+    }
+    for(const auto& buffer : inputs)
+        check(buffer.offset + buffer.size <= arena_size);
+    for(const auto& buffer : outputs)
+        check(buffer.offset + buffer.size <= arena_size);
+    check(input_shapes.size() == inputs.size());
+}
+
+CompiledModel CompiledModel::FromJson(const nlohmann::json& json)
+{
+    return ModelCompiler{json}.Compile();
+}
+
+CompiledModel CompiledModel::FromJsonFile(const fs::path& path)
+{
+    auto file = std::ifstream{path};
+    if(!file)
+        MIOPEN_THROW(miopenStatusInternalError, "Unable to load AI model file: " + path.string());
+    return FromJson(nlohmann::json::parse(file));
+}
+
+void CompiledModel::SaveBinary(const fs::path& path) const
+{
+    auto file = std::ofstream{path, std::ios::binary};
+    file.write(binary_magic.data(), binary_magic.size());
+    Write(file, version);
+    Write(file, static_cast<uint32_t>(lanes));
+    Write(file, static_cast<uint64_t>(arena_size));
+    Write(file, ops);
+    Write(file, params);
+    Write(file, inputs);
+    Write(file, outputs);
+    for(const auto& shape : input_shapes)
+        Write(file, std::vector<uint64_t>{shape.begin(), shape.end()});
+    if(!file)
+        MIOPEN_THROW(miopenStatusInternalError, "Unable to write AI model file: " + path.string());
+}
+
+CompiledModel CompiledModel::FromBinaryFile(const fs::path& path)
+{
+    auto file = std::ifstream{path, std::ios::binary};
+    if(!file)
+        MIOPEN_THROW(miopenStatusInternalError, "Unable to load AI model file: " + path.string());
+    const auto file_size = static_cast<uint64_t>(fs::file_size(path));
+
+    auto magic        = decltype(binary_magic){};
+    auto file_version = uint32_t{};
+    auto file_lanes   = uint32_t{};
+    auto arena_size   = uint64_t{};
+    file.read(magic.data(), magic.size());
+    Read(file, file_version);
+    Read(file, file_lanes);
+    if(magic != binary_magic || file_version != version || file_lanes != lanes)
+        MIOPEN_THROW(miopenStatusInternalError, "AI model: binary of another version");
+    Read(file, arena_size);
+
+    auto model       = CompiledModel{};
+    model.arena_size = arena_size;
+    Read(file, model.ops, file_size);
+    Read(file, model.params, file_size);
+    Read(file, model.inputs, file_size);
+    Read(file, model.outputs, file_size);
+    for(std::size_t i = 0; i < model.inputs.size(); ++i)
+    {
+        auto shape = std::vector<uint64_t>{};
+        Read(file, shape, file_size);
+        model.input_shapes.emplace_back(shape.begin(), shape.end());
+    }
+    model.Validate();
+    return model;
+}
+
+CompiledModel CompiledModel::Load(const fs::path& path)
+{
+    const auto binary = fs::path{path.string() + ".bin"};
+    if(fs::exists(binary))
+    {
+        try
+        {
+            return FromBinaryFile(binary);
+        }
+        catch(const Exception& ex)
+        {
+            MIOPEN_LOG_W("Unable to use " << binary << ", compiling " << path << ": " << ex.what());
+        }
+    }
+    return FromJsonFile(path);
+}
+
+CompiledModel::Tensors CompiledModel::Predict(const Tensors& values) const
+{
+    return std::move(PredictBatch({values}).front());
+}
+
+std::vector<CompiledModel::Tensors>
+CompiledModel::PredictBatch(const std::vector<Tensors>& batch) const
+{
+    // Each item has its own copy of the arena, the ops run on all of them at once.
+    const auto items = batch.size();
+    auto arena       = std::vector<float>(items * arena_size, 0.0f);
+    for(std::size_t b = 0; b < items; ++b)
+    {
+        if(batch[b].size() != inputs.size())
+            MIOPEN_THROW(miopenStatusInternalError, "AI model: unexpected number of inputs");
+        for(std::size_t i = 0; i < inputs.size(); ++i)
+        {
+            if(batch[b][i].size() != inputs[i].size)
+                MIOPEN_THROW(miopenStatusInternalError, "AI model: unexpected input size");
+            std::copy(batch[b][i].begin(),
+                      batch[b][i].end(),
+                      arena.begin() + b * arena_size + inputs[i].offset);
+        }
+    }
+
+    const auto at = [&](std::size_t b, uint32_t offset) {
+        return arena.data() + b * arena_size + offset;
+    };
+    const auto params_at = [&](uint32_t offset) {
+        return offset == Op::none ? nullptr : params.data() + offset;
+    };
+    auto x_rows = std::vector<const float*>{};
+    auto y_rows = std::vector<float*>{};
+
+    for(const auto& op : ops)
+    {
+        switch(op.kind)
+        {
+        case OpKind::Dense:
+            x_rows.clear();
+            y_rows.clear();
+            for(std::size_t b = 0; b < items; ++b)
+            {
+                for(std::size_t s = 0; s < op.steps; ++s)
+                {
+                    x_rows.push_back(at(b, op.in[0]) + s * op.in_size);
+                    y_rows.push_back(at(b, op.out[0]) + s * op.out_size);
+                }
+            }
+            MatMul(x_rows.data(),
+                   y_rows.data(),
+                   x_rows.size(),
+                   op.in_size,
+                   params_at(op.weights),
+                   params_at(op.bias),
+                   op.out_size);
+            for(const auto y : y_rows)
+                Activate(op.activation, y, op.out_size);
+            break;
+        case OpKind::Relu:
+            for(std::size_t b = 0; b < items; ++b)
+            {
+                const auto x = at(b, op.in[0]);
+                const auto y = at(b, op.out[0]);
+                for(std::size_t i = 0; i < op.out_size; ++i)
+                    y[i] = std::max(x[i], 0.0f);
+            }
+            break;
+        case OpKind::Add:
+            for(std::size_t b = 0; b < items; ++b)
+            {
+                // The output may be the first input.
+                const auto y = at(b, op.out[0]);
+                for(std::size_t i = 0; i < op.out_size; ++i)
+                {
+                    auto sum = 0.0f;
+                    for(const auto in : op.in)
+                    {
+                        if(in != Op::none)
+                            sum += at(b, in)[i];
+                    }
+                    y[i] = sum;
+                }
+            }
+            break;
+        case OpKind::Embedding:
+            for(std::size_t b = 0; b < items; ++b)
+            {
+                for(std::size_t s = 0; s < op.steps; ++s)
+                {
+                    const auto token = at(b, op.in[0])[s];
+                    if(!(token >= 0.0f && token < static_cast<float>(op.in_size)))
+                    {
+                        MIOPEN_THROW(miopenStatusInternalError,
+                                     "AI model: token out of vocabulary");
+                    }
+                    const auto row =
+                        params_at(op.weights) + static_cast<std::size_t>(token) * op.out_size;
+                    std::copy(row, row + op.out_size, at(b, op.out[0]) + s * op.out_size);
+                }
+            }
+            break;
+        case OpKind::Lstm: {
+            const std::size_t units = op.out_size;
+            // The scratch holds [x, h] and then the gates i, f, c, o.
+            x_rows.clear();
+            y_rows.clear();
+            for(std::size_t b = 0; b < items; ++b)
+            {
+                x_rows.push_back(at(b, op.scratch));
+                y_rows.push_back(at(b, op.scratch) + op.in_size + units);
+                if(op.in[1] != Op::none)
+                {
+                    std::copy(at(b, op.in[1]), at(b, op.in[1]) + units, at(b, op.out[1]));
+                    std::copy(at(b, op.in[2]), at(b, op.in[2]) + units, at(b, op.out[2]));
+                }
+            }
+            for(std::size_t s = 0; s < op.steps; ++s)
+            {
+                for(std::size_t b = 0; b < items; ++b)
+                {
+                    const auto x  = at(b, op.in[0]) + s * op.in_size;
+                    const auto h  = at(b, op.out[1]);
+                    const auto xh = at(b, op.scratch);
+                    std::copy(x, x + op.in_size, xh);
+                    std::copy(h, h + units, xh + op.in_size);
+                }
+                MatMul(x_rows.data(),
+                       y_rows.data(),
+                       items,
+                       op.in_size + units,
+                       params_at(op.weights),
+                       params_at(op.bias),
+                       4 * units);
+                for(std::size_t b = 0; b < items; ++b)
+                {
+                    const auto z = y_rows[b];
+                    const auto h = at(b, op.out[1]);
+                    const auto c = at(b, op.out[2]);
+                    for(std::size_t j = 0; j < units; ++j)
+                    {
+                        const auto i_gate = Activate(op.recurrent_activation, z[j]);
+                        const auto f_gate = Activate(op.recurrent_activation, z[units + j]);
+                        const auto cell   = Activate(op.activation, z[2 * units + j]);
+                        const auto o_gate = Activate(op.recurrent_activation, z[3 * units + j]);
+                        c[j]              = f_gate * c[j] + i_gate * cell;
+                        h[j]              = o_gate * Activate(op.activation, c[j]);
+                    }
+                    if(op.out[0] != Op::none)
+                        std::copy(h, h + units, at(b, op.out[0]) + s * units);
+                }
+            }
+            break;
+        }
+        }
+    }
+
+    auto results = std::vector<Tensors>(items);
+    for(std::size_t b = 0; b < items; ++b)
+    {
+        results[b].reserve(outputs.size());
+        for(const auto& output : outputs)
+            results[b].emplace_back(at(b, output.offset), at(b, output.offset) + output.size);
+    }
+    return results;
+}
+
+float CompiledModel::MaxTestError() const
+{
+    auto error = 0.0f;
+    for(const auto& test : tests)
+    {
+        const auto outputs = Predict(test.inputs);
+        if(outputs.size() != test.outputs.size())
+            return std::numeric_limits<float>::infinity();
+        for(std::size_t i = 0; i < outputs.size(); ++i)
+        {
+            if(outputs[i].size() != test.outputs[i].size())
+                return std::numeric_limits<float>::infinity();
+            for(std::size_t j = 0; j < outputs[i].size(); ++j)
+            {
+                const auto expected = test.outputs[i][j];
+                const auto scale    = std::max(1.0f, std::abs(expected));
+                error               = std::max(error, std::abs(outputs[i][j] - expected) / scale);
+            }
+        }
+    }
+    return error;
+}
+
+} // namespace ai
+} // namespace miopen
@@ -0,0 +1,464 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/conv/heuristics/decision_table.hpp>
+
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/db_path.hpp>
+#include <miopen/env.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/expanduser.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/stringutils.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_DISABLE_CONV_DECISION_TABLE)
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_CONV_DECISION_TABLE_PATH)
+
+namespace miopen {
+namespace conv {
+
+namespace {
+
+std::optional<std::size_t> ParseNumber(const std::string& str)
+{
+    const auto is_digit = [](unsigned char c) { return std::isdigit(c) != 0; };
+    if(str.empty() || !std::all_of(str.begin(), str.end(), is_digit))
+        return std::nullopt;
+    return std::stoull(str);
+}
+
+std::optional<std::vector<std::size_t>> ParseNumbers(const std::string& str, std::size_t count)
+{
+    auto values = std::vector<std::size_t>{};
+    for(const auto& item : SplitDelim(str, 'x'))
+    {
+        const auto value = ParseNumber(item);
+        if(!value)
+            return std::nullopt;
+        values.push_back(*value);
+    }
+    if(values.size() != count)
+        return std::nullopt;
+    return values;
+}
+
+int Log2Bucket(std::size_t value)
+{
+    auto bucket = 0;
+    while(value > 1)
+    {
+        value >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+template <class F>
+std::string Quantize(const std::vector<std::size_t>& values, F&& f)
+{
+    std::ostringstream ss;
+    for(std::size_t i = 0; i < values.size(); ++i)
+        ss << (i == 0 ? "" : "x") << f(values[i]);
+    return ss.str();
+}
+
+fs::path GetTablePath(const Handle& handle)
+{
+    const auto& path = env::value(MIOPEN_CONV_DECISION_TABLE_PATH);
+    if(!path.empty())
+        return ExpandUser(path);
+
+    const auto filename = handle.GetDbBasename() + ".dtable.txt";
+    const auto& user_db = GetUserDbPath();
+    if(!user_db.empty() && fs::exists(user_db / filename))
+        return user_db / filename;
+    return GetSystemDbPath() / filename;
+}
+
+std::shared_ptr<const DecisionTable> GetDecisionTable(const Handle& handle)
+{
+    static std::mutex mutex;
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::map<fs::path, std::shared_ptr<const DecisionTable>> tables;
+
+    const auto path = GetTablePath(handle);
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto found = tables.find(path);
+    if(found != tables.end())
+        return found->second;
+
+    auto table = std::make_shared<DecisionTable>();
+    if(!table->Load(path))
+        table.reset();
+    return tables.emplace(path, std::move(table)).first->second;
+}
+
+} // namespace
+
+std::optional<DbKeyFields> DbKeyFields::Parse(const std::string& db_key)
+{
+    const auto tokens = SplitDelim(db_key, '-');
+    if(tokens.size() < 4)
+        return std::nullopt;
+
+    auto fields         = DbKeyFields{};
+    fields.spatial_dims = tokens[3].find('x') != std::string::npos ? 2 : 3;
+    const auto dims     = fields.spatial_dims;
+    // C-[D-]H-W-filter-K-[oD-]oH-oW-N-pads-strides-dilations-bias-layouts-types-direction
+    const auto fixed = 2 * dims + 10;
+    if(tokens.size() != fixed + 1 && tokens.size() != fixed + 3)
+        return std::nullopt;
+
+    auto pos                 = std::size_t{0};
+    const auto next          = [&]() -> const std::string& { return tokens[pos++]; };
+    const auto number_tokens = [&](std::vector<std::size_t>& to) {
+        for(std::size_t i = 0; i < dims; ++i)
+        {
+            const auto value = ParseNumber(next());
+            if(!value)
+                return false;
+            to.push_back(*value);
+        }
+        return true;
+    };
+
+    const auto in_channels = ParseNumber(next());
+    if(!in_channels || !number_tokens(fields.in_spatial))
+        return std::nullopt;
+    auto filter             = ParseNumbers(next(), dims);
+    const auto out_channels = ParseNumber(next());
+    if(!filter || !out_channels || !number_tokens(fields.out_spatial))
+        return std::nullopt;
+    const auto batch_size = ParseNumber(next());
+    auto pads             = ParseNumbers(next(), dims);
+    auto strides          = ParseNumbers(next(), dims);
+    auto dilations        = ParseNumbers(next(), dims);
+    const auto bias       = ParseNumber(next());
+    if(!batch_size || !pads || !strides || !dilations || !bias)
+        return std::nullopt;
+
+    fields.in_channels  = *in_channels;
+    fields.out_channels = *out_channels;
+    fields.batch_size   = *batch_size;
+    fields.filter       = std::move(*filter);
+    fields.pads         = std::move(*pads);
+    fields.strides      = std::move(*strides);
+    fields.dilations    = std::move(*dilations);
+    fields.bias         = static_cast<int>(*bias);
+
+    while(pos < tokens.size() - 2)
+        fields.layouts.push_back(next());
+    fields.data_types = next();
+
+    // F, B or W followed by the optional part: _g<group count>_ci<type>_cw<type>_co<type>
+    const auto direction = SplitDelim(next(), '_');
+    if(direction.empty())
+        return std::nullopt;
+    fields.direction = direction[0];
+    for(std::size_t i = 1; i < direction.size(); ++i)
+    {
+        const auto& item  = direction[i];
+        const auto groups = item.size() > 1 && item[0] == 'g' ? ParseNumber(item.substr(1))
+                                                              : std::nullopt;
+        if(groups)
+            fields.group_count = *groups;
+        else
+            fields.cast_types += "_" + item;
+    }
+    return fields;
+}
+
+std::optional<DbKeyFields> DbKeyFields::FromProblem(const ProblemDescription& problem)
+{
+    const auto dims  = problem.GetSpatialDims();
+    const auto sizes = [dims](std::size_t depth, std::size_t height, std::size_t width) {
+        return dims > 2 ? std::vector<std::size_t>{depth, height, width}
+                        : std::vector<std::size_t>{height, width};
+    };
+    // Parse() only accepts non-negative numbers.
+    const auto dhw = [&](int depth, int height, int width) {
+        return depth < 0 || height < 0 || width < 0
+                   ? std::nullopt
+                   : std::optional<std::vector<std::size_t>>{sizes(depth, height, width)};
+    };
+
+    auto pads      = dhw(problem.GetPadD(), problem.GetPadH(), problem.GetPadW());
+    auto strides   = dhw(problem.GetKernelStrideD(),
+                       problem.GetKernelStrideH(),
+                       problem.GetKernelStrideW());
+    auto dilations = dhw(problem.GetDilationD(), problem.GetDilationH(), problem.GetDilationW());
+    if(!pads || !strides || !dilations || problem.GetBias() < 0 || problem.GetGroupCount() < 0)
+        return std::nullopt;
+
+    auto fields         = DbKeyFields{};
+    fields.spatial_dims = dims > 2 ? 3 : 2;
+    fields.in_channels  = problem.GetInChannels();
+    fields.out_channels = problem.GetOutChannels();
+    fields.batch_size   = problem.GetInBatchSize();
+    fields.in_spatial   = sizes(problem.GetInDepth(), problem.GetInHeight(), problem.GetInWidth());
+    fields.out_spatial  =
+        sizes(problem.GetOutDepth(), problem.GetOutHeight(), problem.GetOutWidth());
+    fields.filter       =
+        sizes(problem.GetWeightsDepth(), problem.GetWeightsHeight(), problem.GetWeightsWidth());
+    fields.pads         = std::move(*pads);
+    fields.strides      = std::move(*strides);
+    fields.dilations    = std::move(*dilations);
+    fields.bias         = problem.GetBias();
+
+    // See ProblemDescription::Serialize().
+    const auto layout = problem.GetInLayout();
+    if((layout == "NCHW" || layout == "NCDHW") && problem.GetWeightsLayout() == layout &&
+       problem.GetOutLayout() == layout)
+        fields.layouts = {layout};
+    else
+        fields.layouts = {layout, problem.GetWeightsLayout(), problem.GetOutLayout()};
+    fields.data_types = EncodeDataTypesForKey(
+        problem.GetInDataType(), problem.GetWeightsDataType(), problem.GetOutDataType());
+    fields.direction   = problem.GetDirectionStr();
+    fields.group_count = problem.GetGroupCount();
+    if(const auto ct = problem.GetInCastType())
+        fields.cast_types += "_ci" + GetDataTypeName(*ct);
+    if(const auto ct = problem.GetWeightsCastType())
+        fields.cast_types += "_cw" + GetDataTypeName(*ct);
+    if(const auto ct = problem.GetOutCastType())
+        fields.cast_types += "_co" + GetDataTypeName(*ct);
+    return fields;
+}
+
+std::string DecisionTable::MakeKey(const DbKeyFields& fields)
+{
+    const auto small = [](std::size_t limit) {
+        return [limit](std::size_t value) {
+            return value <= limit ? std::to_string(value) : std::string{"L"};
+        };
+    };
+
+    std::ostringstream ss;
+    ss << fields.direction << '-' << fields.data_types << fields.cast_types;
+    ss << '-' << JoinStrings(fields.layouts, ".") << '-' << fields.spatial_dims << 'd';
+    ss << "-c" << Log2Bucket(fields.in_channels);
+    ss << "-k" << Log2Bucket(fields.out_channels);
+    ss << "-n" << Log2Bucket(fields.batch_size);
+    ss << "-s" << Quantize(fields.in_spatial, Log2Bucket);
+    ss << "-f" << Quantize(fields.filter, small(7));
+    ss << "-u" << Quantize(fields.strides, small(2));
+    ss << "-p" << std::any_of(fields.pads.begin(), fields.pads.end(), [](auto p) { return p > 0; });
+    ss << "-l"
+       << std::any_of(
+              fields.dilations.begin(), fields.dilations.end(), [](auto d) { return d > 1; });
+    if(fields.group_count == 1)
+        ss << "-g1";
+    else if(fields.group_count == fields.in_channels && fields.group_count == fields.out_channels)
+        ss << "-gdw";
+    else
+        ss << "-gn";
+    return ss.str();
+}
+
+std::optional<std::string> DecisionTable::MakeKey(const std::string& db_key)
+{
+    const auto fields = DbKeyFields::Parse(db_key);
+    if(!fields)
+        return std::nullopt;
+    return MakeKey(*fields);
+}
+
+const std::vector<solver::Id>* DecisionTable::Find(const std::string& key) const
+{
+    const auto found = entries.find(key);
+    return found != entries.end() ? &found->second : nullptr;
+}
+
+void DecisionTable::Set(const std::string& key, std::vector<solver::Id> solvers)
+{
+    entries[key] = std::move(solvers);
+}
+
+bool DecisionTable::Load(const fs::path& path)
+{
+    std::ifstream in(path);
+    if(!in)
+        return false;
+
+    std::string line;
+    if(!std::getline(in, line) || line != "# decision table v" + std::to_string(version))
+    {
+        MIOPEN_LOG_W("Unsupported decision table " << path << ": " << line);
+        return false;
+    }
+    while(std::getline(in, line))
+    {
+        const auto separator = line.find('=');
+        if(separator == std::string::npos)
+        {
+            MIOPEN_LOG_W("Skipping malformed line in " << path << ": " << line);
+            continue;
+        }
+        auto solvers = std::vector<solver::Id>{};
+        for(const auto& name : SplitDelim(line.substr(separator + 1), ','))
+        {
+            // Solvers may be removed from later versions of the library.
+            const auto id = solver::Id{name};
+            if(id.IsValid())
+                solvers.push_back(id);
+        }
+        entries[line.substr(0, separator)] = std::move(solvers);
+    }
+    MIOPEN_LOG_I("Loaded " << entries.size() << " entries from " << path);
+    return true;
+}
+
+void DecisionTable::Save(const fs::path& path) const
+{
+    // Sorted to make the files diffable.
+    const auto sorted =
+        std::map<std::string, std::vector<solver::Id>>{entries.begin(), entries.end()};
+
+    std::ofstream out(path, std::ios::trunc);
+    out << "# decision table v" << version << '\n';
+    for(const auto& [key, solvers] : sorted)
+    {
+        out << key << '=';
+        for(std::size_t i = 0; i < solvers.size(); ++i)
+            out << (i == 0 ? "" : ",") << solvers[i].ToString();
+        out << '\n';
+    }
+    if(!out)
+        MIOPEN_THROW("Unable to save the decision table to " + path);
+}
+
+bool DecisionTableBuilder::Add(const std::string& db_key,
+                               const std::vector<std::pair<solver::Id, float>>& times)
+{
+    const auto key = DecisionTable::MakeKey(db_key);
+    if(!key)
+        return false;
+    if(times.empty())
+        return true;
+
+    const auto best = std::min_element(times.begin(), times.end(), [](auto& l, auto& r) {
+        return l.second < r.second;
+    });
+    auto& entry = entries[*key];
+    for(const auto& [id, time] : times)
+    {
+        auto& stats = entry[id.Value()];
+        ++stats.records;
+        stats.relative_times += best->second > 0.0f ? time / best->second : 1.0;
+    }
+    ++entry[best->first.Value()].wins;
+    return true;
+}
+
+DecisionTable DecisionTableBuilder::Build(std::size_t max_solvers) const
+{
+    auto table = DecisionTable{};
+    for(const auto& [key, entry] : entries)
+    {
+        auto ranked = std::vector<std::pair<uint64_t, SolverStats>>{entry.begin(), entry.end()};
+        std::sort(ranked.begin(), ranked.end(), [](const auto& l, const auto& r) {
+            if(l.second.wins != r.second.wins)
+                return l.second.wins > r.second.wins;
+            return l.second.relative_times / l.second.records <
+                   r.second.relative_times / r.second.records;
+        });
+        if(ranked.size() > max_solvers)
+            ranked.resize(max_solvers);
+
+        auto solvers = std::vector<solver::Id>{};
+        for(const auto& solver : ranked)
+            solvers.emplace_back(solver.first);
+        table.Set(key, std::move(solvers));
+    }
+    return table;
+}
+
+DecisionTableCache::DecisionTableCache(const Handle& handle)
+    : table(env::enabled(MIOPEN_DEBUG_DISABLE_CONV_DECISION_TABLE) ? nullptr
+                                                                    : GetDecisionTable(handle))
+{
+}
+
+DecisionTableCache::DecisionTableCache(std::shared_ptr<const DecisionTable> table_)
+    : table(std::move(table_))
+{
+}
+
+std::optional<std::vector<solver::Id>> DecisionTableCache::Find(const ProblemDescription& problem)
+{
+    if(table == nullptr)
+        return std::nullopt;
+
+    const auto problem_key = problem.MakeKey();
+    if(problem_key.IsValid())
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        const auto found = results.find(problem_key);
+        if(found != results.end())
+            return found->second;
+    }
+
+    auto solvers      = std::optional<std::vector<solver::Id>>{};
+    const auto fields = DbKeyFields::FromProblem(problem);
+    if(fields)
+    {
+        const auto key   = DecisionTable::MakeKey(*fields);
+        const auto entry = table->Find(key);
+        if(entry != nullptr)
+            solvers = *entry;
+        else
+            MIOPEN_LOG_I2("No decision table entry for " << key);
+    }
+
+    if(problem_key.IsValid())
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        if(results.size() >= max_size)
+            results.clear();
+        results.emplace(problem_key, solvers);
+    }
+    return solvers;
+}
+
+std::optional<std::vector<solver::Id>> GetDecisionTableSolvers(const ExecutionContext& ctx,
+                                                               const ProblemDescription& problem)
+{
+    if(env::enabled(MIOPEN_DEBUG_DISABLE_CONV_DECISION_TABLE))
+        return std::nullopt;
+    return ctx.GetStream().GetDecisionTableCache().Find(problem);
+}
+
+} // namespace conv
+} // namespace miopen
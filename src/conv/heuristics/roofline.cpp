@@ -0,0 +1,245 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/conv/heuristics/roofline.hpp>
+
+#include <miopen/any_solver.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/solver_id.hpp>
+#include <miopen/stringutils.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace miopen {
+namespace conv {
+
+namespace {
+
+struct TargetPeaks
+{
+    const char* prefix;
+    double clock;        // GHz
+    double vector_flops; // fp32 FLOP per clock and CU
+    double matrix_flops; // fp16 FLOP per clock and CU of the matrix cores
+    double bandwidth;    // GB/s per CU
+};
+
+// Published peaks of the reference parts, the first matching prefix wins.
+// clang-format off
+constexpr auto target_peaks = std::array<TargetPeaks, 8>{{
+    {"gfx900", 1.5, 128.0,    0.0,  7.6},
+    {"gfx906", 1.8, 128.0,    0.0, 16.0},
+    {"gfx908", 1.5, 128.0, 1024.0, 10.2},
+    {"gfx90a", 1.7, 256.0, 1024.0, 14.9},
+    {"gfx94",  2.1, 256.0, 2048.0, 17.4},
+    {"gfx103", 2.2, 256.0,    0.0,  6.4},
+    {"gfx11",  2.4, 256.0,  512.0, 10.0},
+    {"gfx12",  2.4, 256.0, 1024.0, 10.0},
+}};
+// clang-format on
+constexpr auto default_peaks = TargetPeaks{"", 1.5, 128.0, 0.0, 8.0};
+
+constexpr double launch_overhead = 5e-6; // s
+
+double CeilDiv(double lhs, double rhs) { return std::ceil(lhs / rhs); }
+
+RooflineParams GetAlgorithmDefaults(miopenConvAlgorithm_t algo)
+{
+    auto params = RooflineParams{};
+    switch(algo)
+    {
+    case miopenConvolutionAlgoGEMM:
+        params.efficiency    = 0.5f;
+        params.tile_m        = 64;
+        params.tile_n        = 64;
+        params.traffic_ratio = 2.0f; // im2col
+        break;
+    case miopenConvolutionAlgoDirect:
+        params.efficiency = 0.2f;
+        params.tile_m     = 32;
+        params.tile_n     = 64;
+        break;
+    case miopenConvolutionAlgoFFT:
+        params.efficiency    = 0.25f;
+        params.traffic_ratio = 3.0f;
+        params.launches      = 3;
+        break;
+    case miopenConvolutionAlgoWinograd:
+        params.efficiency = 0.5f;
+        params.flop_ratio = 0.44f; // F(2,3) in two dimensions
+        params.tile_m     = 32;
+        params.tile_n     = 64;
+        break;
+    case miopenConvolutionAlgoImplicitGEMM:
+        params.efficiency = 0.4f;
+        params.tile_m     = 128;
+        params.tile_n     = 128;
+        break;
+    }
+    return params;
+}
+
+} // namespace
+
+RooflineDevice RooflineDevice::Get(const std::string& device_name, std::size_t compute_units)
+{
+    const auto match = std::find_if(target_peaks.begin(), target_peaks.end(), [&](auto& peaks) {
+        return StartsWith(device_name, peaks.prefix);
+    });
+    const auto& peaks = match != target_peaks.end() ? *match : default_peaks;
+
+    auto device          = RooflineDevice{};
+    device.compute_units = std::max<std::size_t>(compute_units, 1);
+    const auto cus       = static_cast<double>(device.compute_units);
+    device.vector_flops  = cus * peaks.clock * 1e9 * peaks.vector_flops;
+    device.matrix_flops  = cus * peaks.clock * 1e9 * peaks.matrix_flops;
+    device.bandwidth     = cus * peaks.bandwidth * 1e9;
+    return device;
+}
+
+RooflineDevice RooflineDevice::Get(const ExecutionContext& ctx)
+{
+    const auto& stream = ctx.GetStream();
+    return Get(stream.GetDeviceName(), stream.GetMaxComputeUnits());
+}
+
+double RooflineDevice::GetPeakFlops(miopenDataType_t type, bool matrix_cores) const
+{
+    if(matrix_cores && matrix_flops > 0.0)
+    {
+        switch(type)
+        {
+        case miopenHalf:
+        case miopenBFloat16: return matrix_flops;
+        case miopenInt8:
+        case miopenFloat8:
+        case miopenBFloat8: return 2.0 * matrix_flops;
+        case miopenDouble: return matrix_flops / 8.0;
+        case miopenFloat:
+        case miopenInt32:
+        case miopenInt64: return matrix_flops / 4.0;
+        }
+    }
+    switch(type)
+    {
+    case miopenHalf:
+    case miopenBFloat16:
+    case miopenFloat8:
+    case miopenBFloat8: return 2.0 * vector_flops;
+    case miopenInt8: return 4.0 * vector_flops;
+    case miopenDouble: return vector_flops / 2.0;
+    case miopenFloat:
+    case miopenInt32:
+    case miopenInt64: break;
+    }
+    return vector_flops;
+}
+
+float EstimateTime(const RooflineDevice& device,
+                   const ProblemDescription& problem,
+                   const RooflineParams& params,
+                   std::size_t workspace)
+{
+    if(params.efficiency <= 0.0f)
+        return -1.0f;
+
+    // Sizes of the forward convolution, the in tensor is y for the backward directions.
+    const auto& x       = problem.IsDirectionForward() ? problem.GetIn() : problem.GetOut();
+    const auto& y       = problem.IsDirectionForward() ? problem.GetOut() : problem.GetIn();
+    const auto& weights = problem.GetWeights();
+    const auto batch    = static_cast<double>(problem.GetBatchSize());
+    const auto groups   = static_cast<double>(problem.GetGroupCount());
+    const auto c        = static_cast<double>(x.GetLengths()[1]);
+    const auto k        = static_cast<double>(y.GetLengths()[1]);
+    const auto filter   = static_cast<double>(weights.GetElementSize()) * groups / (k * c);
+    const auto x_pixels = static_cast<double>(x.GetElementSize()) / (batch * c);
+    const auto y_pixels = static_cast<double>(y.GetElementSize()) / (batch * k);
+    const auto flops    = 2.0 * static_cast<double>(weights.GetElementSize()) * batch * y_pixels;
+
+    // The implicit GEMM of one group.
+    auto gemm_m = k / groups;
+    auto gemm_n = batch * y_pixels;
+    if(problem.IsDirectionBackwardData())
+    {
+        gemm_m = c / groups;
+        gemm_n = batch * x_pixels;
+    }
+    else if(problem.IsDirectionBackwardWrW())
+    {
+        gemm_n = c / groups * filter;
+    }
+
+    const auto tile_m = static_cast<double>(std::max<std::size_t>(params.tile_m, 1));
+    const auto tile_n = static_cast<double>(std::max<std::size_t>(params.tile_n, 1));
+    const auto tiles  = groups * CeilDiv(gemm_m, tile_m) * CeilDiv(gemm_n, tile_n);
+    const auto cus    = static_cast<double>(device.compute_units);
+    // The partially filled tiles and the last wave of workgroups waste the compute units.
+    const auto tile_utilization = groups * gemm_m * gemm_n / (tiles * tile_m * tile_n);
+    const auto wave_utilization = tiles / (CeilDiv(tiles, cus) * cus);
+
+    const auto peak = device.GetPeakFlops(problem.GetInDataType(), params.matrix_cores) *
+                      params.efficiency * tile_utilization * wave_utilization;
+
+    const auto tensors = problem.GetInSize() + problem.GetWeightsSize() + problem.GetOutSize();
+    const auto bytes   = static_cast<double>(tensors) * params.traffic_ratio +
+                         2.0 * static_cast<double>(workspace);
+
+    const auto compute_time = flops * params.flop_ratio / peak;
+    const auto memory_time  = bytes / device.bandwidth;
+
+    const auto time = std::max(compute_time, memory_time) +
+                      static_cast<double>(params.launches) * launch_overhead;
+    return static_cast<float>(time * 1e3);
+}
+
+RooflineParams GetRooflineParams(const ExecutionContext& ctx,
+                                 const ProblemDescription& problem,
+                                 const solver::Id& solver_id)
+{
+    const auto params = solver_id.GetSolver().GetRooflineParams(ctx, problem);
+    if(params.efficiency > 0.0f)
+        return params;
+    // Not the WTI: it is relative to the direct convolution, not to the peak of the device.
+    return GetAlgorithmDefaults(solver_id.GetAlgo());
+}
+
+float EstimateSolverTime(const RooflineDevice& device,
+                         const ExecutionContext& ctx,
+                         const ProblemDescription& problem,
+                         const solver::Id& solver_id,
+                         std::size_t workspace)
+{
+    return EstimateTime(device,
+                        problem,
+                        GetRooflineParams(ctx, problem, solver_id),
+                        workspace);
+}
+
+} // namespace conv
+} // namespace miopen
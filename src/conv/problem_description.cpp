@@ -142,104 +142,158 @@ void ProblemDescription::HeuristicUpdateLayouts()
     // If we did not find consistent layout, leave them as-is
 }
 
-void ProblemDescription::MakeNetworkConfig(std::string& conf_key) const
+ProblemKey ProblemDescription::MakeKey() const
 {
-    std::ostringstream ss;
-
-    ss << GetInChannels();
-    ss << 'x' << PrintDHW('x', GetSpatialDims(), GetInDepth(), GetInHeight(), GetInWidth());
-    ss << 'x'
-       << PrintDHW('x', GetSpatialDims(), GetWeightsDepth(), GetWeightsHeight(), GetWeightsWidth());
-    ss << 'x' << GetOutChannels();
-    ss << 'x' << PrintDHW('x', GetSpatialDims(), GetOutDepth(), GetOutHeight(), GetOutWidth());
-    ss << 'x' << GetInBatchSize();
-    if((GetInLayout() == "NCHW" && GetWeightsLayout() == "NCHW" && GetOutLayout() == "NCHW") ||
-       (GetInLayout() == "NCDHW" && GetWeightsLayout() == "NCDHW" && GetOutLayout() == "NCDHW"))
-    {
-        ss << 'x' << GetInLayout();
-    }
-    else
-    {
-        ss << 'x' << GetInLayout();
-        ss << 'x' << GetWeightsLayout();
-        ss << 'x' << GetOutLayout();
-    }
-    ss << 'x' << EncodeDataTypesForKey(GetInDataType(), GetWeightsDataType(), GetOutDataType());
-
-    std::ostringstream optional;
-    if(const auto ct = GetInCastType())
-        optional << "ci" << GetDataTypeName(*ct);
-    if(const auto ct = GetWeightsCastType())
-        optional << "cw" << GetDataTypeName(*ct);
-    if(const auto ct = GetOutCastType())
-        optional << "co" << GetDataTypeName(*ct);
-    if(!optional.str().empty())
-    {
-        ss << 'x' << optional.str();
-    }
-
-    ss << 'x' << PrintDHW('x', GetSpatialDims(), GetPadD(), GetPadH(), GetPadW());
-    ss << 'x'
-       << PrintDHW(
-              'x', GetSpatialDims(), GetKernelStrideD(), GetKernelStrideH(), GetKernelStrideW());
-    ss << 'x' << PrintDHW('x', GetSpatialDims(), GetDilationD(), GetDilationH(), GetDilationW());
-    ss << 'x' << GetGroupCount();
-    ss << 'x' << GetDirectionStr();
-    ss << 'x' << GetAlphaBetaCaseStr();
+    // Covers everything MakeNetworkConfig() and Serialize() print.
+    auto key = ProblemKey{ProblemKey::Kind::Convolution};
+    key.Add(GetSpatialDims());
+    key.Add(GetInChannels());
+    key.Add(GetInDepth());
+    key.Add(GetInHeight());
+    key.Add(GetInWidth());
+    key.Add(GetWeightsDepth());
+    key.Add(GetWeightsHeight());
+    key.Add(GetWeightsWidth());
+    key.Add(GetOutChannels());
+    key.Add(GetOutDepth());
+    key.Add(GetOutHeight());
+    key.Add(GetOutWidth());
+    key.Add(GetInBatchSize());
+    key.Add(in_layout);
+    key.Add(weights_layout);
+    key.Add(out_layout);
+    key.Add(GetInDataType());
+    key.Add(GetWeightsDataType());
+    key.Add(GetOutDataType());
+    key.Add(GetInCastType());
+    key.Add(GetWeightsCastType());
+    key.Add(GetOutCastType());
+    key.Add(GetPadD());
+    key.Add(GetPadH());
+    key.Add(GetPadW());
+    key.Add(GetKernelStrideD());
+    key.Add(GetKernelStrideH());
+    key.Add(GetKernelStrideW());
+    key.Add(GetDilationD());
+    key.Add(GetDilationH());
+    key.Add(GetDilationW());
+    key.Add(GetGroupCount());
+    key.Add(GetDirection());
+    key.Add(GetAlphaBetaCase());
+    key.Add(GetBias());
+    return key;
+}
 
-    conf_key = ss.str();
+void ProblemDescription::MakeNetworkConfig(std::string& conf_key) const
+{
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    thread_local ProblemKeyTextCache cache;
+
+    conf_key = cache.Get(MakeKey(), [&]() {
+        std::ostringstream ss;
+
+        ss << GetInChannels();
+        ss << 'x' << PrintDHW('x', GetSpatialDims(), GetInDepth(), GetInHeight(), GetInWidth());
+        ss << 'x'
+           << PrintDHW(
+                  'x', GetSpatialDims(), GetWeightsDepth(), GetWeightsHeight(), GetWeightsWidth());
+        ss << 'x' << GetOutChannels();
+        ss << 'x' << PrintDHW('x', GetSpatialDims(), GetOutDepth(), GetOutHeight(), GetOutWidth());
+        ss << 'x' << GetInBatchSize();
+        if((in_layout == "NCHW" && weights_layout == "NCHW" && out_layout == "NCHW") ||
+           (in_layout == "NCDHW" && weights_layout == "NCDHW" && out_layout == "NCDHW"))
+        {
+            ss << 'x' << in_layout;
+        }
+        else
+        {
+            ss << 'x' << in_layout;
+            ss << 'x' << weights_layout;
+            ss << 'x' << out_layout;
+        }
+        ss << 'x' << EncodeDataTypesForKey(GetInDataType(), GetWeightsDataType(), GetOutDataType());
+
+        const auto in_ct      = GetInCastType();
+        const auto weights_ct = GetWeightsCastType();
+        const auto out_ct     = GetOutCastType();
+        if(in_ct || weights_ct || out_ct)
+            ss << 'x';
+        if(in_ct)
+            ss << "ci" << GetDataTypeName(*in_ct);
+        if(weights_ct)
+            ss << "cw" << GetDataTypeName(*weights_ct);
+        if(out_ct)
+            ss << "co" << GetDataTypeName(*out_ct);
+
+        ss << 'x' << PrintDHW('x', GetSpatialDims(), GetPadD(), GetPadH(), GetPadW());
+        ss << 'x'
+           << PrintDHW('x',
+                       GetSpatialDims(),
+                       GetKernelStrideD(),
+                       GetKernelStrideH(),
+                       GetKernelStrideW());
+        ss << 'x'
+           << PrintDHW('x', GetSpatialDims(), GetDilationD(), GetDilationH(), GetDilationW());
+        ss << 'x' << GetGroupCount();
+        ss << 'x' << GetDirectionStr();
+        ss << 'x' << GetAlphaBetaCaseStr();
+
+        return ss.str();
+    });
 }
 
 void ProblemDescription::Serialize(std::ostream& stream) const
 {
-    const auto sep = '-';
-    // Problem description with default layout
-    // 576-4-4-1x1-192-4-4-8-1x1-2x2-3x3-0-NCHW-FP32-F
-    // Problem description with non-default layout
-    // 576-4-4-1x1-192-4-4-8-1x1-2x2-3x3-0-NHWC-NCHW-NCHW-FP32-F
-    // clang-format off
-    stream << GetInChannels();
-    stream << sep << PrintDHW(sep, GetSpatialDims(), GetInDepth(), GetInHeight(), GetInWidth());
-    stream << sep << PrintDHW('x', GetSpatialDims(), GetWeightsDepth(), GetWeightsHeight(), GetWeightsWidth());
-    stream << sep << GetOutChannels();
-    stream << sep << PrintDHW(sep, GetSpatialDims(), GetOutDepth(), GetOutHeight(), GetOutWidth());
-    stream << sep << GetInBatchSize();
-    stream << sep << PrintDHW('x', GetSpatialDims(), GetPadD(), GetPadH(), GetPadW());
-    stream << sep << PrintDHW('x', GetSpatialDims(), GetKernelStrideD(), GetKernelStrideH(), GetKernelStrideW());
-    stream << sep << PrintDHW('x', GetSpatialDims(), GetDilationD(), GetDilationH(), GetDilationW());
-    stream << sep << GetBias();
-    if ((GetInLayout() == "NCHW" && GetWeightsLayout() == "NCHW" && GetOutLayout() == "NCHW")
-        || (GetInLayout() == "NCDHW" && GetWeightsLayout() == "NCDHW" && GetOutLayout() == "NCDHW"))
-    {
-        stream << sep << GetInLayout();
-    } else {
-        stream << sep << GetInLayout();
-        stream << sep << GetWeightsLayout();
-        stream << sep << GetOutLayout();
-    }
-    stream << sep << EncodeDataTypesForKey(GetInDataType(), GetWeightsDataType(), GetOutDataType());
-    stream << sep << GetDirectionStr();
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    thread_local ProblemKeyTextCache cache;
+
+    stream << cache.Get(MakeKey(), [&]() {
+        std::ostringstream ss;
+        const auto sep = '-';
+        // Problem description with default layout
+        // 576-4-4-1x1-192-4-4-8-1x1-2x2-3x3-0-NCHW-FP32-F
+        // Problem description with non-default layout
+        // 576-4-4-1x1-192-4-4-8-1x1-2x2-3x3-0-NHWC-NCHW-NCHW-FP32-F
+        // clang-format off
+        ss << GetInChannels();
+        ss << sep << PrintDHW(sep, GetSpatialDims(), GetInDepth(), GetInHeight(), GetInWidth());
+        ss << sep << PrintDHW('x', GetSpatialDims(), GetWeightsDepth(), GetWeightsHeight(), GetWeightsWidth());
+        ss << sep << GetOutChannels();
+        ss << sep << PrintDHW(sep, GetSpatialDims(), GetOutDepth(), GetOutHeight(), GetOutWidth());
+        ss << sep << GetInBatchSize();
+        ss << sep << PrintDHW('x', GetSpatialDims(), GetPadD(), GetPadH(), GetPadW());
+        ss << sep << PrintDHW('x', GetSpatialDims(), GetKernelStrideD(), GetKernelStrideH(), GetKernelStrideW());
+        ss << sep << PrintDHW('x', GetSpatialDims(), GetDilationD(), GetDilationH(), GetDilationW());
+        ss << sep << GetBias();
+        if ((in_layout == "NCHW" && weights_layout == "NCHW" && out_layout == "NCHW")
+            || (in_layout == "NCDHW" && weights_layout == "NCDHW" && out_layout == "NCDHW"))
+        {
+            ss << sep << in_layout;
+        } else {
+            ss << sep << in_layout;
+            ss << sep << weights_layout;
+            ss << sep << out_layout;
+        }
+        ss << sep << EncodeDataTypesForKey(GetInDataType(), GetWeightsDataType(), GetOutDataType());
+        ss << sep << GetDirectionStr();
+        // clang-format on
+
+        // New performance config entries shall come into variable/optional part of db key.
+        // This is to support backward compatibility with previous versions of databases.
 
-    // clang-format on
-    // New performance config entries shall come into variable/optional part of db key.
-    // This is to support backward compatibility with previous versions of databases.
-    std::ostringstream optional;
-    {
         // Group count > 1 identifies Group/Depthwise modes.
         if(GetGroupCount() != 1)
-            optional << "_g" << GetGroupCount();
+            ss << "_g" << GetGroupCount();
 
         if(const auto ct = GetInCastType())
-            optional << "_ci" << GetDataTypeName(*ct);
+            ss << "_ci" << GetDataTypeName(*ct);
         if(const auto ct = GetWeightsCastType())
-            optional << "_cw" << GetDataTypeName(*ct);
+            ss << "_cw" << GetDataTypeName(*ct);
         if(const auto ct = GetOutCastType())
-            optional << "_co" << GetDataTypeName(*ct);
-    }
-    if(!optional.str().empty())
-    {
-        stream << optional.str();
-    }
+            ss << "_co" << GetDataTypeName(*ct);
+
+        return ss.str();
+    });
 }
 
 bool ProblemDescription::IsLayoutDefault() const
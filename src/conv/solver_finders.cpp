@@ -28,10 +28,12 @@
 
 #include <miopen/conv_algo_name.hpp>
 #include <miopen/config.h>
+#include <miopen/find_monitor.hpp>
 #include <miopen/mlo_internal.hpp>
 #include <miopen/perf_field.hpp>
 #include <miopen/conv/problem_description.hpp>
 #include <miopen/solution.hpp>
+#include <miopen/timing_policy.hpp>
 
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_CONV_GEMM)
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_CONV_DIRECT)
@@ -213,6 +215,29 @@ const std::vector<std::unique_ptr<ISolversFinder>>& GetConvSolverFinders()
 
 } // namespace conv
 
+namespace {
+
+/// Counts the measured solutions of FindCore() for the progress reports.
+struct FindProgress
+{
+    const FindMonitor* monitor;
+    std::size_t total;
+    std::size_t done = 0;
+    float best       = std::numeric_limits<float>::max();
+
+    bool IsCancelled() const { return monitor != nullptr && monitor->IsCancelled(); }
+
+    void Measured(float time)
+    {
+        ++done;
+        best = std::min(best, time);
+        if(monitor != nullptr)
+            monitor->Report(done, total, best);
+    }
+};
+
+} // namespace
+
 /// Register invoker only for the best solution within algorithm.
 static std::vector<Solution> EvaluateInvokers(Handle& handle,
                                               const std::vector<solver::ConvSolution>& solutions,
@@ -220,7 +245,10 @@ static std::vector<Solution> EvaluateInvokers(Handle& handle,
                                               const NetworkConfig& network_config,
                                               const AnyInvokeParams& invoke_ctx,
                                               bool& is_result_optimal,
-                                              bool force_attach_binary)
+                                              bool force_attach_binary,
+                                              const TimingPolicy& timing_policy,
+                                              bool precompiled,
+                                              FindProgress& progress)
 {
     const auto arch = env::value(MIOPEN_DEVICE_ARCH);
     if(!arch.empty())
@@ -233,6 +261,19 @@ static std::vector<Solution> EvaluateInvokers(Handle& handle,
 
     for(const auto& sol : solutions)
     {
+        // The solutions of a cancelled find are returned, but are not stored in the find-db.
+        const auto cancelled = progress.IsCancelled();
+        if(cancelled)
+        {
+            is_result_optimal = false;
+            if(!precompiled)
+            {
+                MIOPEN_LOG_I("Find cancelled, skipping the remaining solutions of "
+                             << algorithm_name.ToString());
+                break;
+            }
+        }
+
         if(!conv::IsEnoughWorkspace(
                "EvaluateInvokers", solver::Id{sol.solver_id}, sol.workspace_sz, &invoke_ctx))
         {
@@ -259,39 +300,46 @@ static std::vector<Solution> EvaluateInvokers(Handle& handle,
                                                    sol.construction_params,
                                                    force_attach_binary ? &programs : nullptr);
 
-        try
+        if(cancelled)
         {
-            // Run invoker max 6 times, with ~5 sec time limit.
-            using elapsed_t                 = decltype(handle.GetKernelTime());
-            constexpr elapsed_t TIME_MS_MAX = 5000.0;
-            constexpr int N_RUNS_MAX        = 6;
-            auto elapsed                    = static_cast<elapsed_t>(0);
-            auto first_elapsed              = static_cast<elapsed_t>(0);
-            int i                           = 0;
-            while(i < N_RUNS_MAX && elapsed < TIME_MS_MAX)
-            {
-                invoker(handle, invoke_ctx);
-                elapsed += handle.GetKernelTime();
-                if(i == 0)
-                    first_elapsed = elapsed;
-                ++i;
-            }
-            // If the execution time was not too long,
-            // then the 1st run is not counted (assume it's warm-up):
-            if(i > 1)
-                elapsed = (elapsed - first_elapsed) / static_cast<elapsed_t>(i - 1);
+            // The kernels are already built, so only the measurement is skipped.
+            MIOPEN_LOG_I(sol << ": not measured, find cancelled");
+            auto solution = Solution{solver::Id{sol.solver_id},
+                                     std::numeric_limits<float>::max(),
+                                     sol.workspace_sz};
+            if(force_attach_binary)
+                solution.SetInvoker(invoker, programs, sol.construction_params);
+            else
+                solution.SetInvoker(invoker, {}, {});
+            ret.emplace_back(std::move(solution));
+            continue;
+        }
 
-            MIOPEN_LOG_I(sol << ": " << elapsed << (elapsed < best ? " < " : " >= ") << best);
-            if(elapsed < best)
+        try
+        {
+            const auto timing = MeasureTime(
+                timing_policy,
+                [&]() {
+                    invoker(handle, invoke_ctx);
+                    return handle.GetKernelTime();
+                },
+                best);
+            const auto elapsed = timing.time;
+            progress.Measured(elapsed);
+
+            MIOPEN_LOG_I(sol << ": " << elapsed << (elapsed < best ? " < " : " >= ") << best
+                             << (timing.eliminated ? " (eliminated)" : ""));
+            if(elapsed < best && !timing.eliminated)
             {
                 best         = elapsed;
                 selected     = sol;
                 best_invoker = invoker;
             }
 
-            auto solution = Solution{solver::Id{selected.solver_id}, best, selected.workspace_sz};
+            auto solution = Solution{solver::Id{sol.solver_id}, elapsed, sol.workspace_sz};
+            solution.SetTimeVariance(timing.variance);
             if(force_attach_binary)
-                solution.SetInvoker(invoker, programs, selected.construction_params);
+                solution.SetInvoker(invoker, programs, sol.construction_params);
             else
                 solution.SetInvoker(invoker, {}, {});
             ret.emplace_back(std::move(solution));
@@ -299,11 +347,12 @@ static std::vector<Solution> EvaluateInvokers(Handle& handle,
         catch(const miopen::Exception& ex)
         {
             MIOPEN_LOG_E(ex.what());
+            progress.Measured(std::numeric_limits<float>::max());
         }
     }
 
     if(!selected.Succeeded())
-        return {};
+        return ret;
 
     handle.RegisterInvoker(best_invoker, network_config, selected.solver_id, algorithm_name);
     MIOPEN_LOG_I("Selected: " << selected << ": " << best
@@ -344,7 +393,11 @@ FindCoreResult FindCore(const AnyInvokeParams& invoke_ctx,
         ++it;
     }
 
+    const auto& monitor = ctx.find_monitor || !options ? ctx.find_monitor : options->monitor;
+
     // Precompile
+    const auto precompiled = !monitor || !monitor->IsCancelled();
+    if(precompiled)
     {
         auto all = std::vector<const miopen::solver::ConvSolution*>{};
         all.reserve(total);
@@ -364,6 +417,8 @@ FindCoreResult FindCore(const AnyInvokeParams& invoke_ctx,
     // Evaluate Invokers
     AutoEnableProfiling enableProfiling{handle};
     const auto network_config = problem.MakeNetworkConfig();
+    const auto timing_policy  = options ? options->timing_policy : TimingPolicy{};
+    auto progress             = FindProgress{monitor.get(), total};
     auto ret                  = FindCoreResult();
     ret.is_optimal            = true;
 
@@ -377,13 +432,24 @@ FindCoreResult FindCore(const AnyInvokeParams& invoke_ctx,
                                           network_config,
                                           invoke_ctx,
                                           ret.is_optimal,
-                                          force_attach_binary);
+                                          force_attach_binary,
+                                          timing_policy,
+                                          precompiled,
+                                          progress);
 
         ret.solutions.insert(ret.solutions.end(),
                              std::make_move_iterator(evaluated.begin()),
                              std::make_move_iterator(evaluated.end()));
     }
 
+    // Solvers may have been skipped or their searches stopped before reaching the evaluation.
+    if(progress.IsCancelled())
+    {
+        ret.is_optimal = false;
+        for(auto& solution : ret.solutions)
+            solution.SetPartial(true);
+    }
+
     return ret;
 }
 
@@ -28,6 +28,7 @@
 #include <miopen/errors.hpp>
 #include <miopen/lock_file.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/trace.hpp>
 #include <miopen/filesystem.hpp>
 
 #include <boost/date_time/posix_time/posix_time_types.hpp>
@@ -86,6 +87,7 @@ using shared_lock    = std::shared_lock<LockFile>;
 
 boost::optional<DbRecord> PlainTextDb::FindRecord(const std::string& key)
 {
+    MIOPEN_TRACE_SCOPE_DETAIL("db", "PlainTextDb::FindRecord", key);
     if(DisableUserDbFileIO)
         return {};
     const auto lock = shared_lock(lock_file, GetLockTimeout());
@@ -95,6 +97,7 @@ boost::optional<DbRecord> PlainTextDb::FindRecord(const std::string& key)
 
 bool PlainTextDb::StoreRecord(const DbRecord& record)
 {
+    MIOPEN_TRACE_SCOPE_DETAIL("db", "PlainTextDb::StoreRecord", record.GetKey());
     if(DisableUserDbFileIO)
         return true;
     const auto lock = exclusive_lock(lock_file, GetLockTimeout());
@@ -104,6 +107,7 @@ bool PlainTextDb::StoreRecord(const DbRecord& record)
 
 bool PlainTextDb::UpdateRecord(DbRecord& record)
 {
+    MIOPEN_TRACE_SCOPE_DETAIL("db", "PlainTextDb::UpdateRecord", record.GetKey());
     if(DisableUserDbFileIO)
         return true;
     const auto lock = exclusive_lock(lock_file, GetLockTimeout());
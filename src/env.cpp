@@ -31,6 +31,7 @@
 #include <cstdlib>
 #endif
 
+#include <atomic>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -42,6 +43,13 @@
 
 namespace miopen::env {
 
+namespace {
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<std::uint64_t> generation{0};
+
+} // namespace
+
 void setEnvironmentVariable(std::string_view name, std::string_view value)
 {
 #ifdef _WIN32
@@ -51,6 +59,7 @@ void setEnvironmentVariable(std::string_view name, std::string_view value)
     if(setenv(name.data(), value.data(), 1) != 0)
 #endif
         MIOPEN_THROW("Setting environment variable failed: " + std::string{name});
+    ++generation;
 }
 
 void clearEnvironmentVariable(std::string_view name)
@@ -62,8 +71,11 @@ void clearEnvironmentVariable(std::string_view name)
     if(unsetenv(name.data()) != 0)
 #endif
         MIOPEN_THROW("Removing environment variable failed: " + std::string{name});
+    ++generation;
 }
 
+std::uint64_t getEnvironmentGeneration() { return generation; }
+
 std::optional<std::string> getEnvironmentVariable(std::string_view name)
 {
 #ifdef _WIN32
@@ -0,0 +1,227 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/find_async.hpp>
+
+#include <miopen/errors.hpp>
+#include <miopen/find_monitor.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/mt_queue.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace miopen {
+
+namespace {
+
+/// Runs the background finds one after another.
+class FindWorker
+{
+public:
+    FindWorker() : thread([this]() { Run(); }) {}
+    FindWorker(const FindWorker&)            = delete;
+    FindWorker& operator=(const FindWorker&) = delete;
+
+    ~FindWorker()
+    {
+        // At exit nobody waits for the results anymore: cancel the running find and the queued
+        // ones, so that they stop early or do not start, instead of tuning to the end.
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for(const auto& monitor : scheduled)
+                monitor->Cancel();
+        }
+        // An empty job stops the worker after the scheduled ones.
+        jobs.push({});
+        thread.join();
+    }
+
+    void Schedule(std::function<void()> job, std::shared_ptr<FindMonitor> monitor)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            scheduled.push_back(monitor);
+        }
+        jobs.push({std::move(job), std::move(monitor)});
+    }
+
+private:
+    struct Job
+    {
+        std::function<void()> run;
+        std::shared_ptr<FindMonitor> monitor;
+    };
+
+    ThreadSafeQueue<Job> jobs;
+    std::mutex mutex;
+    std::vector<std::shared_ptr<FindMonitor>> scheduled;
+    std::thread thread;
+
+    void Run()
+    {
+        while(true)
+        {
+            auto job = jobs.pop();
+            if(!job.run)
+                return;
+            job.run();
+
+            std::lock_guard<std::mutex> lock(mutex);
+            scheduled.erase(std::find(scheduled.begin(), scheduled.end(), job.monitor));
+        }
+    }
+};
+
+FindWorker& GetFindWorker()
+{
+    static FindWorker worker;
+    return worker;
+}
+
+} // namespace
+
+struct FindFuture::State
+{
+    State(Handle& parent,
+          ProblemContainer problem_,
+          FindOptions options_,
+          std::size_t max_solutions_)
+        // Never benchmark on the application's stream: its kernels would skew the timings
+        // stored to the databases, and waiting for the results would wait for them too.
+        : handle(Handle::CreateChild(parent)),
+          problem(std::move(problem_)),
+          options(std::move(options_)),
+          max_solutions(max_solutions_)
+    {
+        // Cancelling this find should not stop the other ones using the same options.
+        auto callback = FindMonitor::Callback{};
+        if(options.monitor)
+            callback = options.monitor->GetCallback();
+        monitor         = std::make_shared<FindMonitor>(std::move(callback));
+        options.monitor = monitor;
+    }
+
+    std::unique_ptr<Handle> handle;
+    ProblemContainer problem;
+    FindOptions options;
+    std::size_t max_solutions;
+    std::shared_ptr<FindMonitor> monitor;
+
+    mutable std::mutex mutex;
+    mutable std::condition_variable done_cv;
+    bool done      = false;
+    bool retrieved = false;
+    std::vector<Solution> solutions;
+    std::exception_ptr error;
+
+    void Run()
+    {
+        auto results = std::vector<Solution>{};
+        auto failure = std::exception_ptr{};
+
+        if(monitor->IsCancelled())
+        {
+            MIOPEN_LOG_I("Find has been cancelled before it started");
+        }
+        else
+        {
+            try
+            {
+                results = std::visit(
+                    [&](auto& item) { return item.FindSolutions(*handle, options, max_solutions); },
+                    problem.item);
+            }
+            catch(...)
+            {
+                failure = std::current_exception();
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            solutions = std::move(results);
+            error     = failure;
+            done      = true;
+        }
+        done_cv.notify_all();
+    }
+};
+
+FindFuture::FindFuture(Handle& handle,
+                       ProblemContainer problem,
+                       FindOptions options,
+                       std::size_t max_solutions)
+    : state(std::make_shared<State>(handle, std::move(problem), std::move(options), max_solutions))
+{
+    MIOPEN_LOG_I2("Scheduling a find in the background");
+    GetFindWorker().Schedule([state_ = state]() { state_->Run(); }, state->monitor);
+}
+
+FindFuture::~FindFuture()
+{
+    Cancel();
+    Wait();
+}
+
+bool FindFuture::IsReady() const
+{
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->done;
+}
+
+void FindFuture::Wait() const
+{
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done_cv.wait(lock, [&]() { return state->done; });
+}
+
+void FindFuture::Cancel() { state->monitor->Cancel(); }
+
+std::vector<Solution> FindFuture::Get()
+{
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done_cv.wait(lock, [&]() { return state->done; });
+
+    if(state->retrieved)
+        MIOPEN_THROW(miopenStatusBadParm, "Results of the find have already been retrieved");
+    state->retrieved = true;
+
+    if(state->error)
+        std::rethrow_exception(state->error);
+    return std::move(state->solutions);
+}
+
+} // namespace miopen
@@ -36,16 +36,19 @@
 
 #include <boost/optional.hpp>
 
+#include <algorithm>
 #include <ostream>
 #include <cstdlib>
 #include <cstring>
 #include <string_view>
 #include <optional>
+#include <thread>
 
 MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_FIND_ENFORCE)
 MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_DEBUG_FIND_ONLY_SOLVER)
 MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_FIND_MODE)
 MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_FIND_MODE_FUSION)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_APPLICABILITY_THREADS_MAX, 1)
 
 namespace miopen {
 
@@ -178,6 +181,13 @@ boost::optional<std::vector<solver::Id>> GetEnvFindOnlySolver()
     return once;
 }
 
+std::size_t GetApplicabilityThreadsMax()
+{
+    // 0 means the number of hardware threads.
+    const auto threads = env::value(MIOPEN_APPLICABILITY_THREADS_MAX);
+    return threads != 0 ? threads : std::max(std::thread::hardware_concurrency(), 1u);
+}
+
 namespace {
 
 const char* ToCString(const FindMode::Values mode)
@@ -257,7 +257,9 @@ void FindDbRecord_t<TDb>::CopyTo(std::vector<Solution>& to) const
 {
     const auto range = content->As<FindDbData>();
     std::transform(range.begin(), range.end(), std::back_inserter(to), [](const auto& pair) {
-        return Solution{solver::Id{pair.first}, pair.second.time, pair.second.workspace};
+        auto solution = Solution{solver::Id{pair.first}, pair.second.time, pair.second.workspace};
+        solution.SetTimeVariance(pair.second.variance);
+        return solution;
     });
 }
 
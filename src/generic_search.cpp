@@ -27,6 +27,7 @@
 #include <miopen/generic_search.hpp>
 #include <miopen/generic_search_controls.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <chrono>
 
@@ -61,7 +62,26 @@ std::chrono::milliseconds GetTuningTimeMax()
     return std::chrono::milliseconds{env::value(MIOPEN_TUNING_TIME_MS_MAX)};
 }
 
-std::size_t GetTuningThreadsMax() { return env::value(MIOPEN_COMPILE_PARALLEL_LEVEL); }
+std::size_t GetTuningThreadsMax()
+{
+    return std::max<std::size_t>(env::value(MIOPEN_COMPILE_PARALLEL_LEVEL), 1);
+}
+
+std::size_t GetTuningCompileAheadMax()
+{
+    const auto depth = env::value(MIOPEN_TUNING_COMPILE_AHEAD_MAX);
+    return depth != 0 ? depth : 2 * GetTuningThreadsMax();
+}
+
+std::size_t GetTuningPatience() { return env::value(MIOPEN_TUNING_PATIENCE); }
+
+std::chrono::milliseconds GetTuningCoordinatorWaitMax()
+{
+    // A slice may have just been claimed by another worker, which then dies, so the slice is
+    // searched once more after its lease expires.
+    const auto wait = env::value(MIOPEN_TUNING_COORDINATOR_WAIT_MS);
+    return wait != 0 ? std::chrono::milliseconds{wait} : 2 * GetTuningTimeMax();
+}
 
 } // namespace solver
 } // namespace miopen
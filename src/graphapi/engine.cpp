@@ -24,16 +24,75 @@
  *
  *******************************************************************************/
 
+#include <miopen/base64.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/graphapi/engine.hpp>
 #include <miopen/graphapi/opgraph.hpp>
 
+#include <nlohmann/json.hpp>
+
 namespace miopen {
 
 namespace graphapi {
 
 GraphPatternExecutor::~GraphPatternExecutor() = default;
 
+namespace {
+namespace fields {
+inline constexpr const char* Kind         = "kind";
+inline constexpr const char* SolutionData = "solution";
+inline constexpr const char* Tensors      = "tensors";
+inline constexpr const char* Id           = "id";
+inline constexpr const char* EnumId       = "enum_id";
+} // namespace fields
+
+inline constexpr const char* find20Kind = "find20";
+} // namespace
+
+void GraphPatternExecutor::toJson(nlohmann::json&) const
+{
+    MIOPEN_THROW(miopenStatusNotImplemented, "The engine of the plan can't be serialized");
+}
+
+void GraphExecutorFind20::toJson(nlohmann::json& json) const
+{
+    // the solution keeps its kernel binaries, which only survive binary json formats
+    const nlohmann::json solution = miopen::deref(mSolution);
+
+    json = {
+        {fields::Kind, find20Kind},
+        {fields::SolutionData, EncodeBase64(nlohmann::json::to_msgpack(solution))},
+        {fields::Tensors, nlohmann::json::array()},
+    };
+    for(const auto& [id, info] : *mTensorInfoMap)
+    {
+        json[fields::Tensors].push_back({{fields::Id, id}, {fields::EnumId, info.mEnumId}});
+    }
+}
+
+std::unique_ptr<GraphPatternExecutor> GraphExecutorFind20::fromJson(const nlohmann::json& json)
+{
+    if(json.at(fields::Kind).get<std::string>() != find20Kind)
+    {
+        MIOPEN_THROW(miopenStatusInvalidValue, "Unknown executor in the serialized plan");
+    }
+
+    const auto bytes = DecodeBase64(json.at(fields::SolutionData).get<std::string>());
+    auto solution    = std::make_shared<Solution>(
+        nlohmann::json::from_msgpack(bytes.begin(), bytes.end()).get<Solution>());
+
+    auto tensorMap = std::make_shared<TensorInfoMap>();
+    for(const auto& t : json.at(fields::Tensors))
+    {
+        tensorMap->try_emplace(t.at(fields::Id).get<int64_t>(),
+                               TensorInfo(t.at(fields::EnumId).get<miopenTensorArgumentId_t>()));
+    }
+
+    auto ret            = std::make_unique<GraphExecutorFind20>(solution.get(), tensorMap);
+    ret->mOwnedSolution = std::move(solution);
+    return ret;
+}
+
 size_t GraphExecutorFind20::getWorkspaceSize() const
 {
     return miopen::deref(mSolution).GetWorkspaceSize();
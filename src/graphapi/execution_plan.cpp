@@ -25,15 +25,75 @@
  *******************************************************************************/
 
 #include <miopen/graphapi/execution_plan.hpp>
+#include <miopen/graphapi/opgraph.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/stringutils.hpp>
+#include <miopen/version.h>
+
+#include <nlohmann/json.hpp>
 
 namespace miopen {
 
 namespace graphapi {
 
+namespace {
+
+namespace fields {
+namespace header {
+inline constexpr const char* Validation = "validation";
+inline constexpr const char* Version    = "version";
+inline constexpr const char* Library    = "miopen";
+inline constexpr const char* Target     = "target";
+} // namespace header
+inline constexpr const char* Header          = "header";
+inline constexpr const char* Graph           = "graph";
+inline constexpr const char* GlobalIndex     = "global_index";
+inline constexpr const char* SmCount         = "sm_count";
+inline constexpr const char* IntermediateIds = "intermediate_ids";
+inline constexpr const char* Executor        = "executor";
+} // namespace fields
+
+// "MIOPENEP" in ASCII
+constexpr uint64_t validationNumber = 0x4D494F50454E4550;
+constexpr int formatVersion         = 1;
+
+std::string getLibraryVersion()
+{
+    return std::to_string(MIOPEN_VERSION_MAJOR) + "." + std::to_string(MIOPEN_VERSION_MINOR) +
+           "." + std::to_string(MIOPEN_VERSION_PATCH) + "." +
+           MIOPEN_STRINGIZE(MIOPEN_VERSION_TWEAK);
+}
+
+} // namespace
+
 std::string ExecutionPlan::getJsonRepresentation() const
 {
-    /// \todo Implement ExecutionPlan::getJsonRepresentation --Sergei May, 2024
-    return {};
+    const auto& engine = mEngineCfg.getEngine();
+    if(engine.getExecutor() == nullptr)
+    {
+        MIOPEN_THROW(miopenStatusNotInitialized, "The plan has no engine to serialize");
+    }
+
+    nlohmann::json executor;
+    engine.getExecutor()->toJson(executor);
+
+    const nlohmann::json json = {
+        {fields::Header,
+         {
+             {fields::header::Validation, validationNumber},
+             {fields::header::Version, formatVersion},
+             {fields::header::Library, getLibraryVersion()},
+             {fields::header::Target, deref(mHandle).GetTargetProperties().DbId()},
+         }},
+        {fields::Graph,
+         engine.getOpGraph() != nullptr ? engine.getOpGraph()->getCanonicalKey() : mGraphKey},
+        {fields::GlobalIndex, engine.getGlobalIndex()},
+        {fields::SmCount, engine.getSmCount()},
+        {fields::IntermediateIds, mIntermediateIds},
+        {fields::Executor, std::move(executor)},
+    };
+    return json.dump();
 }
 
 ExecutionPlanBuilder& ExecutionPlanBuilder::setHandle(miopenHandle_t handle) &
@@ -70,13 +130,80 @@ ExecutionPlanBuilder& ExecutionPlanBuilder::setIntermediateIds(std::vector<int64
 
 ExecutionPlanBuilder& ExecutionPlanBuilder::setJsonRepresentation(const std::string_view& s) &
 {
-    // TODO: Implement ExecutionPlanBuilder::setJsonRepresentation
-    (void)s;
+    MIOPEN_THROW_IF(s.empty(), "Empty execution plan representation");
+    mJson = s;
     return *this;
 }
 
+ExecutionPlanBuilder& ExecutionPlanBuilder::setOpGraph(OpGraph* graph) &
+{
+    mOpGraph = checkPtr(graph);
+    return *this;
+}
+
+void ExecutionPlanBuilder::restoreFromJson()
+{
+    const auto& handle = deref(mExecutionPlan.mHandle);
+
+    try
+    {
+        const auto json    = nlohmann::json::parse(mJson);
+        const auto& header = json.at(fields::Header);
+
+        if(header.at(fields::header::Validation).get<uint64_t>() != validationNumber)
+        {
+            MIOPEN_THROW(miopenStatusBadParm, "Not a serialized execution plan");
+        }
+        if(header.at(fields::header::Version).get<int>() != formatVersion ||
+           header.at(fields::header::Library).get<std::string>() != getLibraryVersion())
+        {
+            MIOPEN_THROW(miopenStatusVersionMismatch,
+                         "The execution plan was serialized by MIOpen " +
+                             header.at(fields::header::Library).get<std::string>());
+        }
+        const auto target = header.at(fields::header::Target).get<std::string>();
+        if(target != handle.GetTargetProperties().DbId())
+        {
+            MIOPEN_THROW(miopenStatusBadParm,
+                         "The execution plan was serialized for " + target + ", not for " +
+                             handle.GetTargetProperties().DbId());
+        }
+
+        // The executor doesn't point into the graph, so it runs on any graph with the same key
+        const auto& graph = json.at(fields::Graph);
+        auto graphKey     = graph.is_null() ? std::string{} : graph.get<std::string>();
+        if(mOpGraph != nullptr && mOpGraph->getCanonicalKey() != graphKey)
+        {
+            MIOPEN_THROW(miopenStatusBadParm,
+                         "The execution plan was serialized for another op graph");
+        }
+
+        Engine engine;
+        engine.mExecutor    = GraphExecutorFind20::fromJson(json.at(fields::Executor));
+        engine.mGraph       = mOpGraph;
+        engine.mGlobalIndex = json.at(fields::GlobalIndex).get<int64_t>();
+        engine.mSmCount     = json.at(fields::SmCount).get<int32_t>();
+
+        mExecutionPlan.mEngineCfg = EngineCfg(std::move(engine));
+        mExecutionPlan.mGraphKey  = mOpGraph == nullptr ? std::move(graphKey) : std::string{};
+        json.at(fields::IntermediateIds).get_to(mExecutionPlan.mIntermediateIds);
+        mEngineCfgSet = true;
+    }
+    catch(const nlohmann::json::exception& ex)
+    {
+        MIOPEN_THROW(miopenStatusBadParm, std::string{"Invalid execution plan: "} + ex.what());
+    }
+
+    MIOPEN_LOG_I2("Restored an execution plan from its json representation");
+    mJson.clear();
+}
+
 ExecutionPlan ExecutionPlanBuilder::build() &
 {
+    if(mExecutionPlan.mHandle != nullptr && !mJson.empty())
+    {
+        restoreFromJson();
+    }
     if(mExecutionPlan.mHandle != nullptr && mEngineCfgSet)
     {
         return mExecutionPlan;
@@ -89,6 +216,10 @@ ExecutionPlan ExecutionPlanBuilder::build() &
 
 ExecutionPlan ExecutionPlanBuilder::build() &&
 {
+    if(mExecutionPlan.mHandle != nullptr && !mJson.empty())
+    {
+        restoreFromJson();
+    }
     if(mExecutionPlan.mHandle != nullptr && mEngineCfgSet)
     {
         return std::move(mExecutionPlan);
@@ -162,6 +293,7 @@ void BackendExecutionPlanDescriptor::setAttribute(miopenBackendAttributeName_t a
         {
             std::string_view s(static_cast<char*>(arrayOfElements), elementCount);
             mBuilder.setJsonRepresentation(s);
+            mHasJson = true;
         }
         else
         {
@@ -179,6 +311,19 @@ void BackendExecutionPlanDescriptor::finalize()
     {
         MIOPEN_THROW(miopenStatusNotInitialized);
     }
+    // With a json representation, the engine config only supplies the op graph
+    if(mHasJson && mEngineCfgDescriptor != nullptr)
+    {
+        auto& engineCfgDescriptor =
+            dynamic_cast<BackendEngineCfgDescriptor&>(deref(mEngineCfgDescriptor));
+        auto* graph = engineCfgDescriptor.getEngineCfg().getEngine().getOpGraph();
+        if(graph == nullptr)
+        {
+            MIOPEN_THROW(miopenStatusBadParm,
+                         "The engine config has no op graph to restore the plan with");
+        }
+        mBuilder.setOpGraph(graph);
+    }
     mExecutionPlan = std::move(mBuilder).build();
     mFinalized     = true;
 }
@@ -209,6 +354,12 @@ void BackendExecutionPlanDescriptor::getAttribute(miopenBackendAttributeName_t a
         break;
 
     case MIOPEN_ATTR_EXECUTION_PLAN_ENGINE_CONFIG:
+        if(mEngineCfgDescriptor == nullptr)
+        {
+            MIOPEN_THROW(miopenStatusNotInitialized,
+                         "The execution plan was restored from its json representation without "
+                         "an engine config, so it has no engine config and no op graph");
+        }
         if(attributeType == MIOPEN_TYPE_BACKEND_DESCRIPTOR && requestedElementCount == 1)
         {
             *elementCount                                             = 1;
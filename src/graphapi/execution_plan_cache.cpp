@@ -0,0 +1,108 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/graphapi/execution_plan_cache.hpp>
+#include <miopen/env.hpp>
+#include <miopen/logger.hpp>
+
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_DEBUG_GRAPHAPI_PLAN_CACHE_SIZE, 256)
+
+namespace miopen {
+
+namespace graphapi {
+
+ExecutionPlanCache::ExecutionPlanCache()
+    : ExecutionPlanCache(env::value(MIOPEN_DEBUG_GRAPHAPI_PLAN_CACHE_SIZE))
+{
+}
+
+ExecutionPlanCache::ExecutionPlanCache(std::size_t capacity) : mCapacity(capacity) {}
+
+std::optional<ExecutionPlanCache::Executors> ExecutionPlanCache::get(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    const auto it = mIndex.find(key);
+    if(it == mIndex.end())
+    {
+        ++mStats.misses;
+        return std::nullopt;
+    }
+
+    ++mStats.hits;
+    mEntries.splice(mEntries.begin(), mEntries, it->second);
+    MIOPEN_LOG_I2("Execution plan cache hit, " << mStats.hits << " hits and " << mStats.misses
+                                               << " misses");
+    return it->second->second;
+}
+
+void ExecutionPlanCache::set(const std::string& key, Executors executors)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if(mCapacity == 0)
+    {
+        return;
+    }
+
+    const auto it = mIndex.find(key);
+    if(it != mIndex.end())
+    {
+        it->second->second = std::move(executors);
+        mEntries.splice(mEntries.begin(), mEntries, it->second);
+        return;
+    }
+
+    mEntries.emplace_front(key, std::move(executors));
+    mIndex.emplace(key, mEntries.begin());
+
+    while(mEntries.size() > mCapacity)
+    {
+        mIndex.erase(mEntries.back().first);
+        mEntries.pop_back();
+        ++mStats.evictions;
+        MIOPEN_LOG_I2("Execution plan cache eviction, " << mStats.evictions << " so far");
+    }
+    mStats.size = mEntries.size();
+}
+
+ExecutionPlanCache::Stats ExecutionPlanCache::getStats() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mStats;
+}
+
+void ExecutionPlanCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mEntries.clear();
+    mIndex.clear();
+    mStats.size = 0;
+}
+
+} // namespace graphapi
+
+} // namespace miopen
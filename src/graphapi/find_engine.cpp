@@ -38,12 +38,33 @@
 #include <miopen/graphapi/variant_pack.hpp>
 #include <miopen/graphapi/convolution.hpp>
 #include <miopen/graphapi/conv_bias_res_add_activ_forward_executor.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <sstream>
+#include <tuple>
 
 namespace miopen {
 namespace graphapi {
 
 GraphPatternMatcher::~GraphPatternMatcher() = default;
 
+namespace {
+
+// the Find 2.0 executors only keep the tensor ids and the solution, so the MHA engines depend
+// on nothing else than the graph key and the attention scale
+std::string attnScaleKey(float attn_scale)
+{
+    std::ostringstream ss;
+    ss << std::hexfloat << attn_scale;
+    return ss.str();
+}
+
+} // namespace
+
 class ConvBiasResAddActive_Fwd_Pattern : public GraphPatternMatcher
 {
     struct OperationPointwiseWithOneVirtualInput
@@ -123,6 +144,8 @@ public:
         return n;
     }
 
+    std::optional<size_t> signature() const final { return getPatternGraph().getSignature(); }
+
     bool matches(const OpGraph* graph_ptr) const final
     {
         assert(graph_ptr);
@@ -407,12 +430,21 @@ public:
         return n;
     }
 
+    std::optional<size_t> signature() const final { return getPatternGraph().getSignature(); }
+
     bool matches(const OpGraph* graph_ptr) const final
     {
         assert(graph_ptr);
         return isIsomorphic(*graph_ptr, getPatternGraph());
     }
 
+    std::optional<std::string> getEnginesCacheKey(const OpGraph& graph) const final
+    {
+        float attn_scale = std::numeric_limits<float>::quiet_NaN();
+        std::ignore      = extractFind20Tensors(graph, &attn_scale);
+        return attnScaleKey(attn_scale);
+    }
+
     std::vector<Engine> getEngines(OpGraph* graph_ptr) const override
     {
         assert(graph_ptr);
@@ -949,12 +981,21 @@ public:
         return n;
     }
 
+    std::optional<size_t> signature() const final { return getPatternGraph().getSignature(); }
+
     bool matches(const OpGraph* graph_ptr) const final
     {
         assert(graph_ptr);
         return isIsomorphic(*graph_ptr, getPatternGraph());
     }
 
+    std::optional<std::string> getEnginesCacheKey(const OpGraph& graph) const final
+    {
+        float attnScale = std::numeric_limits<float>::quiet_NaN();
+        std::ignore     = extractFind20Tensors(graph, &attnScale);
+        return attnScaleKey(attnScale);
+    }
+
     std::vector<Engine> getEngines(OpGraph* graphPtr) const override
     {
         assert(graphPtr);
@@ -1013,26 +1054,152 @@ public:
     }
 };
 
-std::vector<Engine> findEngines(OpGraph* graph)
+namespace {
+
+/// Looks the engines of a matched graph up in the ExecutionPlanCache of its handle, keeping
+/// the executors of the ones found otherwise
+std::vector<Engine> getEnginesCached(const GraphPatternMatcher& matcher, OpGraph* graph)
 {
-    assert(graph);
+    auto attributes = matcher.getEnginesCacheKey(*graph);
+    if(!attributes || graph->getHandle() == nullptr)
+    {
+        return matcher.getEngines(graph);
+    }
 
-    std::vector<std::unique_ptr<GraphPatternMatcher>> patterns;
-    patterns.emplace_back(MHA_Fwd_F8_Pattern::Make());
-    patterns.emplace_back(MHA_Bwd_F8_Pattern::Make());
-    patterns.emplace_back(ConvBiasResAddActive_Fwd_Pattern::Make());
+    auto& cache    = miopen::deref(graph->getHandle()).GetExecutionPlanCache();
+    const auto key =
+        std::string{matcher.name()} + '|' + *attributes + '|' + graph->getCanonicalKey();
 
-    for(const auto& p : patterns)
+    if(auto executors = cache.get(key))
     {
-        if(p->matches(graph))
+        std::vector<Engine> engines;
+        for(size_t i = 0; i < executors->size(); ++i)
         {
-            MIOPEN_LOG_I2("Matched against pattern: " << p->name());
-            return p->getEngines(graph);
+            engines.emplace_back(EngineBuilder()
+                                     .setGraph(graph)
+                                     .setExecutor((*executors)[i])
+                                     .setGlobalIndex(i)
+                                     .build());
+        }
+        return engines;
+    }
+
+    auto engines = matcher.getEngines(graph);
+
+    ExecutionPlanCache::Executors executors;
+    for(const auto& e : engines)
+    {
+        assert(e.getGlobalIndex() == static_cast<int64_t>(executors.size()));
+        executors.emplace_back(e.getExecutor());
+    }
+    cache.set(key, std::move(executors));
+    return engines;
+}
+
+} // namespace
+
+GraphPatternRegistry& GraphPatternRegistry::instance()
+{
+    static GraphPatternRegistry registry;
+    static const bool in_tree_registered = [] {
+        registry.registerMatcher(MHA_Fwd_F8_Pattern::Make());
+        registry.registerMatcher(MHA_Bwd_F8_Pattern::Make());
+        registry.registerMatcher(ConvBiasResAddActive_Fwd_Pattern::Make());
+        return true;
+    }();
+    std::ignore = in_tree_registered;
+    return registry;
+}
+
+void GraphPatternRegistry::registerMatcher(std::unique_ptr<GraphPatternMatcher> matcher)
+{
+    MIOPEN_THROW_IF(matcher == nullptr, "Null pattern matcher");
+
+    const auto signature = matcher->signature();
+
+    std::unique_lock<std::shared_mutex> lock(mMutex);
+    auto entry     = std::make_unique<Entry>();
+    entry->matcher = std::move(matcher);
+    entry->index   = mEntries.size();
+    if(signature)
+    {
+        mBySignature[*signature].emplace_back(entry.get());
+    }
+    else
+    {
+        mWildcards.emplace_back(entry.get());
+    }
+    MIOPEN_LOG_I2("Registered pattern: " << entry->matcher->name());
+    mEntries.emplace_back(std::move(entry));
+}
+
+std::vector<GraphPatternRegistry::Entry*>
+GraphPatternRegistry::getCandidates(size_t signature) const
+{
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+
+    std::vector<Entry*> ret = mWildcards;
+    const auto it           = mBySignature.find(signature);
+    if(it != mBySignature.end())
+    {
+        ret.insert(ret.end(), it->second.cbegin(), it->second.cend());
+        std::sort(ret.begin(), ret.end(), [](const Entry* l, const Entry* r) {
+            return l->index < r->index;
+        });
+    }
+    return ret;
+}
+
+std::vector<Engine> GraphPatternRegistry::findEngines(OpGraph* graph)
+{
+    assert(graph);
+
+    for(Entry* e : getCandidates(graph->getSignature()))
+    {
+        const auto start   = std::chrono::steady_clock::now();
+        const bool matched = e->matcher->matches(graph);
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start);
+
+        const auto tries = e->tries.fetch_add(1) + 1;
+        const auto hits  = e->hits.fetch_add(matched ? 1 : 0) + (matched ? 1 : 0);
+        const auto total = e->matchNs.fetch_add(elapsed.count()) + elapsed.count();
+        MIOPEN_LOG_I2("Pattern " << e->matcher->name() << (matched ? " matched" : " not matched")
+                                 << " in " << elapsed.count() / 1000.0 << " us, hits " << hits
+                                 << " of " << tries << ", total " << total / 1000.0 << " us");
+
+        if(matched)
+        {
+            MIOPEN_LOG_I2("Matched against pattern: " << e->matcher->name());
+            return getEnginesCached(*e->matcher, graph);
         }
     }
 
     return {};
 }
 
+std::vector<GraphPatternRegistry::Stats> GraphPatternRegistry::getStats() const
+{
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+
+    std::vector<Stats> ret;
+    ret.reserve(mEntries.size());
+    for(const auto& e : mEntries)
+    {
+        Stats stats;
+        stats.name      = e->matcher->name();
+        stats.tries     = e->tries.load();
+        stats.hits      = e->hits.load();
+        stats.matchTime = std::chrono::nanoseconds{e->matchNs.load()};
+        ret.emplace_back(std::move(stats));
+    }
+    return ret;
+}
+
+std::vector<Engine> findEngines(OpGraph* graph)
+{
+    return GraphPatternRegistry::instance().findEngines(graph);
+}
+
 } // end namespace graphapi
 } // end namespace miopen
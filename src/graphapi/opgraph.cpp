@@ -28,14 +28,235 @@
 #include <miopen/graphapi/opgraph.hpp>
 #include <miopen/graphapi/engine.hpp>
 
+#include <algorithm>
 #include <deque>
+#include <sstream>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace miopen {
 namespace graphapi {
 
 OpNode::~OpNode() = default;
 
+namespace internal {
+
+/// Weisfeiler-Lehman colors of the nodes, including the source and the sink. A node starts
+/// with the hash of its name and is then recolored with the sorted colors of its in and out
+/// neighbours, one entry per edge, until the number of distinct colors stops growing.
+/// Input slots are not part of the colors because the patterns accept commutative operands
+/// in either order.
+struct NodeColors
+{
+    std::vector<const OpNode*> nodes;
+    std::unordered_map<const OpNode*, size_t> indices;
+    std::vector<size_t> colors;
+};
+
+size_t hashCombine(size_t seed, size_t value)
+{
+    // splitmix64 finalizer of the combined value
+    uint64_t x = seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+    x          = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x          = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return static_cast<size_t>(x ^ (x >> 31));
+}
+
+size_t countDistinct(std::vector<size_t> values)
+{
+    std::sort(values.begin(), values.end());
+    return std::unique(values.begin(), values.end()) - values.begin();
+}
+
+NodeColors computeColors(const OpGraph& graph)
+{
+    NodeColors ret;
+    ret.nodes.emplace_back(graph.getSourceNode());
+    ret.nodes.emplace_back(graph.getSinkNode());
+    ret.nodes.insert(ret.nodes.end(), graph.getNodes().cbegin(), graph.getNodes().cend());
+
+    for(size_t i = 0; i < ret.nodes.size(); ++i)
+    {
+        ret.indices.emplace(ret.nodes[i], i);
+        ret.colors.emplace_back(std::hash<std::string>{}(ret.nodes[i]->signName()));
+    }
+
+    auto num_colors = countDistinct(ret.colors);
+    std::vector<size_t> neighbours;
+    for(size_t iter = 0; iter < ret.nodes.size(); ++iter)
+    {
+        std::vector<size_t> next(ret.colors.size());
+        for(size_t i = 0; i < ret.nodes.size(); ++i)
+        {
+            const OpNode* n = ret.nodes[i];
+            size_t color    = ret.colors[i];
+            for(const auto* edges : {&graph.getInEdges(n), &graph.getOutEdges(n)})
+            {
+                neighbours.clear();
+                for(const auto& [m, t] : *edges)
+                {
+                    std::ignore = t;
+                    neighbours.emplace_back(ret.colors[ret.indices.at(m)]);
+                }
+                std::sort(neighbours.begin(), neighbours.end());
+                color = hashCombine(color, neighbours.size());
+                for(size_t c : neighbours)
+                {
+                    color = hashCombine(color, c);
+                }
+            }
+            next[i] = color;
+        }
+
+        ret.colors         = std::move(next);
+        const auto refined = countDistinct(ret.colors);
+        if(refined == num_colors)
+        {
+            break;
+        }
+        num_colors = refined;
+    }
+
+    return ret;
+}
+
+size_t computeFingerprint(const OpGraph& graph)
+{
+    auto colors = computeColors(graph).colors;
+    std::sort(colors.begin(), colors.end());
+
+    size_t ret = hashCombine(graph.numNodes(), graph.numEdges());
+    for(size_t c : colors)
+    {
+        ret = hashCombine(ret, c);
+    }
+    return ret;
+}
+
+size_t computeSignature(const OpGraph& graph)
+{
+    std::vector<size_t> names;
+    for(const OpNode* n : graph.getNodes())
+    {
+        names.emplace_back(std::hash<std::string>{}(n->signName()));
+    }
+    std::sort(names.begin(), names.end());
+
+    size_t ret = hashCombine(graph.numNodes(), graph.numEdges());
+    for(size_t h : names)
+    {
+        ret = hashCombine(ret, h);
+    }
+    return ret;
+}
+
+size_t countEdges(const std::vector<Edge>& edges, const OpNode* dst)
+{
+    return std::count_if(
+        edges.cbegin(), edges.cend(), [dst](const Edge& e) { return e.first == dst; });
+}
+
+/// Exact check: maps the left nodes in breadth first order from the source to the right nodes
+/// of the same color, backtracking when the edges to the already mapped nodes differ.
+class IsomorphismMatcher
+{
+    const OpGraph& mLeft;
+    const OpGraph& mRight;
+    NodeColors mLeftColors;
+    NodeColors mRightColors;
+    std::vector<const OpNode*> mOrder;
+    std::unordered_map<const OpNode*, const OpNode*> mMapping;
+    std::unordered_set<const OpNode*> mUsed;
+
+    bool isConsistent(const OpNode* l, const OpNode* r) const
+    {
+        for(const auto& [l_other, r_other] : mMapping)
+        {
+            if(countEdges(mLeft.getOutEdges(l), l_other) !=
+                   countEdges(mRight.getOutEdges(r), r_other) ||
+               countEdges(mLeft.getOutEdges(l_other), l) !=
+                   countEdges(mRight.getOutEdges(r_other), r))
+            {
+                return false;
+            }
+        }
+        return countEdges(mLeft.getOutEdges(l), l) == countEdges(mRight.getOutEdges(r), r);
+    }
+
+    bool match(size_t pos)
+    {
+        if(pos == mOrder.size())
+        {
+            return true;
+        }
+
+        const OpNode* l    = mOrder[pos];
+        const size_t color = mLeftColors.colors[mLeftColors.indices.at(l)];
+        for(size_t i = 0; i < mRightColors.nodes.size(); ++i)
+        {
+            const OpNode* r = mRightColors.nodes[i];
+            if(mRightColors.colors[i] != color || mUsed.count(r) != 0 || !isConsistent(l, r))
+            {
+                continue;
+            }
+
+            mMapping.emplace(l, r);
+            mUsed.insert(r);
+            if(match(pos + 1))
+            {
+                return true;
+            }
+            mMapping.erase(l);
+            mUsed.erase(r);
+        }
+        return false;
+    }
+
+public:
+    IsomorphismMatcher(const OpGraph& left, const OpGraph& right)
+        : mLeft(left),
+          mRight(right),
+          mLeftColors(computeColors(left)),
+          mRightColors(computeColors(right))
+    {
+        std::unordered_set<const OpNode*> visited{left.getSourceNode()};
+        std::deque<const OpNode*> to_visit{left.getSourceNode()};
+        while(!to_visit.empty())
+        {
+            const OpNode* n = to_visit.front();
+            to_visit.pop_front();
+            mOrder.emplace_back(n);
+            for(const auto& [dst, t] : left.getOutEdges(n))
+            {
+                std::ignore = t;
+                if(visited.insert(dst).second)
+                {
+                    to_visit.emplace_back(dst);
+                }
+            }
+        }
+        // nodes without inputs from the source are not reachable from it
+        for(const OpNode* n : mLeftColors.nodes)
+        {
+            if(visited.insert(n).second)
+            {
+                mOrder.emplace_back(n);
+            }
+        }
+    }
+
+    bool run()
+    {
+        if(mLeftColors.nodes.size() != mRightColors.nodes.size())
+        {
+            return false;
+        }
+        return match(0);
+    }
+};
+
+} // end namespace internal
+
 OpGraph OpGraphBuilder::build() &&
 {
     if(mNodes.empty())
@@ -99,6 +320,9 @@ OpGraph OpGraphBuilder::build() &&
         }
     }
 
+    graph.mSignature   = internal::computeSignature(graph);
+    graph.mFingerprint = internal::computeFingerprint(graph);
+
     return graph;
 }
 
@@ -117,6 +341,48 @@ void OpGraph::initEngines()
     mEngines = findEngines(this);
 }
 
+std::string OpGraph::getCanonicalKey() const
+{
+    const auto describe = [](std::ostream& os, const std::vector<Tensor*>& tensors) {
+        for(const Tensor* t : tensors)
+        {
+            os << t->getId() << ':' << t->GetType() << (t->isVirtual() ? "v" : "") << '[';
+            for(auto len : t->GetLengths())
+            {
+                os << len << ',';
+            }
+            os << '/';
+            for(auto stride : t->GetStrides())
+            {
+                os << stride << ',';
+            }
+            os << ']';
+        }
+    };
+
+    std::vector<std::string> nodes;
+    nodes.reserve(numNodes());
+    for(const OpNode* n : mNodes)
+    {
+        std::ostringstream ss;
+        ss << n->signName() << '(';
+        describe(ss, n->getInTensors());
+        ss << ")->(";
+        describe(ss, n->getOutTensors());
+        ss << ')';
+        nodes.emplace_back(ss.str());
+    }
+    std::sort(nodes.begin(), nodes.end());
+
+    std::string ret;
+    for(const auto& n : nodes)
+    {
+        ret += n;
+        ret += ';';
+    }
+    return ret;
+}
+
 VecOfPaths OpGraph::getAllPaths() const
 {
     /// \todo does not check for cycles. Use DFS to first check for cycles
@@ -164,119 +430,6 @@ std::string pathToStr(const Path& path)
     return oss.str();
 }
 
-namespace internal {
-
-using MapSizeToPathVec = std::unordered_map<size_t, VecOfPaths>;
-
-bool checkSameNodesByName(const OpGraph& left, const OpGraph& right)
-{
-    auto l_names = left.getNodeNames();
-    auto r_names = right.getNodeNames();
-    if(l_names.size() != r_names.size())
-    {
-        return false;
-    }
-
-    std::sort(l_names.begin(), l_names.end());
-    std::sort(r_names.begin(), r_names.end());
-
-    return l_names == r_names;
-}
-
-bool checkSameDegreeVecs(const OpGraph& left, const OpGraph& right)
-{
-    auto l_degs = left.getInOutDegrees();
-    auto r_degs = right.getInOutDegrees();
-
-    std::sort(l_degs.begin(), l_degs.end());
-    std::sort(r_degs.begin(), r_degs.end());
-    return l_degs == r_degs;
-}
-
-auto groupBySize(VecOfPaths&& all_paths)
-{
-    MapSizeToPathVec paths_by_size;
-
-    for(auto& p : all_paths)
-    {
-        auto [it, _ignore] = paths_by_size.emplace(p.size(), VecOfPaths{});
-        it->second.emplace_back(std::move(p));
-    }
-
-    return paths_by_size;
-}
-
-bool checkSamePathVecs(const VecOfPaths& left, const VecOfPaths& right)
-{
-    if(left.size() != right.size())
-    {
-        return false;
-    }
-
-    using VecOfStr = std::vector<std::string>;
-
-    auto pathvec_to_strvec = [](const VecOfPaths& pathvec) {
-        VecOfStr ret;
-        for(const Path& path : pathvec)
-        {
-            ret.emplace_back(pathToStr(path));
-        }
-        return ret;
-    };
-
-    VecOfStr l_paths_as_str = pathvec_to_strvec(left);
-    VecOfStr r_paths_as_str = pathvec_to_strvec(right);
-
-    std::sort(l_paths_as_str.begin(), l_paths_as_str.end());
-    std::sort(r_paths_as_str.begin(), r_paths_as_str.end());
-
-    return l_paths_as_str == r_paths_as_str;
-}
-
-bool checkSamePaths(const OpGraph& left, const OpGraph& right)
-{
-
-    auto l_paths = left.getAllPaths();
-    auto r_paths = right.getAllPaths();
-
-    if(l_paths.size() != r_paths.size())
-    {
-        return false;
-    }
-
-    auto l_paths_by_sz = groupBySize(std::move(l_paths));
-    auto r_paths_by_sz = groupBySize(std::move(r_paths));
-
-    auto get_keys = [](const MapSizeToPathVec& paths_by_size) {
-        std::vector<size_t> keys{};
-        for(const auto& [k, v] : paths_by_size)
-        {
-            keys.emplace_back(k);
-        }
-        return keys;
-    };
-
-    auto l_keys = get_keys(l_paths_by_sz);
-    auto r_keys = get_keys(r_paths_by_sz);
-
-    if(l_keys != r_keys)
-    {
-        return false;
-    }
-
-    for(size_t k : l_keys)
-    {
-        if(!checkSamePathVecs(l_paths_by_sz[k], r_paths_by_sz[k]))
-        {
-            return false;
-        }
-    }
-
-    return true;
-}
-
-} // end namespace internal
-
 bool isIsomorphic(const OpGraph& left, const OpGraph& right)
 {
     if(left.numNodes() != right.numNodes())
@@ -291,21 +444,15 @@ bool isIsomorphic(const OpGraph& left, const OpGraph& right)
         return false;
     }
 
-    if(!internal::checkSameNodesByName(left, right))
-    {
-        MIOPEN_LOG_I2("test failed due to node names being different");
-        return false;
-    }
-
-    if(!internal::checkSameDegreeVecs(left, right))
+    if(left.getFingerprint() != right.getFingerprint())
     {
-        MIOPEN_LOG_I2("test failed due to node degrees being different");
+        MIOPEN_LOG_I2("test failed due to fingerprints being different");
         return false;
     }
 
-    if(!internal::checkSamePaths(left, right))
+    if(!internal::IsomorphismMatcher{left, right}.run())
     {
-        MIOPEN_LOG_I2("test failed due to paths being different");
+        MIOPEN_LOG_I2("test failed due to no node mapping preserving the edges");
         return false;
     }
 
@@ -88,6 +88,17 @@ extern "C" miopenStatus_t miopenCreateWithStream(miopenHandle_t* handle,
     });
 }
 
+extern "C" miopenStatus_t miopenCreateChildHandle(miopenHandle_t* handle,
+                                                  miopenHandle_t parent,
+                                                  miopenAcceleratorQueue_t stream)
+{
+
+    return miopen::try_([&] {
+        auto& h = miopen::deref(handle);
+        h       = new miopen::Handle(miopen::deref(parent), stream);
+    });
+}
+
 extern "C" miopenStatus_t miopenSetStream(miopenHandle_t handle, miopenAcceleratorQueue_t streamID)
 {
     return miopen::try_([&] { miopen::deref(handle).SetStream(streamID); });
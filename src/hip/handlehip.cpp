@@ -37,6 +37,7 @@
 #include <miopen/stringutils.hpp>
 #include <miopen/target_properties.hpp>
 #include <miopen/timer.hpp>
+#include <miopen/trace.hpp>
 
 #if !MIOPEN_ENABLE_SQLITE_KERN_CACHE
 #include <miopen/write_file.hpp>
@@ -286,7 +287,7 @@ struct HandleImpl
     float profiling_result = 0.0;
     int device             = -1;
     Allocator allocator{};
-    KernelCache cache;
+    std::shared_ptr<KernelCache> cache = std::make_shared<KernelCache>();
     TargetProperties target_properties;
 };
 
@@ -313,6 +314,7 @@ Handle::Handle(miopenAcceleratorQueue_t stream) : impl(std::make_unique<HandleIm
     this->impl->hip_blasLt_handle = CreateHipblasLtHandle();
 #endif
     this->impl->target_properties.Init(this);
+    this->decision_tables = std::make_shared<conv::DecisionTableCache>(*this);
     MIOPEN_LOG_NQI(*this);
 }
 
@@ -340,9 +342,56 @@ Handle::Handle() : impl(std::make_unique<HandleImpl>())
     this->impl->hip_blasLt_handle = CreateHipblasLtHandle();
 #endif
     this->impl->target_properties.Init(this);
+    this->decision_tables = std::make_shared<conv::DecisionTableCache>(*this);
     MIOPEN_LOG_NQI(*this);
 }
 
+Handle::Handle(const Handle& parent, miopenAcceleratorQueue_t stream)
+    : impl(std::make_unique<HandleImpl>()),
+      invokers(parent.invokers),
+      applicability(parent.applicability),
+      decision_tables(parent.decision_tables),
+      execution_plans(parent.execution_plans)
+{
+    meopenHandle_current_stream_id = 0;
+    this->impl->device             = get_device_id();
+
+    // The code objects are loaded into the parent's device.
+    if(this->impl->device != parent.impl->device)
+    {
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "The current device " + std::to_string(this->impl->device) +
+                         " differs from the device of the parent handle " +
+                         std::to_string(parent.impl->device));
+    }
+
+    this->impl->root_stream = HandleImpl::reference_stream(stream);
+    this->impl->extra_stream_map.emplace(stream, HandleImpl::MultiStreamResourses());
+    this->impl->ms_resourse_ptr = &(this->impl->extra_stream_map.begin()->second);
+
+    this->impl->cache             = parent.impl->cache;
+    this->impl->allocator         = parent.impl->allocator;
+    this->impl->target_properties = parent.impl->target_properties;
+
+#if MIOPEN_USE_ROCBLAS
+    this->impl->rhandle_ = CreateRocblasHandle(stream);
+#endif
+#if MIOPEN_USE_HIPBLASLT
+    this->impl->hip_blasLt_handle = CreateHipblasLtHandle();
+#endif
+    MIOPEN_LOG_NQI(*this);
+}
+
+std::unique_ptr<Handle> Handle::CreateChild(const Handle& parent)
+{
+    // Not ordered with the legacy default stream either, which the application may be using.
+    auto stream = parent.impl->create_stream_non_blocking();
+    auto child  = std::make_unique<Handle>(parent, stream.get());
+    // The child references the stream so far, let it own it.
+    child->impl->root_stream = std::move(stream);
+    return child;
+}
+
 Handle::~Handle() {}
 
 // not MT safe
@@ -468,7 +517,7 @@ KernelInvoke Handle::AddKernel(const std::string& algorithm,
                                std::size_t cache_index,
                                const std::string& kernel_src) const
 {
-    auto obj = this->impl->cache.AddKernel(*this,
+    auto obj = this->impl->cache->AddKernel(*this,
                                            algorithm,
                                            network_config,
                                            program_name,
@@ -497,7 +546,7 @@ Invoker Handle::PrepareInvoker(const InvokerFactory& factory,
 
         MIOPEN_LOG_I2("Preparing kernel: " << k.kernel_name);
 
-        const auto kernel = this->impl->cache.AddKernel(*this,
+        const auto kernel = this->impl->cache->AddKernel(*this,
                                                         "",
                                                         "",
                                                         k.kernel_file,
@@ -515,13 +564,13 @@ Invoker Handle::PrepareInvoker(const InvokerFactory& factory,
 
 void Handle::ClearKernels(const std::string& algorithm, const std::string& network_config) const
 {
-    this->impl->cache.ClearKernels(algorithm, network_config);
+    this->impl->cache->ClearKernels(algorithm, network_config);
 }
 
-const std::vector<Kernel>& Handle::GetKernelsImpl(const std::string& algorithm,
-                                                  const std::string& network_config) const
+std::shared_ptr<const std::vector<Kernel>>
+Handle::GetKernelsImpl(const std::string& algorithm, const std::string& network_config) const
 {
-    return this->impl->cache.GetKernels(algorithm, network_config);
+    return this->impl->cache->GetKernels(algorithm, network_config);
 }
 
 KernelInvoke Handle::Run(Kernel k, bool coop_launch) const
@@ -538,6 +587,7 @@ Program Handle::LoadProgram(const fs::path& program_name,
                             const std::string& kernel_src,
                             bool force_attach_binary) const
 {
+    MIOPEN_TRACE_SCOPE_DETAIL("compile", "LoadProgram", program_name.string());
     this->impl->set_ctx();
     std::string arch_name = this->GetTargetProperties().Name();
 
@@ -653,17 +703,17 @@ Program Handle::LoadProgram(const fs::path& program_name,
 
 bool Handle::HasProgram(const fs::path& program_name, const std::string& params) const
 {
-    return this->impl->cache.HasProgram(program_name, params);
+    return this->impl->cache->HasProgram(program_name, params);
 }
 
 void Handle::AddProgram(Program prog, const fs::path& program_name, const std::string& params) const
 {
-    this->impl->cache.AddProgram(prog, program_name, params);
+    this->impl->cache->AddProgram(prog, program_name, params);
 }
 
 void Handle::ClearProgram(const fs::path& program_name, const std::string& params) const
 {
-    this->impl->cache.ClearProgram(program_name, params);
+    this->impl->cache->ClearProgram(program_name, params);
 }
 
 void Handle::Finish() const
@@ -32,6 +32,7 @@
 #include <miopen/env.hpp>
 #include <miopen/solver/implicitgemm_util.hpp>
 #include <miopen/target_properties.hpp>
+#include <miopen/trace.hpp>
 #include <boost/optional.hpp>
 #include <sstream>
 #include <string>
@@ -114,6 +115,7 @@ static fs::path HipBuildImpl(const TmpDir& tmp_dir,
                              const TargetProperties& target,
                              const bool testing_mode)
 {
+    MIOPEN_TRACE_SCOPE_DETAIL("compile", "HipBuildImpl", filename.string());
     // Write out the include files
     // Let's assume includes are overkill for feature tests & optimize'em out.
     if(!testing_mode)
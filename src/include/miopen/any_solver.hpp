@@ -80,6 +80,13 @@ struct AnySolver
         assert(ptr_value != nullptr);
         return ptr_value->GetWti(ctx, problem);
     };
+    miopen::conv::RooflineParams
+    GetRooflineParams(const ExecutionContext& ctx,
+                      const miopen::conv::ProblemDescription& problem) const
+    {
+        assert(ptr_value != nullptr);
+        return ptr_value->GetRooflineParams(ctx, problem);
+    };
     const std::type_info& Type() const
     {
         assert(ptr_value != nullptr);
@@ -146,6 +153,9 @@ struct AnySolver
         virtual bool IsDynamic() const                                                         = 0;
         virtual float GetWti(const ExecutionContext& ctx,
                              const miopen::conv::ProblemDescription& problem) const            = 0;
+        virtual miopen::conv::RooflineParams
+        GetRooflineParams(const ExecutionContext& ctx,
+                          const miopen::conv::ProblemDescription& problem) const               = 0;
         virtual const std::type_info& Type() const                                             = 0;
         virtual std::string GetSolverDbId() const                                              = 0;
         virtual ConvSolution FindSolution(const ExecutionContext& ctx,
@@ -299,6 +309,12 @@ struct AnySolver
         {
             return value.GetWti(ctx, problem);
         }
+        miopen::conv::RooflineParams
+        GetRooflineParams(const ExecutionContext& ctx,
+                          const miopen::conv::ProblemDescription& problem) const override
+        {
+            return value.GetRooflineParams(ctx, problem);
+        }
 
         ConvSolution FindSolution(const ExecutionContext& ctx,
                                   const miopen::conv::ProblemDescription& problem,
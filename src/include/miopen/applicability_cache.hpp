@@ -0,0 +1,121 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/solver_id.hpp>
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace miopen {
+
+struct ExecutionContext;
+
+namespace conv {
+struct ProblemDescription;
+} // namespace conv
+
+/// Remembers which solvers are applicable to a problem, so that IsApplicable() is computed once
+/// per problem and not on every GetSolutions(), GetSolutionCount() or GetWorkspaceSize() call.
+/// Each handle owns one. Optionally it is backed by a file next to the user perf-db.
+class MIOPEN_INTERNALS_EXPORT ApplicabilityCache
+{
+public:
+    /// Bitsets indexed by solver::Id::Value().
+    struct Entry
+    {
+        std::vector<std::uint64_t> checked;
+        std::vector<std::uint64_t> applicable;
+
+        std::optional<bool> Get(std::uint64_t solver_id) const;
+        void Set(std::uint64_t solver_id, bool is_applicable);
+        void Merge(const Entry& other);
+        std::string ToString() const;
+        static std::optional<Entry> FromString(const std::string& str);
+    };
+
+    ApplicabilityCache() = default;
+    ApplicabilityCache(const ApplicabilityCache&) = delete;
+    ApplicabilityCache& operator=(const ApplicabilityCache&) = delete;
+    ~ApplicabilityCache();
+
+    /// Backs the cache with the file at path. Only the first call has effect. The file is ignored
+    /// if it was written for another version, i.e. by another build or for another target.
+    void Open(const fs::path& path, const std::string& version);
+    Entry Get(const std::string& key) const;
+    void Set(const std::string& key, std::uint64_t solver_id, bool is_applicable);
+    /// Merges the new results into the file. Is also done on destruction.
+    void Save();
+
+private:
+    using Entries = std::unordered_map<std::string, Entry>;
+
+    Entries Load() const;
+
+    mutable std::shared_mutex mutex;
+    std::once_flag opened;
+    fs::path path;
+    std::string version;
+    Entries entries;
+    Entries unsaved;
+};
+
+/// Answers IsApplicable() for one convolution problem. The known results are taken from the
+/// cache of the context's handle in one lookup; the unknown ones are computed and recorded.
+class MIOPEN_INTERNALS_EXPORT ConvApplicability
+{
+public:
+    ConvApplicability(const ExecutionContext& ctx_, const conv::ProblemDescription& problem_);
+
+    bool IsApplicable(solver::Id solver_id);
+
+private:
+    const ExecutionContext& ctx;
+    const conv::ProblemDescription& problem;
+    ApplicabilityCache* cache = nullptr;
+    std::string key;
+    ApplicabilityCache::Entry entry;
+};
+
+/// The cache key of a problem. Covers everything IsApplicable() implementations read: the whole
+/// problem including strides, alpha/beta and the convolution attributes, the context flags and
+/// the environment.
+MIOPEN_INTERNALS_EXPORT std::string GetApplicabilityKey(const ExecutionContext& ctx,
+                                                        const conv::ProblemDescription& problem);
+
+/// Identifies the MIOPEN_DEBUG_* environment, which many IsApplicable() implementations depend on.
+/// Computed again only after the environment has been changed through miopen::env.
+MIOPEN_INTERNALS_EXPORT std::string GetApplicabilityEnvFingerprint();
+
+} // namespace miopen
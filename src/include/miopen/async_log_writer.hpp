@@ -0,0 +1,84 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/config.hpp>
+#include <miopen/mt_queue.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <thread>
+
+namespace miopen {
+
+/// Writes the formatted log messages to a stream on a background thread, so the logging threads
+/// do not wait for the output. The messages are queued in a bounded lock-free queue. When it is
+/// full, new messages are dropped and counted, and the count is reported in the output.
+class MIOPEN_INTERNALS_EXPORT AsyncLogWriter
+{
+public:
+    AsyncLogWriter(std::ostream& stream_, std::size_t capacity);
+    AsyncLogWriter(const AsyncLogWriter&)            = delete;
+    AsyncLogWriter& operator=(const AsyncLogWriter&) = delete;
+    ~AsyncLogWriter();
+
+    /// Queues the message. Returns false, leaving the message as it was, once the writer has been
+    /// stopped and the caller has to write it itself.
+    bool Write(std::string& message);
+    /// Blocks until the messages queued so far have been written.
+    void Flush();
+    /// Writes the queued messages and stops the background thread.
+    void Stop();
+    /// Takes a queued message out for writing it directly, e.g. from a crash handler.
+    std::optional<std::string> TakeQueued() { return queue.try_pop(); }
+
+    std::size_t GetDroppedCount() const { return dropped_total.load(std::memory_order_relaxed); }
+
+private:
+    std::ostream& stream;
+    ThreadSafeQueue<std::string> queue;
+    std::atomic<bool> stopped{false};
+    std::atomic<std::size_t> dropped{0};
+    std::atomic<std::size_t> dropped_total{0};
+    std::atomic<std::size_t> queued{0};
+    std::size_t written = 0;
+    bool finished       = false;
+    std::mutex written_mutex;
+    std::condition_variable written_cv;
+    std::mutex stop_mutex;
+    std::thread thread;
+
+    void Run();
+    void WriteBatch(std::string& batch, std::size_t count);
+};
+
+} // namespace miopen
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <miopen/problem_description_base.hpp>
+#include <miopen/problem_key.hpp>
 #include <miopen/activ.hpp>
 #include <miopen/tensor.hpp>
 #include <miopen/mlo_internal.hpp>
@@ -189,6 +190,7 @@ struct MIOPEN_INTERNALS_EXPORT ProblemDescription : ProblemDescriptionBase, Prob
     bool IsFp16() const { return xDesc.GetType() == miopenHalf; }
     bool IsBfp16() const { return xDesc.GetType() == miopenBFloat16; }
 
+    ProblemKey MakeKey() const;
     NetworkConfig MakeNetworkConfig() const override;
 
     // This declaration marks batchnorm as a primitive with tuning enabled.
@@ -75,6 +75,12 @@ class Model;
 MIOPEN_INTERNALS_EXPORT std::vector<uint64_t> PredictSolver(const conv::ProblemDescription& problem,
                                                             const ExecutionContext& ctx,
                                                             const std::string& device);
+/// Predicts the solvers of many problems with one batched forward pass. The results are kept in
+/// the same cache as PredictSolver, so that later queries for these problems do not run the model.
+MIOPEN_INTERNALS_EXPORT std::vector<std::vector<uint64_t>>
+PredictSolvers(const std::vector<conv::ProblemDescription>& problems,
+               const ExecutionContext& ctx,
+               const std::string& device);
 } // namespace immed_mode
 
 #endif // MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
@@ -88,12 +94,22 @@ struct Metadata
     Metadata(const std::string& arch, const std::string& solver);
 };
 
-bool ModelSetParams(const std::string& arch,
-                    const std::string& solver,
-                    conv::Direction direction,
-                    const std::vector<float>& features,
-                    bool transform_features,
-                    std::function<bool(std::size_t, std::string)> validator);
+MIOPEN_INTERNALS_EXPORT bool
+ModelSetParams(const std::string& arch,
+               const std::string& solver,
+               conv::Direction direction,
+               const std::vector<float>& features,
+               bool transform_features,
+               std::function<bool(std::size_t, std::string)> validator);
+/// Batched ModelSetParams: the decoder runs once per parameter position for all the problems
+/// which still have parameters to set. Returns whether the parameters of each problem were set.
+MIOPEN_INTERNALS_EXPORT std::vector<bool>
+ModelSetParams(const std::string& arch,
+               const std::string& solver,
+               conv::Direction direction,
+               const std::vector<std::vector<float>>& features,
+               bool transform_features,
+               const std::vector<std::function<bool(std::size_t, std::string)>>& validators);
 } // namespace tuning
 #endif // MIOPEN_ENABLE_AI_KERNEL_TUNING
 } // namespace ai
@@ -0,0 +1,144 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <nlohmann/json_fwd.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace miopen {
+namespace ai {
+
+/// A Keras functional model compiled from its frugally-deep JSON into a flat list of operations
+/// over a single float arena. Supports the layers used by TunaNet and KernelTuningNet: Dense,
+/// ReLU, Add, Embedding and LSTM.
+///
+/// Weights of the matrix products are packed in blocks of `lanes` output columns, so the inner
+/// loop of every layer is a multiply-add of a contiguous SIMD vector. LSTM input and recurrent
+/// weights are packed into one matrix, one product per time step.
+class MIOPEN_INTERNALS_EXPORT CompiledModel
+{
+public:
+    static constexpr uint32_t version = 1;
+    static constexpr std::size_t lanes = 8;
+
+    using Tensor  = std::vector<float>;
+    using Tensors = std::vector<Tensor>;
+
+    /// Reference inputs and outputs stored with the model by the converter from Keras.
+    struct TestCase
+    {
+        Tensors inputs;
+        Tensors outputs;
+    };
+
+    CompiledModel() = default;
+
+    static CompiledModel FromJson(const nlohmann::json& json);
+    static CompiledModel FromJsonFile(const fs::path& path);
+    static CompiledModel FromBinaryFile(const fs::path& path);
+    void SaveBinary(const fs::path& path) const;
+
+    /// Prefers the binary made at build time by tools/ai_model_compiler, <path>.bin, and
+    /// compiles the JSON if there is none or it was made by another version.
+    static CompiledModel Load(const fs::path& path);
+
+    /// Inputs and outputs are flattened row-major tensors in the order of the model.
+    /// Thread-safe.
+    Tensors Predict(const Tensors& inputs) const;
+    /// Runs one forward pass for all the items, which shares the weight loads between them.
+    std::vector<Tensors> PredictBatch(const std::vector<Tensors>& batch) const;
+
+    const std::vector<std::vector<std::size_t>>& GetInputShapes() const { return input_shapes; }
+    const std::vector<TestCase>& GetTests() const { return tests; }
+    /// The maximum difference of the outputs from the test cases, relative to max(1, |expected|).
+    float MaxTestError() const;
+
+    enum class OpKind : uint32_t
+    {
+        Dense,
+        Relu,
+        Add,
+        Embedding,
+        Lstm,
+    };
+
+    enum class Activation : uint32_t
+    {
+        Linear,
+        Relu,
+        Sigmoid,
+        HardSigmoid,
+        Tanh,
+    };
+
+    /// Offsets are into the arena, except for the weights and bias ones that are into params.
+    struct Op
+    {
+        static constexpr uint32_t none = UINT32_MAX;
+
+        OpKind kind                     = OpKind::Dense;
+        Activation activation           = Activation::Linear;
+        Activation recurrent_activation = Activation::Sigmoid;
+        uint32_t steps                  = 1;
+        uint32_t in_size                = 0; // per step, the vocabulary size for Embedding
+        uint32_t out_size               = 0; // per step, the units for Lstm
+        uint32_t in[3]                  = {none, none, none};
+        uint32_t out[3]                 = {none, none, none};
+        uint32_t weights                = none;
+        uint32_t bias                   = none;
+        uint32_t scratch                = none;
+    };
+
+private:
+    struct Buffer
+    {
+        uint64_t offset = 0;
+        uint64_t size   = 0;
+    };
+
+    std::vector<Op> ops;
+    std::vector<float> params;
+    std::vector<Buffer> inputs;
+    std::vector<Buffer> outputs;
+    std::vector<std::vector<std::size_t>> input_shapes;
+    std::size_t arena_size = 0;
+    std::vector<TestCase> tests;
+
+    void Validate() const;
+
+    friend class ModelCompiler;
+};
+
+} // namespace ai
+} // namespace miopen
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/problem_key.hpp>
+#include <miopen/solver_id.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+
+struct ExecutionContext;
+struct Handle;
+
+namespace conv {
+
+struct ProblemDescription;
+
+/// Fields of a convolution problem parsed back from its find-db key,
+/// see ProblemDescription::Serialize().
+struct MIOPEN_INTERNALS_EXPORT DbKeyFields
+{
+    std::size_t spatial_dims = 2;
+    std::size_t in_channels  = 0;
+    std::size_t out_channels = 0;
+    std::size_t batch_size   = 0;
+    std::vector<std::size_t> in_spatial; // [D]HW
+    std::vector<std::size_t> out_spatial;
+    std::vector<std::size_t> filter;
+    std::vector<std::size_t> pads;
+    std::vector<std::size_t> strides;
+    std::vector<std::size_t> dilations;
+    int bias = 0;
+    std::vector<std::string> layouts; // either one for all the tensors or in, weights, out
+    std::string data_types;
+    std::string direction;
+    std::size_t group_count = 1;
+    std::string cast_types;
+
+    static std::optional<DbKeyFields> Parse(const std::string& db_key);
+    /// The same fields as Parse() of the problem's db key, without formatting it. std::nullopt
+    /// if Parse() would reject the key, e.g. for negative pads.
+    static std::optional<DbKeyFields> FromProblem(const ProblemDescription& problem);
+};
+
+/// Maps quantized problem features to a ranked list of solvers, so the immediate mode fallback
+/// can answer without running the model or checking every solver. The tables are generated
+/// offline per target from find-db contents by tools/decision_table.
+class MIOPEN_INTERNALS_EXPORT DecisionTable
+{
+public:
+    static constexpr int version = 1;
+
+    /// The problem class (direction, data types, layouts, dimensions) and the quantized sizes.
+    static std::string MakeKey(const DbKeyFields& fields);
+    static std::optional<std::string> MakeKey(const std::string& db_key);
+
+    /// Returns nullptr if the table has no entry for the key.
+    const std::vector<solver::Id>* Find(const std::string& key) const;
+    void Set(const std::string& key, std::vector<solver::Id> solvers);
+    std::size_t Size() const { return entries.size(); }
+
+    bool Load(const fs::path& path);
+    void Save(const fs::path& path) const;
+
+private:
+    std::unordered_map<std::string, std::vector<solver::Id>> entries;
+};
+
+/// Ranks the solvers of each table entry by how often they were the fastest in the find-db
+/// records falling into it, then by their mean time relative to the fastest one.
+class MIOPEN_INTERNALS_EXPORT DecisionTableBuilder
+{
+public:
+    /// Adds one find-db record. Returns false if the key can't be parsed.
+    bool Add(const std::string& db_key, const std::vector<std::pair<solver::Id, float>>& times);
+    DecisionTable Build(std::size_t max_solvers = 8) const;
+
+private:
+    struct SolverStats
+    {
+        std::size_t wins      = 0;
+        std::size_t records   = 0;
+        double relative_times = 0.0;
+    };
+
+    std::unordered_map<std::string, std::unordered_map<uint64_t, SolverStats>> entries;
+};
+
+/// The decision table of a handle's target, resolved when the handle is created and shared with
+/// its child handles. The answers are memoized per problem, keyed by ProblemKey.
+class MIOPEN_INTERNALS_EXPORT DecisionTableCache
+{
+public:
+    /// Does not load any table if MIOPEN_DEBUG_DISABLE_CONV_DECISION_TABLE is set.
+    explicit DecisionTableCache(const Handle& handle);
+    explicit DecisionTableCache(std::shared_ptr<const DecisionTable> table_);
+
+    bool HasTable() const { return table != nullptr; }
+    std::optional<std::vector<solver::Id>> Find(const ProblemDescription& problem);
+
+private:
+    static constexpr std::size_t max_size = 4096;
+
+    std::shared_ptr<const DecisionTable> table;
+    std::shared_mutex mutex;
+    std::unordered_map<ProblemKey, std::optional<std::vector<solver::Id>>, ProblemKeyHash>
+        results;
+};
+
+/// The ranked solvers for the problem from the table of the context's target, std::nullopt
+/// if there is no table or it has no entry for the problem. Each table file is loaded once per
+/// process.
+MIOPEN_INTERNALS_EXPORT std::optional<std::vector<solver::Id>>
+GetDecisionTableSolvers(const ExecutionContext& ctx, const ProblemDescription& problem);
+
+} // namespace conv
+} // namespace miopen
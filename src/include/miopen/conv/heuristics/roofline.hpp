@@ -0,0 +1,103 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#pragma once
+
+#include <miopen/config.hpp>
+#include <miopen/miopen.h>
+
+#include <cstddef>
+#include <string>
+
+namespace miopen {
+
+struct ExecutionContext;
+
+namespace solver {
+struct Id;
+} // namespace solver
+
+namespace conv {
+
+struct ProblemDescription;
+
+/// What a solver tells the roofline cost model about its kernels. The work is described as the
+/// implicit GEMM of the convolution: M over the output channels (input channels for the backward
+/// data direction), N over the batch and the pixels.
+struct RooflineParams
+{
+    /// Fraction of the peak throughput reached on large problems, 0 if unknown.
+    float efficiency = 0.0f;
+    /// Whether the kernels run on the matrix cores (xdlops or wmma).
+    bool matrix_cores = false;
+    /// Arithmetic work relative to the direct convolution, below 1 for Winograd.
+    float flop_ratio = 1.0f;
+    /// Output tile of a workgroup, which sets the tile utilization and the number of waves.
+    std::size_t tile_m = 1;
+    std::size_t tile_n = 1;
+    /// How many times the tensors go through memory, e.g. above 1 for im2col or transposes.
+    float traffic_ratio  = 1.0f;
+    std::size_t launches = 1;
+};
+
+/// Peak throughputs of a device, from a table of the known targets scaled by the number of CUs.
+struct MIOPEN_INTERNALS_EXPORT RooflineDevice
+{
+    double vector_flops       = 0.0; // fp32 FLOP/s, the other data types are scaled from it
+    double matrix_flops       = 0.0; // fp16 FLOP/s of the matrix cores, 0 if there are none
+    double bandwidth          = 0.0; // bytes/s
+    std::size_t compute_units = 1;
+
+    static RooflineDevice Get(const std::string& device_name, std::size_t compute_units);
+    static RooflineDevice Get(const ExecutionContext& ctx);
+
+    /// FLOP/s for the data type on the vector units or the matrix cores.
+    double GetPeakFlops(miopenDataType_t type, bool matrix_cores) const;
+};
+
+/// Estimated time of the problem in ms: the larger of the compute and the memory time, the
+/// compute time scaled by the tile utilization and the occupancy of the last wave of
+/// workgroups, plus the launch overhead. Negative if the parameters have no efficiency.
+MIOPEN_INTERNALS_EXPORT float EstimateTime(const RooflineDevice& device,
+                                           const ProblemDescription& problem,
+                                           const RooflineParams& params,
+                                           std::size_t workspace);
+
+/// The parameters of the solver for the problem. Solvers without their own parameters are
+/// described by the defaults of their algorithm.
+MIOPEN_INTERNALS_EXPORT RooflineParams GetRooflineParams(const ExecutionContext& ctx,
+                                                         const ProblemDescription& problem,
+                                                         const solver::Id& solver_id);
+
+/// Estimated time of the solver for the problem in ms, negative if unknown. The device is taken
+/// once per query, see RooflineDevice::Get.
+MIOPEN_INTERNALS_EXPORT float EstimateSolverTime(const RooflineDevice& device,
+                                                 const ExecutionContext& ctx,
+                                                 const ProblemDescription& problem,
+                                                 const solver::Id& solver_id,
+                                                 std::size_t workspace);
+
+} // namespace conv
+} // namespace miopen
@@ -32,6 +32,7 @@
 #include <miopen/scalar.hpp>
 
 #include <miopen/problem_description_base.hpp>
+#include <miopen/problem_key.hpp>
 #include <miopen/tensor.hpp>
 #include <miopen/convolution.hpp>
 
@@ -371,6 +372,8 @@ struct MIOPEN_INTERNALS_EXPORT ProblemDescription : ProblemDescriptionBase
 
     void HeuristicUpdateLayouts();
 
+    ProblemKey MakeKey() const;
+
     void MakeNetworkConfig(std::string& conf_key) const;
 
     NetworkConfig MakeNetworkConfig() const override
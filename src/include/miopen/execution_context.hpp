@@ -35,9 +35,13 @@
 #include <miopen_data.hpp>
 #endif
 #include <miopen/filesystem.hpp>
+#include <miopen/find_monitor.hpp>
+#include <miopen/timing_policy.hpp>
 
+#include <memory>
 #include <string>
 #include <string_view>
+#include <vector>
 
 class rocm_meta_version
 {
@@ -97,8 +101,15 @@ struct MIOPEN_INTERNALS_EXPORT ExecutionContext
     bool disable_perfdb_access      = false;
     bool use_dynamic_solutions_only = false;
     bool is_for_generic_search      = false;
+    // Serialized performance configs of similar problems which the search measures first.
+    std::vector<std::string> tuning_seeds;
+    // How the search measures the time of each config.
+    TimingPolicy timing_policy;
+    // Reports the progress of the find and tells it to stop early, may be null.
+    std::shared_ptr<FindMonitor> find_monitor;
 
     inline Handle& GetStream() const { return *stream; }
+    inline bool IsFindCancelled() const { return find_monitor && find_monitor->IsCancelled(); }
     inline void SetStream(Handle* stream_) { stream = stream_; }
 
     ExecutionContext() { DetectRocm(); }
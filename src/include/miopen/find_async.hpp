@@ -0,0 +1,84 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/miopen.h>
+
+#include <miopen/common.hpp>
+#include <miopen/object.hpp>
+#include <miopen/problem.hpp>
+#include <miopen/search_options.hpp>
+#include <miopen/solution.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace miopen {
+
+struct Handle;
+
+/// Result of a find running in the background. The finds are run one at a time on a dedicated
+/// thread, so they do not disturb each other's measurements. Each of them uses a child of the
+/// passed handle bound to a stream of its own, so the caches are shared with the caller while
+/// its work on the stream of the handle does not skew the measurements.
+///
+/// The buffers referenced by the options must stay alive until the find is complete.
+class MIOPEN_INTERNALS_EXPORT FindFuture : public miopenFindFuture
+{
+public:
+    FindFuture(Handle& handle,
+               ProblemContainer problem,
+               FindOptions options,
+               std::size_t max_solutions);
+    FindFuture(const FindFuture&)            = delete;
+    FindFuture& operator=(const FindFuture&) = delete;
+    /// Cancels the find and waits for it to stop.
+    ~FindFuture();
+
+    bool IsReady() const;
+    void Wait() const;
+    /// Asks the find to stop. It returns what it has measured so far, marked as partial.
+    void Cancel();
+    /// Waits for the find and returns its results or rethrows its error. May be called once.
+    std::vector<Solution> Get();
+
+private:
+    struct State;
+
+    std::shared_ptr<State> state;
+};
+
+} // namespace miopen
+
+inline std::ostream& operator<<(std::ostream& stream, const miopen::FindFuture& future)
+{
+    return stream << "find future(" << (future.IsReady() ? "ready" : "running") << ")";
+}
+
+MIOPEN_DEFINE_OBJECT(miopenFindFuture, miopen::FindFuture);
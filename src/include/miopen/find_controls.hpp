@@ -32,6 +32,7 @@
 
 #include <boost/optional.hpp>
 
+#include <cstddef>
 #include <ostream>
 
 namespace miopen {
@@ -107,6 +108,11 @@ public:
 
 MIOPEN_INTERNALS_EXPORT boost::optional<std::vector<solver::Id>> GetEnvFindOnlySolver();
 
+/// Max number of threads checking the applicability of solvers concurrently. 1, the default,
+/// makes the checks sequential, 0 means the number of hardware threads. The concurrent checks
+/// are opt-in, see the requirements on SolverBase::IsApplicable().
+MIOPEN_INTERNALS_EXPORT std::size_t GetApplicabilityThreadsMax();
+
 class MIOPEN_INTERNALS_EXPORT FindMode
 {
 public:
@@ -36,6 +36,7 @@
 #include <miopen/ramdb.hpp>
 #include <miopen/readonlyramdb.hpp>
 #include <miopen/solution.hpp>
+#include <miopen/timing_policy.hpp>
 #include <miopen/conv/solver_finders.hpp>
 
 #include <boost/optional.hpp>
@@ -176,9 +177,12 @@ public:
         for(const auto& solution : result.solutions)
         {
             const auto algo = solution.GetSolver().GetAlgo(problem.GetDirection());
-            record.content->SetValues(
-                solution.GetSolver().ToString(),
-                FindDbData{solution.GetTime(), solution.GetWorkspaceSize(), algo});
+            record.content->SetValues(solution.GetSolver().ToString(),
+                                      FindDbData{solution.GetTime(),
+                                                 solution.GetWorkspaceSize(),
+                                                 algo,
+                                                 TimingResult::statistic,
+                                                 solution.GetTimeVariance()});
         }
 
         return result.solutions;
@@ -35,11 +35,19 @@
 #include <miopen/find_controls.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/mlo_internal.hpp>
+#include <miopen/par_for.hpp>
 #include <miopen/search_options.hpp>
 #include <miopen/solver_id.hpp>
 #include <miopen/solver.hpp>
+#include <miopen/timer.hpp>
+#include <miopen/trace.hpp>
+#include <miopen/tuning_warm_start.hpp>
 
+#include <algorithm>
+#include <array>
+#include <functional>
 #include <limits>
+#include <numeric>
 #include <type_traits>
 #include <optional>
 #include <vector>
@@ -128,15 +136,34 @@ auto FindSolutionImpl(rank<1>,
 
         if(context.do_search || enforce.IsSearch(context)) // TODO: Make it a customization point
         {
+            if(context.IsFindCancelled())
+            {
+                MIOPEN_LOG_I("Find cancelled, skipping search: " << s.SolverDbId());
+                return ConvSolution(miopenStatusGpuOperationsSkipped);
+            }
             MIOPEN_LOG_I("Starting search: " << s.SolverDbId() << ", enforce: " << enforce);
             try
             {
-                auto c = s.Search(context, problem, invoke_ctx);
-                db().Update(problem, s.SolverDbId(), c);
+                auto search_context         = context;
+                search_context.tuning_seeds = GetTuningSeeds(s, context, problem, db);
+                if(options)
+                    search_context.timing_policy = options->timing_policy;
+                auto c = s.Search(search_context, problem, invoke_ctx);
+                // A cancelled search returns the best config so far. It is still measured and
+                // returned, but it is not the result of the search, so the perf-db is not updated.
+                if(context.IsFindCancelled())
+                    MIOPEN_LOG_I("Find cancelled, not storing the result: " << s.SolverDbId());
+                else
+                    db().Update(problem, s.SolverDbId(), c);
                 return s.GetSolution(context, problem, c);
             }
             catch(const miopen::Exception& ex)
             {
+                if(ex.status == miopenStatusGpuOperationsSkipped)
+                {
+                    MIOPEN_LOG_I("Search skipped for: " << s.SolverDbId() << ": " << ex.what());
+                    return ConvSolution(ex.status);
+                }
                 MIOPEN_LOG_E("Search failed for: " << s.SolverDbId() << ": " << ex.what());
                 return ConvSolution(miopenStatusInternalError);
             }
@@ -210,6 +237,7 @@ ConvSolution FindSolution(Solver s,
 {
     static_assert(sizeof(Solver) == sizeof(SolverBase), "Solver must be stateless");
     static_assert(std::is_base_of<SolverBase, Solver>{}, "Not derived class of SolverBase");
+    MIOPEN_TRACE_SCOPE_DETAIL("solver", "FindSolution", s.SolverDbId());
 
     decltype(auto) db_getter = [&]() -> decltype(auto) {
         if constexpr(std::is_invocable_v<Db>)
@@ -280,29 +308,32 @@ struct SolverContainer
                           std::size_t limit = std::numeric_limits<std::size_t>::max(),
                           const std::optional<FindOptions>& options = std::nullopt) const
     {
+        MIOPEN_TRACE_SCOPE("solver", "SearchForAllSolutions");
         std::vector<Solution> ss;
-        std::size_t count    = 0;
-        const auto find_only = GetEnvFindOnlySolver();
-        miopen::each_args(
+        std::size_t count        = 0;
+        const auto find_only     = GetEnvFindOnlySolver();
+        const auto is_applicable = MakeApplicabilityCheck(
+            ctx,
+            problem,
             [&](auto solver) {
-                if(count >= limit)
-                    return;
-                if(find_only &&
-                   (std::find(find_only->begin(), find_only->end(), Id{solver.SolverDbId()}) ==
-                    find_only->end()))
-                { // Do nothing (and keep silence for the sake of Tuna), just skip.
-                }
+                if(IsSkipped(find_only, solver))
+                    return false;
                 // For better performance, check IsDynamic() first, because
                 // it is much faster than IsApplicable().
-                else if(ctx.use_dynamic_solutions_only && !solver.IsDynamic())
+                if(ctx.use_dynamic_solutions_only && !solver.IsDynamic())
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Skipped (non-dynamic)");
+                    return false;
                 }
-                else if(!solver.IsApplicable(ctx, problem))
-                {
-                    MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable");
-                }
-                else
+                return true;
+            },
+            limit == std::numeric_limits<std::size_t>::max());
+        miopen::each_args(
+            [&](auto solver) {
+                // A cancelled find does not compile the solutions of the remaining solvers.
+                if(count >= limit || ctx.IsFindCancelled())
+                    return;
+                if(is_applicable(solver))
                 {
                     const Solution s =
                         FindSolution(solver, ctx, problem, db, invoke_ctx, "", options);
@@ -338,26 +369,22 @@ struct SolverContainer
     {
         auto db_container = std::optional<PerformanceDb>{};
         std::vector<Solution> ss;
-        std::size_t count    = 0;
-        const auto find_only = GetEnvFindOnlySolver();
+        std::size_t count        = 0;
+        const auto find_only     = GetEnvFindOnlySolver();
+        const auto is_applicable = MakeApplicabilityCheck(
+            ctx,
+            problem,
+            [&](auto solver) { return !IsSkipped(find_only, solver); },
+            limit == std::numeric_limits<std::size_t>::max());
         miopen::each_args(
             [&](auto solver) {
                 if(count >= limit)
                     return;
-                if(find_only &&
-                   (std::find(find_only->begin(), find_only->end(), Id{solver.SolverDbId()}) ==
-                    find_only->end()))
-                { // Do nothing (and keep silence for the sake of Tuna), just skip.
-                }
                 // For better performance, check IsDynamic() first, because
                 // it is much faster than IsApplicable().
                 // else if(problem.use_dynamic_solutions_only && !solver.IsDynamic())
                 //    MIOPEN_LOG_I2(solver.SolverDbId() << ": Skipped (non-dynamic)");
-                else if(!solver.IsApplicable(ctx, problem))
-                {
-                    MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable");
-                }
-                else
+                if(is_applicable(solver))
                 {
                     auto db = [&]() -> PerformanceDb& {
                         constexpr auto db_getter =
@@ -399,35 +426,37 @@ struct SolverContainer
         const Context& ctx, const Problem& problem, const bool simple_primitive = false) const
     {
         std::vector<std::pair<std::string, size_t>> res;
-        const auto find_only = GetEnvFindOnlySolver();
-        miopen::each_args(
+        const auto find_only     = GetEnvFindOnlySolver();
+        const auto is_applicable = MakeApplicabilityCheck(
+            ctx,
+            problem,
             [&](auto solver) {
-                if(find_only &&
-                   (std::find(find_only->begin(), find_only->end(), Id{solver.SolverDbId()}) ==
-                    find_only->end()))
-                { // Do nothing (and keep silence for the sake of Tuna), just skip.
-                }
+                if(IsSkipped(find_only, solver))
+                    return false;
                 // The following optimization is required to avoid checks
                 // for solvers that have slow IsApplicable() and do not
                 // require workspace (like MLIR convolutions). However we
                 // do not want to use it for simple primitives, for example,
                 // the ones that ExecutePrimitive() which uses the first applicable
                 // solver:
-                else if(!simple_primitive && !solver.MayNeedWorkspace())
+                if(!simple_primitive && !solver.MayNeedWorkspace())
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Skipped (no workspace required)");
+                    return false;
                 }
                 // For better performance, check IsDynamic() first, because
                 // it is much faster than IsApplicable().
-                else if(ctx.use_dynamic_solutions_only && !solver.IsDynamic())
+                if(ctx.use_dynamic_solutions_only && !solver.IsDynamic())
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Skipped (non-dynamic)");
+                    return false;
                 }
-                else if(!solver.IsApplicable(ctx, problem))
-                {
-                    MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable");
-                }
-                else
+                return true;
+            },
+            true);
+        miopen::each_args(
+            [&](auto solver) {
+                if(is_applicable(solver))
                 {
                     auto sz = solver.GetWorkspaceSize(ctx, problem);
                     res.push_back(std::make_pair(solver.SolverDbId(), sz));
@@ -510,6 +539,96 @@ struct SolverContainer
     {
         return ExecutePrimitive(&handle, problem, algo, invoke_params);
     }
+
+private:
+    template <class FindOnly, class Solver>
+    static bool IsSkipped(const FindOnly& find_only, const Solver& solver)
+    {
+        // Keep silence for the sake of Tuna.
+        return find_only && (std::find(find_only->begin(),
+                                       find_only->end(),
+                                       Id{solver.SolverDbId()}) == find_only->end());
+    }
+
+    template <class Solver>
+    static constexpr std::size_t IndexOf()
+    {
+        std::size_t index = 0;
+        std::size_t found = sizeof...(Solvers);
+        ((found = (found == sizeof...(Solvers) && std::is_same<Solver, Solvers>{}) ? index : found,
+          ++index),
+         ...);
+        return found;
+    }
+
+    /// Returns a functor which tells whether a solver of the container is accepted by the filter
+    /// and is applicable. If concurrent is set and GetApplicabilityThreadsMax() is not 1, all the
+    /// checks are run right away on that many threads, since some of them are expensive (e.g.
+    /// MLIR, CK and GTC solvers). This is opt-in, as it relies on the IsApplicable()
+    /// implementations being thread-safe. Otherwise, each check runs when the functor is called,
+    /// so the callers which stop at the first applicable solver do not check the rest. Either way
+    /// the callers process the solvers in the registration order, so the results are
+    /// deterministic.
+    ///
+    /// The latency of each check is logged, so that the slow ones can be found.
+    template <class Context, class Problem, class Filter>
+    static auto MakeApplicabilityCheck(const Context& ctx,
+                                       const Problem& problem,
+                                       Filter filter,
+                                       bool concurrent)
+    {
+        const auto check = [&ctx, &problem, filter](auto solver, float& latency_ms) {
+            latency_ms = 0.0f;
+            if(!filter(solver))
+                return false;
+            Timer timer;
+            timer.start();
+            const auto applicable = solver.IsApplicable(ctx, problem);
+            latency_ms            = timer.elapsed_ms();
+            MIOPEN_LOG_I2(solver.SolverDbId() << (applicable ? ": Applicable" : ": Not applicable")
+                                              << " (" << latency_ms << " ms)");
+            return applicable;
+        };
+
+        std::vector<char> results;
+        if(concurrent && GetApplicabilityThreadsMax() > 1)
+        {
+            const std::array<std::function<bool(float&)>, sizeof...(Solvers)> checks = {
+                {[&check](float& latency_ms) { return check(Solvers{}, latency_ms); }...}};
+            const std::array<const std::string*, sizeof...(Solvers)> ids = {
+                {&Solvers{}.SolverDbId()...}};
+
+            std::vector<float> latencies(checks.size());
+            results.resize(checks.size());
+            Timer timer;
+            timer.start();
+            par_for(checks.size(), max_threads{GetApplicabilityThreadsMax()}, [&](auto i) {
+                results[i] = checks[i](latencies[i]) ? 1 : 0;
+            });
+
+            const auto slowest = std::max_element(latencies.begin(), latencies.end());
+            if(slowest != latencies.end())
+            {
+                MIOPEN_LOG_I("Applicability of " << checks.size() << " solvers checked in "
+                                                 << timer.elapsed_ms() << " ms ("
+                                                 << std::accumulate(latencies.begin(),
+                                                                    latencies.end(),
+                                                                    0.0f)
+                                                 << " ms sequentially), the slowest is "
+                                                 << *ids[slowest - latencies.begin()] << " ("
+                                                 << *slowest << " ms)");
+            }
+        }
+
+        return [check, results = std::move(results)](auto solver) {
+            if(results.empty())
+            {
+                float latency_ms = 0.0f;
+                return check(solver, latency_ms);
+            }
+            return results[IndexOf<decltype(solver)>()] != 0;
+        };
+    }
 };
 
 } // namespace solver
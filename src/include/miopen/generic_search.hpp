@@ -36,18 +36,29 @@
 #include <miopen/invoke_params.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/timer.hpp>
+#include <miopen/timing_policy.hpp>
+#include <miopen/trace.hpp>
 #include <miopen/type_traits.hpp>
 #include <miopen/mt_queue.hpp>
 #include <miopen/generic_search_controls.hpp>
+#include <miopen/tuning_coordinator.hpp>
+#include <miopen/tuning_cost.hpp>
+#include <miopen/tuning_warm_start.hpp>
 
 #include <algorithm>
 #include <vector>
 #include <cstdlib>
 #include <limits>
+#include <functional>
 #include <iterator>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <tuple>
 #include <chrono>
 #include <cassert>
 #include <random>
+#include <set>
 
 namespace miopen {
 namespace solver {
@@ -177,6 +188,126 @@ public:
     const_iterator end() const { return {}; }
 };
 
+/// Random access view of a set of performance configs. Unlike ComputedContainer, it has O(1) size
+/// and allows to decode any config by its index, which makes it possible to sample huge spaces
+/// without materializing them and to split a search into shards by index range.
+///
+/// There are two kinds of spaces:
+/// - Built from seq::RuleSet (see MakeConfigSpace). The space contains all the combinations
+///   of values described by the rules, so some of the configs may be invalid for the problem.
+/// - Built from ComputedContainer (see MaterializeConfigSpace). The configs are stored in memory
+///   and all of them are valid. This is the fallback for configs which do not provide rules.
+template <typename PerformanceConfig>
+class ConfigSpace
+{
+public:
+    using Decoder = std::function<PerformanceConfig(std::size_t)>;
+
+    ConfigSpace() = default;
+    ConfigSpace(std::size_t size_, Decoder decoder_, bool validated_)
+        : decoder(std::move(decoder_)), first(0), last(size_), validated(validated_)
+    {
+    }
+
+    std::size_t size() const { return last - first; }
+    bool empty() const { return first == last; }
+    PerformanceConfig nth(std::size_t i) const
+    {
+        assert(i < size());
+        return decoder(first + i);
+    }
+    /// True if all the configs are known to be valid for the problem.
+    bool IsValidated() const { return validated; }
+
+    /// Returns the part of the space for the shard with the given index. The space is split into
+    /// count contiguous index ranges of (nearly) equal size.
+    ConfigSpace Shard(std::size_t index, std::size_t count) const
+    {
+        assert(count != 0 && index < count);
+        auto shard  = *this;
+        shard.first = first + size() * index / count;
+        shard.last  = first + size() * (index + 1) / count;
+        return shard;
+    }
+
+private:
+    Decoder decoder;
+    std::size_t first = 0;
+    std::size_t last  = 0;
+    bool validated    = false;
+};
+
+/// Builds a config space from the seq::RuleSet which describes the fields of PerformanceConfig.
+/// The fields not affected by the rules are copied from the base config.
+template <typename PerformanceConfig, class RuleSet>
+ConfigSpace<PerformanceConfig> MakeConfigSpace(const RuleSet& rules,
+                                               const PerformanceConfig& base = PerformanceConfig{})
+{
+    return {rules.Size(),
+            [rules, base](std::size_t i) {
+                auto config = base;
+                rules.FillNth(config, i);
+                return config;
+            },
+            false};
+}
+
+/// Builds a config space by storing all the valid configs of the container in memory.
+template <typename PerformanceConfig, typename Context, typename Problem>
+ConfigSpace<PerformanceConfig>
+MaterializeConfigSpace(const ComputedContainer<PerformanceConfig, Context, Problem>& container)
+{
+    auto configs = std::make_shared<std::vector<PerformanceConfig>>();
+    std::copy(container.begin(), container.end(), std::back_inserter(*configs));
+    const auto size = configs->size();
+    return {size, [configs](std::size_t i) { return (*configs)[i]; }, true};
+}
+
+/// Returns indices of up to n valid configs of the space in random order.
+/// If n is less than the size of the space, the space is split into n strata of equal size
+/// and one valid config is taken from a random position of each stratum, so that the sample
+/// covers the whole space evenly. The space is never materialized; in the worst case (almost
+/// no valid configs) IsValid is called for each config once.
+template <typename PerformanceConfig, typename IsValid, typename Rng>
+std::vector<std::size_t> SampleConfigSpace(const ConfigSpace<PerformanceConfig>& space,
+                                           std::size_t n,
+                                           const IsValid& is_valid,
+                                           Rng& rng)
+{
+    const auto size = space.size();
+    std::vector<std::size_t> indices;
+    const auto check = [&](std::size_t i) { return space.IsValidated() || is_valid(space.nth(i)); };
+
+    if(n >= size)
+    {
+        for(std::size_t i = 0; i < size; ++i)
+            if(check(i))
+                indices.push_back(i);
+    }
+    else
+    {
+        indices.reserve(n);
+        for(std::size_t stratum = 0; stratum < n; ++stratum)
+        {
+            const auto lo     = size * stratum / n;
+            const auto hi     = size * (stratum + 1) / n;
+            const auto offset = std::uniform_int_distribution<std::size_t>{0, hi - lo - 1}(rng);
+            for(std::size_t k = 0; k < hi - lo; ++k)
+            {
+                const auto i = lo + (offset + k) % (hi - lo);
+                if(check(i))
+                {
+                    indices.push_back(i);
+                    break;
+                }
+            }
+        }
+    }
+
+    std::shuffle(indices.begin(), indices.end(), rng);
+    return indices;
+}
+
 template <typename PerformanceConfig>
 class HeartBeat
 {
@@ -274,26 +405,29 @@ using RunAndMeasure_t =
                                                           std::declval<ConvSolution>(),
                                                           std::declval<float&>()));
 
+/// Returns true if the primary set of configs has no valid configs for the problem, so the spare
+/// set shall be searched instead.
 template <class Solver, class Context, class Problem>
-auto GetAllConfigs(const Solver s, const Context& context, const Problem& problem)
-    -> ComputedContainer<decltype(s.GetDefaultPerformanceConfig(context, problem)),
-                         Context,
-                         Problem>
+bool UseSpareConfigs(const Solver s, const Context& context, const Problem& problem)
 {
     using PerformanceConfig = decltype(s.GetDefaultPerformanceConfig(context, problem));
 
+    // Only the first valid config is needed to decide whether the primary set is empty.
     const ComputedContainer<PerformanceConfig, Context, Problem> primary(context, problem);
-    const int primary_size = std::distance(primary.begin(), primary.end());
-    const ComputedContainer<PerformanceConfig, Context, Problem> spare(context, problem, true);
-    const int spare_size = std::distance(spare.begin(), spare.end());
-    const bool useSpare  = (primary_size == 0);
+    if(primary.begin() != primary.end())
+        return false;
 
-    ComputedContainer<PerformanceConfig, Context, Problem> all_configs = useSpare ? spare : primary;
-    const int n_runs_total = useSpare ? spare_size : primary_size;
-    MIOPEN_LOG_W(s.SolverDbId() << ": Searching the best solution among " << n_runs_total
-                                << (useSpare ? " (spare)" : "") << "...");
+    MIOPEN_LOG_I(s.SolverDbId() << ": primary set of configs is empty, using spare set");
+    return true;
+}
 
-    return all_configs;
+template <class Solver, class Context, class Problem>
+auto GetAllConfigs(const Solver s, const Context& context, const Problem& problem)
+    -> ComputedContainer<decltype(s.GetDefaultPerformanceConfig(context, problem)),
+                         Context,
+                         Problem>
+{
+    return {context, problem, UseSpareConfigs(s, context, problem)};
 }
 
 template <class Solver, class Context, class Problem>
@@ -317,21 +451,36 @@ GetAllSolutions(const Solver s, const Context& context_, const Problem& problem)
 std::size_t GetTuningIterationsMax();
 std::chrono::milliseconds GetTuningTimeMax(); // returns the max allowed time in milliseconds
 std::size_t GetTuningThreadsMax();
+std::size_t GetTuningCompileAheadMax(); // max number of compiled solutions awaiting measurement
+std::size_t GetTuningPatience();        // 0 means no early stop
+/// How long to wait for the slices of a distributed tuning job searched by the other workers.
+std::chrono::milliseconds GetTuningCoordinatorWaitMax();
 
+/// Compiles solutions for the configs assigned to the thread and pushes them into the queue.
+/// The queue is bounded, so the agent is throttled by the measurement loop. Closing the queue
+/// cancels the agent. An item with the last tuple element set to true marks the end of the work
+/// of the agent. The time spent on compilation is reported via compile_time_ms.
 template <typename PerformanceConfig, typename Solver, typename Context, typename Problem>
 void CompileAgent(size_t thread_index,
                   size_t total_threads,
                   const Solver& s,
                   const Context& context,
                   const Problem& problem,
-                  std::vector<PerformanceConfig>& data,
-                  ThreadSafeQueue<std::tuple<PerformanceConfig, ConvSolution, bool>>& comp_queue)
+                  const ConfigSpace<PerformanceConfig>& space,
+                  const std::vector<std::size_t>& indices,
+                  ThreadSafeQueue<std::tuple<PerformanceConfig, ConvSolution, bool>>& comp_queue,
+                  float& compile_time_ms)
 {
+    MIOPEN_TRACE_SCOPE("search", "CompileAgent");
     const auto start_time =
         std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now());
-    const auto data_size   = data.size();
+    const auto data_size   = indices.size();
     const auto time_budget = GetTuningTimeMax();
     const auto& profile_h  = context.GetStream();
+    auto& stats = GetTuningStats();
+    Timer compile_timer;
+    Timer kernel_timer;
+    compile_time_ms = 0.0f;
     // start the counter
     for(auto idx = thread_index; idx < data_size; idx += total_threads)
     {
@@ -341,30 +490,89 @@ void CompileAgent(size_t thread_index,
         if(current_time - start_time > time_budget)
         {
             MIOPEN_LOG_I2("Thread: " << thread_index << " Done, exhausted time budget");
-            auto tmp = std::make_tuple<PerformanceConfig, ConvSolution, bool>({}, {}, true);
-            comp_queue.push(std::move(tmp));
             break;
         }
-        auto& current_config          = data.at(idx);
+        if(comp_queue.is_closed())
+        {
+            MIOPEN_LOG_I2("Thread: " << thread_index << " Done, cancelled");
+            return;
+        }
+        compile_timer.start();
+        auto current_config           = space.nth(indices.at(idx));
         ConvSolution current_solution = s.GetSolution(context, problem, current_config);
         for(const auto& kernel : current_solution.construction_params)
         {
             if(profile_h.HasProgram(kernel.kernel_file, kernel.comp_options))
                 continue;
+            kernel_timer.start();
             std::ignore = profile_h.LoadProgram(kernel.kernel_file, kernel.comp_options, "");
+            stats.AddCompileTime(kernel.kernel_file, kernel_timer.elapsed_ms());
         }
+        compile_time_ms += compile_timer.elapsed_ms();
         auto tup = std::make_tuple<PerformanceConfig, ConvSolution, bool>(
             std::move(current_config), std::move(current_solution), false);
-        comp_queue.push(std::move(tup));
+        if(!comp_queue.push(std::move(tup)))
+        {
+            MIOPEN_LOG_I2("Thread: " << thread_index << " Done, cancelled");
+            return;
+        }
     }
+    auto tmp = std::make_tuple<PerformanceConfig, ConvSolution, bool>({}, {}, true);
+    std::ignore = comp_queue.push(std::move(tmp));
     MIOPEN_LOG_I2("Thread: " << thread_index << " Done, completed tuning");
 }
 
+/// Collects the configs to be measured before the sampled ones. These are the valid seeds
+/// (see ExecutionContext::tuning_seeds), followed by up to GetTuningWarmStartRadius() valid
+/// configs which follow each seed in the SetNextValue order. The number of seeds is returned
+/// via n_seeds.
+template <class PerformanceConfig, class Context, class Problem>
+std::vector<PerformanceConfig>
+GetWarmStartConfigs(const Context& context, const Problem& problem, std::size_t& n_seeds)
+{
+    std::vector<PerformanceConfig> seeds;
+    std::vector<PerformanceConfig> neighbors;
+    std::vector<std::string> known;
+    const auto add = [&](std::vector<PerformanceConfig>& to, const PerformanceConfig& config) {
+        auto str = config.ToString();
+        if(std::find(known.begin(), known.end(), str) != known.end())
+            return false;
+        known.emplace_back(std::move(str));
+        to.push_back(config);
+        return true;
+    };
+
+    const auto radius = GetTuningWarmStartRadius();
+    for(const auto& serialized : context.tuning_seeds)
+    {
+        PerformanceConfig seed;
+        if(!seed.Deserialize(serialized) || !seed.IsValid(context, problem) || !add(seeds, seed))
+            continue;
+        // Skipping invalid configs is bounded, as valid ones may be rare in some spaces.
+        auto neighbor = seed;
+        for(std::size_t n = 0, steps = 0; n < radius && steps < radius * 16; ++steps)
+        {
+            if(!neighbor.SetNextValue(problem))
+                break;
+            if(neighbor.IsValid(context, problem) && add(neighbors, neighbor))
+                ++n;
+        }
+    }
+
+    n_seeds = seeds.size();
+    seeds.insert(seeds.end(), neighbors.begin(), neighbors.end());
+    return seeds;
+}
+
+/// Searches the best config within the given config space and returns it along with its time.
 template <class Solver, class Context, class Problem>
-auto GenericSearch(const Solver s,
-                   const Context& context_,
-                   const Problem& problem,
-                   const AnyInvokeParams& invoke_ctx_)
+auto SearchConfigSpace(const Solver s,
+                       const Context& context_,
+                       const Problem& problem,
+                       const AnyInvokeParams& invoke_ctx_,
+                       const ConfigSpace<decltype(s.GetDefaultPerformanceConfig(context_, problem))>&
+                           config_space_,
+                       float& best_time_out)
     -> decltype(s.GetDefaultPerformanceConfig(context_, problem))
 {
     static_assert(
@@ -388,24 +596,71 @@ auto GenericSearch(const Solver s,
     auto& profile_h = context.GetStream();
     const AutoEnableProfiling enableProfiling{profile_h};
 
-    auto tmp_all_configs = GetAllConfigs(s, context, problem);
-    // For random access
-    std::vector<PerformanceConfig> all_configs;
-    std::copy(tmp_all_configs.begin(), tmp_all_configs.end(), std::back_inserter(all_configs));
-    // shuffle the configs
+    // Warm start: the configs which are the best for similar problems and their successors go
+    // first. They are likely to be good, so the patience would stop the search earlier.
+    // They count against the iteration limit, the neighbors are dropped before the seeds.
+    std::size_t n_seeds = 0;
+    auto warm_start     = GetWarmStartConfigs<PerformanceConfig>(context, problem, n_seeds);
+
+    const auto max_iterations = GetTuningIterationsMax();
+    if(warm_start.size() > max_iterations)
+    {
+        warm_start.erase(warm_start.begin() + max_iterations, warm_start.end());
+        n_seeds = std::min(n_seeds, max_iterations);
+    }
+
+    auto config_space = config_space_;
     std::random_device rd{};
-    auto rng = std::default_random_engine{rd()};
-    std::shuffle(all_configs.begin(), all_configs.end(), rng);
-    std::size_t n_runs_total = std::min(all_configs.size(), GetTuningIterationsMax());
-    all_configs.resize(n_runs_total);
+    auto rng         = std::default_random_engine{rd()};
+    auto all_indices = SampleConfigSpace(
+        config_space,
+        max_iterations - warm_start.size(),
+        [&](const PerformanceConfig& config) { return config.IsValid(context, problem); },
+        rng);
+
+    if(!warm_start.empty())
+    {
+        std::vector<std::string> known;
+        known.reserve(warm_start.size());
+        for(const auto& config : warm_start)
+            known.emplace_back(config.ToString());
+        const auto is_known = [&](std::size_t i) {
+            return std::find(known.begin(), known.end(), config_space.nth(i).ToString()) !=
+                   known.end();
+        };
+        all_indices.erase(std::remove_if(all_indices.begin(), all_indices.end(), is_known),
+                          all_indices.end());
+
+        const auto offset = warm_start.size();
+        for(auto& index : all_indices)
+            index += offset;
+        std::vector<std::size_t> prefix(offset);
+        std::iota(prefix.begin(), prefix.end(), 0);
+        all_indices.insert(all_indices.begin(), prefix.begin(), prefix.end());
+
+        config_space = ConfigSpace<PerformanceConfig>{
+            offset + config_space.size(),
+            [warm_start, space = config_space](std::size_t i) {
+                return i < warm_start.size() ? warm_start[i] : space.nth(i - warm_start.size());
+            },
+            config_space.IsValidated()};
+        MIOPEN_LOG_I(s.SolverDbId() << ": warm start with " << n_seeds << " seeds and "
+                                    << offset - n_seeds << " of their neighbors");
+    }
 
-    if(all_configs.empty())
+    std::size_t n_runs_total = all_indices.size();
+    MIOPEN_LOG_W(s.SolverDbId() << ": Searching the best solution among " << n_runs_total
+                                << " of " << config_space.size() << "...");
+
+    if(all_indices.empty())
     {
         const auto default_config = s.GetDefaultPerformanceConfig(context, problem);
 
         if(default_config.IsValid(context, problem))
         {
-            all_configs.emplace_back(default_config);
+            config_space = ConfigSpace<PerformanceConfig>{
+                1, [default_config](std::size_t) { return default_config; }, true};
+            all_indices.emplace_back(0);
             n_runs_total += 1;
         }
         else
@@ -424,10 +679,19 @@ auto GenericSearch(const Solver s,
     heartbeat.Start();
 
     const auto total_threads = GetTuningThreadsMax();
+    const auto time_budget   = GetTuningTimeMax();
+    const auto patience      = GetTuningPatience();
 
-    ThreadSafeQueue<std::tuple<PerformanceConfig, ConvSolution, bool>> solution_queue;
+    // The queue is bounded so compilation runs at most GetTuningCompileAheadMax() solutions ahead
+    // of measurement. This limits memory usage and the amount of wasted compilation when the
+    // search is stopped early.
+    ThreadSafeQueue<std::tuple<PerformanceConfig, ConvSolution, bool>> solution_queue(
+        GetTuningCompileAheadMax());
+    std::vector<float> compile_times(total_threads);
     std::vector<std::thread> compile_agents;
     compile_agents.reserve(total_threads);
+    Timer search_timer;
+    search_timer.start();
     for(auto idx = 0; idx < total_threads; ++idx)
     {
         compile_agents.emplace_back(CompileAgent<PerformanceConfig, Solver, Context, Problem>,
@@ -436,153 +700,190 @@ auto GenericSearch(const Solver s,
                                     std::cref(s),
                                     std::cref(context),
                                     std::cref(problem),
-                                    std::ref(all_configs),
-                                    std::ref(solution_queue));
+                                    std::cref(config_space),
+                                    std::cref(all_indices),
+                                    std::ref(solution_queue),
+                                    std::ref(compile_times[idx]));
     }
 
-    if(!env::enabled(MIOPEN_DEBUG_COMPILE_ONLY))
+    const auto clear_programs = [&](const ConvSolution& solution) {
+        // Banchmarked kernels will not be used anymore.
+        // Now we can delete Program objects that belong to OCL/HIP
+        // runtime and free the associated resources (memory, file handles...)
+        for(const auto& kernelInfo : solution.construction_params)
+            profile_h.ClearProgram(kernelInfo.kernel_file, kernelInfo.comp_options);
+    };
+
+    const bool compile_only = env::enabled(MIOPEN_DEBUG_COMPILE_ONLY);
+    bool cancelled          = false;
+    size_t n_current        = 0;
+    float measure_time_ms   = 0.0f;
+    auto threads_remaining  = total_threads;
+    Timer measure_timer;
+    while(threads_remaining != 0)
     {
-        size_t n_current       = 0;
-        auto threads_remaining = total_threads;
-        while(true)
+        if(n_current >= n_runs_total)
+            break;
+        if(!compile_only)
         {
-            if(n_current >= n_runs_total)
+            if(std::chrono::duration<float, std::milli>{search_timer.elapsed_ms()} > time_budget)
+            {
+                MIOPEN_LOG_W("Tuning time budget exhausted, cancelling remaining compilation");
                 break;
-            MIOPEN_LOG_I2("Waiting for item in queue");
-            const auto kinder     = solution_queue.pop();
-            auto current_config   = std::get<0>(kinder);
-            auto current_solution = std::get<1>(kinder);
-
-            if(std::get<2>(kinder))
+            }
+            if(patience != 0 && is_passed && n_current - n_best > patience)
             {
-                threads_remaining--;
-                if(threads_remaining == 0)
-                {
-                    break;
-                }
-                else
-                {
-                    continue;
-                }
+                MIOPEN_LOG_W("No improvement within " << patience
+                                                      << " configs, stopping the search");
+                break;
+            }
+            if(context.IsFindCancelled())
+            {
+                MIOPEN_LOG_W("Find cancelled, stopping the search");
+                cancelled = true;
+                break;
             }
+        }
+        MIOPEN_LOG_I2("Waiting for item in queue");
+        auto kinder           = solution_queue.pop();
+        auto current_config   = std::move(std::get<0>(kinder));
+        auto current_solution = std::move(std::get<1>(kinder));
+
+        if(std::get<2>(kinder))
+        {
+            threads_remaining--;
+            continue;
+        }
 
-            float elapsed_time = 0.0f;
-            int ret            = 0;
-            MIOPEN_LOG_I2('#' << n_current << '/' << n_failed << '/' << n_runs_total << ' '
-                              << current_config);
+        if(compile_only)
+        {
+            // Keep the compiled programs, the goal is to populate the binary cache.
+            ++n_current;
+            continue;
+        }
 
-            Invoker invoker;
+        measure_timer.start();
+        float elapsed_time = 0.0f;
+        int ret            = 0;
+        MIOPEN_LOG_I2('#' << n_current << '/' << n_failed << '/' << n_runs_total << ' '
+                          << current_config);
 
-            try
-            {
-                if(default_solution.workspace_sz != current_solution.workspace_sz)
-                {
-                    ret = -2;
-                    MIOPEN_LOG_E('#' << n_current << " (" << n_runs_total << ") "
-                                     << "Workspace size should not depend on PerformanceConfig: "
-                                     << default_solution.workspace_sz
-                                     << " != " << current_solution.workspace_sz);
-                }
+        Invoker invoker;
+        TimingResult timing;
 
-                invoker = profile_h.PrepareInvoker(*current_solution.invoker_factory,
-                                                   current_solution.construction_params);
-                invoker(profile_h, invoke_ctx);
-                elapsed_time = profile_h.GetKernelTime();
-            }
-            catch(const std::exception& e)
-            {
-                MIOPEN_LOG_E("Error: Exception encountered : " << e.what());
-                ret = 1;
-            }
-            catch(...)
+        try
+        {
+            MIOPEN_TRACE_SCOPE("search", "Measure");
+            if(default_solution.workspace_sz != current_solution.workspace_sz)
             {
-                MIOPEN_LOG_E("Error: Unknown exception thrown.");
-                ret = 1;
+                ret = -2;
+                MIOPEN_LOG_E('#' << n_current << " (" << n_runs_total << ") "
+                                 << "Workspace size should not depend on PerformanceConfig: "
+                                 << default_solution.workspace_sz
+                                 << " != " << current_solution.workspace_sz);
             }
 
-            MIOPEN_LOG_T("##"
-                         << "(n_current, n_failed, n_runs_total):  " << n_current << '/' << n_failed
-                         << '/' << n_runs_total << " elapsed_time: " << elapsed_time
-                         << ", best_time: " << best_time << ", " << current_config);
+            invoker = profile_h.PrepareInvoker(*current_solution.invoker_factory,
+                                               current_solution.construction_params);
+            // Configs which are clearly slower than the best one are dropped after a few runs.
+            timing = MeasureTime(
+                context.timing_policy,
+                [&]() {
+                    invoker(profile_h, invoke_ctx);
+                    return profile_h.GetKernelTime();
+                },
+                best_time);
+            elapsed_time = timing.time;
+        }
+        catch(const std::exception& e)
+        {
+            MIOPEN_LOG_E("Error: Exception encountered : " << e.what());
+            ret = 1;
+        }
+        catch(...)
+        {
+            MIOPEN_LOG_E("Error: Unknown exception thrown.");
+            ret = 1;
+        }
+
+        MIOPEN_LOG_T("##"
+                     << "(n_current, n_failed, n_runs_total):  " << n_current << '/' << n_failed
+                     << '/' << n_runs_total << " elapsed_time: " << elapsed_time
+                     << ", best_time: " << best_time << ", " << current_config);
 
-            if(ret == 0)
+        if(ret == 0)
+        {
+            is_passed = true;
+            if(!timing.eliminated && elapsed_time < best_time)
             {
-                // Smooth the jitter of measurements:
-                // If the 1st probe is NOT too bad (measured time <= 1.05 * best known time),
-                // then re-run it 4 times more and compute average time,
-                // and decide using average of all 5 attempts vs. the best.
-                if(elapsed_time / best_time < 1.05f)
-                {
-                    MIOPEN_LOG_I2("Finding average for: " << elapsed_time << " / " << best_time
-                                                          << " = " << (elapsed_time / best_time));
-
-                    try
-                    {
-                        for(int i = 0; i < 4; ++i)
-                        {
-                            invoker(profile_h, invoke_ctx);
-                            elapsed_time += profile_h.GetKernelTime();
-                        }
-                    }
-                    catch(...)
-                    {
-                        ret = 1;
-                    }
-
-                    if(ret == 0)
-                    {
-                        is_passed = true;
-                        elapsed_time /= 5;
-                        if(elapsed_time < best_time)
-                        {
-                            MIOPEN_LOG_I('#' << n_current << '/' << n_failed << '/' << n_runs_total
-                                             << ' ' << elapsed_time << " < " << best_time << ' '
-                                             << current_config);
-                            best_config = current_config;
-                            best_time   = elapsed_time;
-                            n_best      = n_current;
-                        }
-                        else
-                        {
-                            MIOPEN_LOG_I2("Average is not better: " << elapsed_time
-                                                                    << " >= " << best_time);
-                        }
-                    }
-                }
+                MIOPEN_LOG_I('#' << n_current << '/' << n_failed << '/' << n_runs_total << ' '
+                                 << elapsed_time << " < " << best_time << ' ' << current_config);
+                best_config = current_config;
+                best_time   = elapsed_time;
+                n_best      = n_current;
             }
-
-            // Banchmarked kernels will not be used anymore.
-            // Now we can delete Program objects that belong to OCL/HIP
-            // runtime and free the associated resources (memory, file handles...)
-            for(const auto& kernelInfo : current_solution.construction_params)
-                profile_h.ClearProgram(kernelInfo.kernel_file, kernelInfo.comp_options);
-
-            if(ret != 0)
+            else
             {
-                MIOPEN_LOG_E('#' << n_current << " (" << n_runs_total << ") "
-                                 << " Failed rc=" << ret);
-                ++n_failed;
+                MIOPEN_LOG_I2("Median is not better: " << elapsed_time << " >= " << best_time
+                                                       << " (" << timing.runs << " runs)");
             }
-            heartbeat.Monitor(ret != 0,
-                              elapsed_time,
-                              n_current,
-                              best_time,
-                              n_failed,
-                              n_runs_total,
-                              current_config);
-            ++n_current;
         }
+
+        clear_programs(current_solution);
+
+        if(ret != 0)
+        {
+            MIOPEN_LOG_E('#' << n_current << " (" << n_runs_total << ") "
+                             << " Failed rc=" << ret);
+            ++n_failed;
+        }
+        const auto config_measure_time_ms = measure_timer.elapsed_ms();
+        measure_time_ms += config_measure_time_ms;
+        GetTuningStats().AddMeasureTime(s.SolverDbId(), config_measure_time_ms);
+        heartbeat.Monitor(ret != 0,
+                          elapsed_time,
+                          n_current,
+                          best_time,
+                          n_failed,
+                          n_runs_total,
+                          current_config);
+        ++n_current;
     }
-    else
+
+    // Cancel the agents which are still compiling and release what they have already built.
+    solution_queue.close();
+    for(auto& agent : compile_agents)
+        agent.join();
+    while(const auto leftover = solution_queue.try_pop())
     {
+        if(!std::get<2>(*leftover))
+            clear_programs(std::get<1>(*leftover));
+    }
+
+    GetTuningStats().Save();
+
+    const auto compile_time_ms = std::accumulate(compile_times.begin(), compile_times.end(), 0.0f);
+    MIOPEN_LOG_W("Pipeline: compile " << compile_time_ms << " ms (" << total_threads
+                                      << " threads), measure " << measure_time_ms
+                                      << " ms, wall " << search_timer.elapsed_ms() << " ms");
+
+    if(compile_only)
         MIOPEN_THROW(miopenStatusGpuOperationsSkipped,
                      "Running kernels on GPU is disabled. Search skipped");
+    // The best config so far is still returned, but it is not the result of the search, so the
+    // caller must keep it out of the perf-db (see FindSolutionImpl).
+    if(cancelled)
+    {
+        if(!is_passed)
+            MIOPEN_THROW(miopenStatusGpuOperationsSkipped, "Find cancelled. Search stopped");
+        MIOPEN_LOG_W("Cancelled: " << n_current << '/' << n_failed << '/' << n_runs_total
+                                   << ", best so far #" << n_best << ' ' << best_time << ' '
+                                   << best_config);
+        best_time_out = best_time;
+        return best_config;
     }
 
-    for(auto& agent : compile_agents)
-        agent.join();
-
-    MIOPEN_LOG_W("Done: " << n_runs_total << '/' << n_failed << '/' << n_runs_total << ", best #"
+    MIOPEN_LOG_W("Done: " << n_current << '/' << n_failed << '/' << n_runs_total << ", best #"
                           << n_best << ' ' << best_time << ' ' << best_config);
 
     if(!is_passed)
@@ -596,9 +897,189 @@ auto GenericSearch(const Solver s,
     const auto score        = (best_time > 0.0f) ? default_time / best_time : 0.0f;
     MIOPEN_LOG_W("...Score: " << score << " (default time " << default_time << ')');
 
+    if(!warm_start.empty())
+    {
+        const auto best = std::find_if(warm_start.begin(), warm_start.end(), [&](auto&& config) {
+            return config.ToString() == best_config.ToString();
+        });
+        const auto n_best_in_prefix = static_cast<std::size_t>(best - warm_start.begin());
+        ReportWarmStartOutcome(s.SolverDbId(),
+                               n_best_in_prefix < n_seeds ? WarmStartOutcome::Seed
+                               : best != warm_start.end() ? WarmStartOutcome::SeedNeighbor
+                                                          : WarmStartOutcome::Sampled);
+    }
+
+    best_time_out = best_time;
     return best_config;
 }
 
+/// Estimates the cost of the search within the given config space without running any kernels,
+/// so it works with the HIPNOGPU backend. The kernels are not compiled either: the compile and
+/// measure times come from the history collected by previous searches (see TuningStats).
+template <class Solver, class Context, class Problem>
+TuningCostEstimate
+EstimateTuningCost(const Solver s,
+                   const Context& context_,
+                   const Problem& problem,
+                   const ConfigSpace<decltype(s.GetDefaultPerformanceConfig(context_, problem))>&
+                       config_space)
+{
+    using PerformanceConfig = decltype(s.GetDefaultPerformanceConfig(context_, problem));
+
+    auto context                  = context_;
+    context.is_for_generic_search = true;
+
+    const auto count_configs = [&](bool spare) {
+        const ComputedContainer<PerformanceConfig, Context, Problem> configs(
+            context, problem, spare);
+        std::size_t count = 0;
+        for(auto it = configs.begin(); it != configs.end(); ++it)
+            ++count;
+        return count;
+    };
+
+    TuningCostEstimate estimate;
+    estimate.solver          = s.SolverDbId();
+    estimate.primary_configs = count_configs(false);
+    estimate.spare_configs   = count_configs(true);
+
+    // Default seed, so that the estimates are reproducible.
+    auto rng           = std::default_random_engine{};
+    const auto indices = SampleConfigSpace(
+        config_space,
+        GetTuningIterationsMax(),
+        [&](const PerformanceConfig& config) { return config.IsValid(context, problem); },
+        rng);
+    estimate.searched_configs = indices.size();
+
+    const auto& stats = GetTuningStats();
+    std::set<std::pair<std::string, std::string>> kernels;
+    for(const auto index : indices)
+    {
+        const auto solution = s.GetSolution(context, problem, config_space.nth(index));
+        for(const auto& kernel : solution.construction_params)
+        {
+            if(!kernels.emplace(kernel.kernel_file, kernel.comp_options).second)
+                continue;
+            bool known = false;
+            estimate.compile_time_ms += stats.GetCompileTime(kernel.kernel_file, known);
+            if(!known)
+                ++estimate.unknown_kernels;
+        }
+    }
+    estimate.unique_kernels = kernels.size();
+
+    bool known = false;
+    estimate.measure_time_ms =
+        static_cast<float>(indices.size()) * stats.GetMeasureTime(s.SolverDbId(), known);
+
+    // Compilation runs in parallel with measurement. The search stops at the time budget.
+    const auto compile_wall_ms =
+        estimate.compile_time_ms / static_cast<float>(GetTuningThreadsMax());
+    const auto time_budget_ms =
+        std::chrono::duration<float, std::milli>{GetTuningTimeMax()}.count();
+    estimate.wall_time_ms =
+        std::min(std::max(compile_wall_ms, estimate.measure_time_ms), time_budget_ms);
+    return estimate;
+}
+
+/// Searches the best config within the given config space. Allows the solver to provide
+/// a random access space (see MakeConfigSpace), so that it would not be materialized.
+///
+/// If a TuningCoordinator is configured, the space is split into slices which are
+/// distributed between all the workers taking part in tuning of the same problem.
+/// If the other workers do not report their slices in time (see GetTuningCoordinatorWaitMax), the
+/// default config is used.
+template <class Solver, class Context, class Problem>
+auto GenericSearch(const Solver s,
+                   const Context& context_,
+                   const Problem& problem,
+                   const AnyInvokeParams& invoke_ctx_,
+                   const ConfigSpace<decltype(s.GetDefaultPerformanceConfig(context_, problem))>&
+                       config_space)
+    -> decltype(s.GetDefaultPerformanceConfig(context_, problem))
+{
+    using PerformanceConfig = decltype(s.GetDefaultPerformanceConfig(context_, problem));
+    MIOPEN_TRACE_SCOPE_DETAIL("search", "GenericSearch", s.SolverDbId());
+
+    if(IsTuningDryRunEnabled())
+        ReportTuningCost(EstimateTuningCost(s, context_, problem, config_space));
+
+    float best_time        = 0.0f;
+    const auto coordinator = GetTuningCoordinator();
+    if(!coordinator)
+        return SearchConfigSpace(s, context_, problem, invoke_ctx_, config_space, best_time);
+
+    // Workers on different kinds of GPUs must not share a job: the timings and the best config
+    // depend on the target and on its CU count, like the perf-db they are stored to.
+    const auto job  = s.SolverDbId() + ':' + context_.GetStream().GetDbBasename() + ':' +
+                      problem.MakeNetworkConfig().ToString();
+    const auto wait = GetTuningCoordinatorWaitMax();
+    const auto best = coordinator->Run(job, wait, [&](const TuningSlice& slice) {
+        TuningSliceResult result;
+        const auto shard = config_space.Shard(slice.index, slice.count);
+        MIOPEN_LOG_W(s.SolverDbId() << ": slice " << slice.index << '/' << slice.count << ", "
+                                    << shard.size() << " configs");
+        // Measure the warm start configs only once per job.
+        auto slice_context = context_;
+        if(slice.index != 0)
+            slice_context.tuning_seeds.clear();
+        if(shard.empty())
+            return result;
+        try
+        {
+            const auto config =
+                SearchConfigSpace(s, slice_context, problem, invoke_ctx_, shard, best_time);
+            // The other workers would take the best config of a cut short slice for the final one.
+            if(context_.IsFindCancelled())
+                MIOPEN_THROW(miopenStatusGpuOperationsSkipped, "Find cancelled. Slice dropped");
+            result.config = config.ToString();
+            result.time   = best_time;
+        }
+        catch(const miopen::Exception& ex)
+        {
+            if(ex.status == miopenStatusGpuOperationsSkipped)
+                throw;
+            MIOPEN_LOG_W(s.SolverDbId() << ": slice " << slice.index << " failed: " << ex.what());
+        }
+        return result;
+    });
+
+    auto context                  = context_;
+    context.is_for_generic_search = true;
+    PerformanceConfig best_config;
+    if(best && best_config.Deserialize(best->config) && best_config.IsValid(context, problem))
+    {
+        MIOPEN_LOG_W(s.SolverDbId() << ": best of all slices " << best->time << ' '
+                                    << best_config);
+        return best_config;
+    }
+
+    // None of the slices has produced a valid config or not all of them are reported in time.
+    // Let the regular search handle the fallback to the default config.
+    MIOPEN_LOG_W(s.SolverDbId() << ": no results from the tuning coordinator");
+    return SearchConfigSpace(
+        s, context_, problem, invoke_ctx_, ConfigSpace<PerformanceConfig>{}, best_time);
+}
+
+/// Searches the configs enumerated by SetNextValue. They are materialized to get a random access
+/// space, so the solvers with large sets of configs shall provide one (see MakeConfigSpace).
+template <class Solver, class Context, class Problem>
+auto GenericSearch(const Solver s,
+                   const Context& context_,
+                   const Problem& problem,
+                   const AnyInvokeParams& invoke_ctx_)
+    -> decltype(s.GetDefaultPerformanceConfig(context_, problem))
+{
+    auto context                  = context_;
+    context.is_for_generic_search = true;
+    return GenericSearch(s,
+                         context_,
+                         problem,
+                         invoke_ctx_,
+                         MaterializeConfigSpace(GetAllConfigs(s, context, problem)));
+}
+
 } // namespace solver
 } // namespace miopen
 
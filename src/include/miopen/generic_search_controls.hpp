@@ -29,6 +29,7 @@
 #include <miopen/config.h>
 #include <chrono>
 #include <limits>
+#include <thread>
 
 MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_DEBUG_TUNING_ITERATIONS_MAX,
                               std::numeric_limits<std::size_t>::max())
@@ -43,3 +44,12 @@ MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_COMPILE_PARALLEL_LEVEL,
                               std::thread::hardware_concurrency() / 2)
 #endif
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_COMPILE_ONLY)
+/// Max number of compiled but not yet measured solutions held by the tuning
+/// pipeline. 0 means twice the number of compile threads.
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_TUNING_COMPILE_AHEAD_MAX, 0)
+/// Stop the search when this many measured configs in a row did not improve
+/// the best time. 0 disables early stopping.
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_TUNING_PATIENCE, 0)
+/// How long a worker of a distributed tuning job waits for the slices searched by the other
+/// workers, after it has no slices left to claim. 0 means twice MIOPEN_TUNING_TIME_MS_MAX.
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_TUNING_COORDINATOR_WAIT_MS, 0)
@@ -31,8 +31,17 @@
 #include <miopen/graphapi/variant_pack.hpp>
 #include <miopen/solution.hpp>
 
+#include <nlohmann/json_fwd.hpp>
+
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace miopen {
 
@@ -50,9 +59,65 @@ public:
     virtual std::vector<Engine> getEngines(OpGraph* graph) const = 0;
     virtual std::string_view name() const                        = 0;
 
+    /// OpGraph::getSignature() of the graphs the pattern can match. Matchers without one
+    /// are tried on every graph
+    virtual std::optional<size_t> signature() const { return std::nullopt; }
+
+    /// Attributes of a matched graph that its engines depend on, other than the ones in
+    /// OpGraph::getCanonicalKey(). The engines are kept in the ExecutionPlanCache of the handle
+    /// under both. nullopt when the executors point into the graph and can't be reused
+    virtual std::optional<std::string> getEnginesCacheKey(const OpGraph&) const
+    {
+        return std::nullopt;
+    }
+
     virtual ~GraphPatternMatcher();
 };
 
+/// Pattern matchers indexed by their signature, so findEngines() only tries the matchers
+/// with the signature of the graph and the ones without a signature, in registration order.
+/// instance() holds the in-tree patterns, other matchers are added with registerMatcher().
+class MIOPEN_INTERNALS_EXPORT GraphPatternRegistry
+{
+public:
+    struct Stats
+    {
+        std::string name;
+        size_t tries = 0;
+        size_t hits  = 0;
+        std::chrono::nanoseconds matchTime{0};
+    };
+
+    GraphPatternRegistry() = default;
+
+    static GraphPatternRegistry& instance();
+
+    void registerMatcher(std::unique_ptr<GraphPatternMatcher> matcher);
+
+    /// Engines of the first matching pattern, empty when none matches
+    std::vector<Engine> findEngines(OpGraph* graph);
+
+    std::vector<Stats> getStats() const;
+
+private:
+    struct Entry
+    {
+        std::unique_ptr<GraphPatternMatcher> matcher;
+        size_t index = 0;
+        std::atomic<size_t> tries{0};
+        std::atomic<size_t> hits{0};
+        std::atomic<int64_t> matchNs{0};
+    };
+
+    std::vector<Entry*> getCandidates(size_t signature) const;
+
+    mutable std::shared_mutex mMutex;
+    // entries are never removed, so the pointers below stay valid
+    std::vector<std::unique_ptr<Entry>> mEntries;
+    std::unordered_map<size_t, std::vector<Entry*>> mBySignature;
+    std::vector<Entry*> mWildcards;
+};
+
 struct TensorInfo
 {
     miopenTensorArgumentId_t mEnumId = miopenTensorArgumentIdInvalid;
@@ -66,6 +131,12 @@ struct TensorInfo
         assert(mEnumId != miopenTensorArgumentIdInvalid);
     }
 
+    /// Restored from a serialized execution plan, which has no graph
+    explicit TensorInfo(miopenTensorArgumentId_t enum_id) : mEnumId(enum_id)
+    {
+        assert(mEnumId != miopenTensorArgumentIdInvalid);
+    }
+
     void setDevBuf(Data_t ptr)
     {
         assert(ptr);
@@ -82,6 +153,9 @@ class MIOPEN_INTERNALS_EXPORT GraphPatternExecutor
 public:
     virtual void execute(miopenHandle_t handle, const VariantPack& vpk) = 0;
     virtual size_t getWorkspaceSize() const                             = 0;
+    /// State needed to execute without the graph, see ExecutionPlan::getJsonRepresentation().
+    /// Throws miopenStatusNotImplemented by default
+    virtual void toJson(nlohmann::json& json) const;
     virtual ~GraphPatternExecutor();
 };
 
@@ -90,6 +164,8 @@ class GraphExecutorFind20 : public GraphPatternExecutor
 {
     miopenSolution_t mSolution;
     std::shared_ptr<TensorInfoMap> mTensorInfoMap;
+    // only set for the solutions restored by fromJson()
+    std::shared_ptr<Solution> mOwnedSolution;
 
 public:
     GraphExecutorFind20(miopenSolution_t sol, const std::shared_ptr<TensorInfoMap>& tmap)
@@ -101,6 +177,10 @@ public:
 
     size_t getWorkspaceSize() const final;
 
+    void toJson(nlohmann::json& json) const final;
+
+    static std::unique_ptr<GraphPatternExecutor> fromJson(const nlohmann::json& json);
+
     static std::unique_ptr<GraphPatternExecutor> make(miopenSolution_t sol,
                                                       const std::shared_ptr<TensorInfoMap>& tmap)
     {
@@ -117,6 +197,8 @@ private:
     int64_t mGlobalIndex = -1;
     int32_t mSmCount     = 0;
     friend class EngineBuilder;
+    // restores engines without a graph
+    friend class ExecutionPlanBuilder;
 
 public:
     Engine()              = default;
@@ -47,6 +47,8 @@ private:
     EngineCfg mEngineCfg;
     miopenHandle_t mHandle = nullptr;
     std::vector<int64_t> mIntermediateIds;
+    // canonical key of the op graph of a plan restored without it
+    std::string mGraphKey;
 
     friend class ExecutionPlanBuilder;
 
@@ -61,7 +63,13 @@ public:
     const EngineCfg& getEngineCfg() const noexcept { return mEngineCfg; }
     EngineCfg& getEngineCfg() noexcept { return mEngineCfg; }
     const std::vector<int64_t>& getIntermediateIds() const noexcept { return mIntermediateIds; }
+    /// The engine, the state of its executor and the canonical key of the op graph, for the
+    /// library version and target of the handle. Throws miopenStatusNotImplemented if the
+    /// executor can't be serialized
     std::string getJsonRepresentation() const;
+    /// Whether the engine has an op graph. Plans restored from their json representation have
+    /// one only if it was supplied with ExecutionPlanBuilder::setOpGraph()
+    bool hasOpGraph() const noexcept { return mEngineCfg.getEngine().getOpGraph() != nullptr; }
 
     void execute(miopenHandle_t handle, const VariantPack& variantPack)
     {
@@ -80,6 +88,10 @@ class MIOPEN_INTERNALS_EXPORT ExecutionPlanBuilder
 private:
     ExecutionPlan mExecutionPlan;
     bool mEngineCfgSet = false;
+    // replaces the engine config, restored in build() once the handle is known
+    std::string mJson;
+    // the graph of the restored engine, checked against the serialized key
+    OpGraph* mOpGraph = nullptr;
 
 public:
     ExecutionPlanBuilder& setHandle(miopenHandle_t handle) &;
@@ -88,6 +100,9 @@ public:
     ExecutionPlanBuilder& setIntermediateIds(const std::vector<int64_t>& ids) &;
     ExecutionPlanBuilder& setIntermediateIds(std::vector<int64_t>&& ids) &;
     ExecutionPlanBuilder& setJsonRepresentation(const std::string_view& s) &;
+    /// The op graph of a plan restored from its json representation. build() throws
+    /// miopenStatusBadParm if its canonical key differs from the serialized one
+    ExecutionPlanBuilder& setOpGraph(OpGraph* graph) &;
 
     ExecutionPlanBuilder&& setHandle(miopenHandle_t handle) &&
     {
@@ -113,9 +128,16 @@ public:
     {
         return std::move(setJsonRepresentation(s));
     }
+    ExecutionPlanBuilder&& setOpGraph(OpGraph* graph) &&
+    {
+        return std::move(setOpGraph(graph));
+    }
 
     ExecutionPlan build() &;
     ExecutionPlan build() &&;
+
+private:
+    void restoreFromJson();
 };
 
 class MIOPEN_INTERNALS_EXPORT BackendExecutionPlanDescriptor : public BackendDescriptor
@@ -125,6 +147,7 @@ private:
     ExecutionPlan mExecutionPlan;
 
     miopenBackendDescriptor_t mEngineCfgDescriptor = nullptr;
+    bool mHasJson                                  = false;
 
 public:
     void setAttribute(miopenBackendAttributeName_t attributeName,
@@ -0,0 +1,89 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/config.hpp>
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+
+namespace graphapi {
+
+class GraphPatternExecutor;
+
+/// Executors of the engines found for operation graphs, so that finalizing a graph equivalent
+/// to one finalized before on the same handle costs a key and a lookup instead of the solution
+/// search of findEngines(). Each handle owns one. Beyond its capacity the least recently used
+/// entry is evicted.
+class MIOPEN_INTERNALS_EXPORT ExecutionPlanCache
+{
+public:
+    /// Indexed by the global index of the engine
+    using Executors = std::vector<std::shared_ptr<GraphPatternExecutor>>;
+
+    struct Stats
+    {
+        std::size_t hits      = 0;
+        std::size_t misses    = 0;
+        std::size_t evictions = 0;
+        std::size_t size      = 0;
+    };
+
+    /// Capacity from MIOPEN_DEBUG_GRAPHAPI_PLAN_CACHE_SIZE, 0 disables the cache
+    ExecutionPlanCache();
+    explicit ExecutionPlanCache(std::size_t capacity);
+    ExecutionPlanCache(const ExecutionPlanCache&) = delete;
+    ExecutionPlanCache& operator=(const ExecutionPlanCache&) = delete;
+
+    std::optional<Executors> get(const std::string& key);
+    void set(const std::string& key, Executors executors);
+    Stats getStats() const;
+    void clear();
+
+private:
+    // most recently used first
+    using Entries = std::list<std::pair<std::string, Executors>>;
+
+    mutable std::mutex mMutex;
+    std::size_t mCapacity;
+    Entries mEntries;
+    std::unordered_map<std::string, Entries::iterator> mIndex;
+    Stats mStats;
+};
+
+} // namespace graphapi
+
+} // namespace miopen
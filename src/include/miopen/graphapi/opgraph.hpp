@@ -228,6 +228,10 @@ class MIOPEN_INTERNALS_EXPORT OpGraph
     std::unique_ptr<SourceOpNode> mSrcNode = std::make_unique<SourceOpNode>();
     std::unique_ptr<SinkOpNode> mSinkNode  = std::make_unique<SinkOpNode>();
     std::vector<OpNode*> mNodes{};
+    // hash of the node names multiset and the node and edge counts
+    size_t mSignature = 0;
+    // Weisfeiler-Lehman hash of the node names and the edges, equal for isomorphic graphs
+    size_t mFingerprint = 0;
 
     // Descriptor related members
     miopenHandle_t mHandle = nullptr;
@@ -347,6 +351,19 @@ public:
 
     VecOfPaths getAllPaths() const;
 
+    /// Computed once when the graph is built, so pattern matching compares the fingerprints
+    /// first and only runs the exact isomorphism check when they are equal
+    size_t getFingerprint() const noexcept { return mFingerprint; }
+
+    /// Cheaper than the fingerprint and ignores the edges between the nodes. Graphs with
+    /// different signatures are never isomorphic, so it indexes the pattern matchers
+    size_t getSignature() const noexcept { return mSignature; }
+
+    /// Node names and tensor ids, dimensions, strides, data types and virtualness, independent
+    /// of the order of the nodes. The tensor ids of the inputs and outputs of a node fix its
+    /// edges, so graphs with the same key differ only in their node and tensor objects
+    std::string getCanonicalKey() const;
+
     // NOTE: for testing only. May remove in the future
     bool hasEdgeFromSource(OpNode* dst, Tensor* tens_ptr) const
     {
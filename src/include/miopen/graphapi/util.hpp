@@ -216,6 +216,7 @@ public:
     }
 
     const auto& graph() const { return mGraph; }
+    auto& graph() { return mGraph; }
 };
 
 /// \todo move this function out so that other find 2.0 code can use it
@@ -27,8 +27,11 @@
 #define GUARD_MIOPEN_HANDLE_HPP_
 
 #include <miopen/config.h>
+#include <miopen/applicability_cache.hpp>
 #include <miopen/kernel_info.hpp>
 #include <miopen/common.hpp>
+#include <miopen/conv/heuristics/decision_table.hpp>
+#include <miopen/graphapi/execution_plan_cache.hpp>
 #include <miopen/invoker_cache.hpp>
 #include <miopen/kernel.hpp>
 #include <miopen/miopen.h>
@@ -82,12 +85,28 @@ using rocblas_handle_ptr = MIOPEN_MANAGE_PTR(rocblas_handle, rocblas_destroy_han
 using hipblasLt_handle_ptr = MIOPEN_MANAGE_PTR(hipblasLtHandle_t, hipblasLtDestroy);
 #endif
 
+/// Thread safety: a handle may be shared by threads that look up and launch kernels and invokers
+/// concurrently. The kernel, program, invoker, applicability and decision table caches and the
+/// find-db take at most a shared lock on lookups, insertions only block lookups of the same shard
+/// or table.
+/// The const members that change the state of the handle itself (SetStream(), SetAllocator(),
+/// EnableProfiling(), ResetKernelTime()) and the non-const members are not synchronized and must
+/// not run concurrently with other calls on the same handle.
 struct MIOPEN_EXPORT Handle : miopenHandle
 {
     friend struct TargetProperties;
 
     Handle();
     Handle(miopenAcceleratorQueue_t stream);
+    /// Creates a child handle bound to its own stream on the device of the parent. It shares
+    /// the program, kernel, invoker, applicability, decision table and execution plan caches with
+    /// the parent, so kernels built or loaded through any of them are reused by all. The shared
+    /// caches live as long as any handle using them.
+    Handle(const Handle& parent, miopenAcceleratorQueue_t stream);
+    /// Creates a child handle as above, bound to a new stream on the device of the parent, which
+    /// is destroyed with the handle. Its work is not ordered with the work of the application,
+    /// so it may e.g. benchmark kernels while the application uses the parent's stream.
+    static std::unique_ptr<Handle> CreateChild(const Handle& parent);
     Handle(Handle&&) noexcept;
     virtual ~Handle();
 
@@ -120,25 +139,30 @@ struct MIOPEN_EXPORT Handle : miopenHandle
 
     void ClearKernels(const std::string& algorithm, const std::string& network_config) const;
 
-    auto GetKernels(const std::string& algorithm, const std::string& network_config) const
+    std::vector<KernelInvoke> GetKernels(const std::string& algorithm,
+                                         const std::string& network_config) const
     {
-        return this->GetKernelsImpl(algorithm, network_config) |
-               boost::adaptors::transformed([this](Kernel k) { return this->Run(k); });
+        const auto ks = this->GetKernelsImpl(algorithm, network_config);
+        auto kernels  = std::vector<KernelInvoke>{};
+        kernels.reserve(ks->size());
+        for(const auto& k : *ks)
+            kernels.push_back(this->Run(k));
+        return kernels;
     }
     KernelInvoke GetKernel(const std::string& algorithm, const std::string& network_config) const
     {
-        auto ks = this->GetKernelsImpl(algorithm, network_config);
-        if(ks.empty())
+        const auto ks = this->GetKernelsImpl(algorithm, network_config);
+        if(ks->empty())
         {
             MIOPEN_THROW("looking for default kernel (does not exist): " + algorithm + ", " +
                          network_config);
         }
-        return this->Run(ks.front());
+        return this->Run(ks->front());
     }
 
     KernelInvoke Run(Kernel k, bool coop_launch = false) const;
-    const std::vector<Kernel>& GetKernelsImpl(const std::string& algorithm,
-                                              const std::string& network_config) const;
+    std::shared_ptr<const std::vector<Kernel>>
+    GetKernelsImpl(const std::string& algorithm, const std::string& network_config) const;
 
     Program LoadProgram(const fs::path& program_name,
                         std::string params,
@@ -252,7 +276,7 @@ public:
                          const std::string& solver,
                          const std::optional<AlgorithmName>& algo = std::nullopt)
     {
-        invokers.Register({config, solver}, invoker);
+        invokers->Register({config, solver}, invoker);
         if(algo.has_value())
             SetAsFound1_0(config, *algo, solver);
     }
@@ -260,7 +284,7 @@ public:
     void
     SetAsFound1_0(const NetworkConfig& config, const AlgorithmName& algo, const std::string& solver)
     {
-        invokers.SetAsFound1_0(config, algo, solver);
+        invokers->SetAsFound1_0(config, algo, solver);
     }
 
     std::optional<Invoker> GetInvoker(const NetworkConfig& config,
@@ -273,7 +297,7 @@ public:
         {
             MIOPEN_LOG_I2("Returning an invoker for problem " << config.ToString() << " and solver "
                                                               << solver->ToString());
-            return invokers[std::make_pair(config.ToString(), solver->ToString())];
+            return invokers->Get(config.ToString(), solver->ToString());
         }
 
         if(!algo)
@@ -281,15 +305,21 @@ public:
 
         MIOPEN_LOG_I2("Returning an invoker for problem " << config.ToString() << " and algorithm "
                                                           << algo->ToString());
-        return invokers.GetFound1_0(config, *algo);
+        return invokers->GetFound1_0(config, *algo);
     }
 
     std::optional<std::string> GetFound1_0SolverId(const NetworkConfig& config,
                                                    const AlgorithmName& algo) const
     {
-        return invokers.GetFound1_0SolverId(config, algo);
+        return invokers->GetFound1_0SolverId(config, algo);
     }
 
+    ApplicabilityCache& GetApplicabilityCache() const { return *applicability; }
+
+    conv::DecisionTableCache& GetDecisionTableCache() const { return *decision_tables; }
+
+    graphapi::ExecutionPlanCache& GetExecutionPlanCache() const { return *execution_plans; }
+
 #if MIOPEN_USE_ROCBLAS
     const rocblas_handle_ptr& rhandle() const;
 #endif
@@ -305,7 +335,14 @@ private:
     hipblasLt_handle_ptr CreateHipblasLtHandle() const;
 #endif
 
-    InvokerCache invokers;
+    // Shared with the child handles.
+    std::shared_ptr<InvokerCache> invokers            = std::make_shared<InvokerCache>();
+    std::shared_ptr<ApplicabilityCache> applicability = std::make_shared<ApplicabilityCache>();
+    // Loaded once the target properties are known.
+    std::shared_ptr<conv::DecisionTableCache> decision_tables;
+    // Engines of the Graph API operation graphs finalized with this handle.
+    std::shared_ptr<graphapi::ExecutionPlanCache> execution_plans =
+        std::make_shared<graphapi::ExecutionPlanCache>();
 };
 
 inline std::ostream& operator<<(std::ostream& os, const Handle& handle) { return handle.Print(os); }
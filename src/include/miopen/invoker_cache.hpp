@@ -26,24 +26,35 @@
 
 #pragma once
 
+#include <miopen/config.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/invoker.hpp>
 
-#include <map>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <optional>
 
 namespace miopen {
 
-class InvokerCache
+/// Lookups do not take the registration lock and may run concurrently with each other and with
+/// registrations, so threads sharing a handle do not contend on it. Registrations are serialized.
+/// Registering a key again replaces its invoker. The old one is released by the registration or,
+/// if a lookup is still copying it, by a later one.
+class MIOPEN_INTERNALS_EXPORT InvokerCache
 {
 public:
     // network_config, solver_id
     using Key = std::pair<std::string, std::string>;
 
+    InvokerCache();
+    InvokerCache(InvokerCache&&) noexcept;
+    InvokerCache& operator=(InvokerCache&&) noexcept;
+    ~InvokerCache();
+
     std::optional<Invoker> operator[](const Key& key) const;
+    std::optional<Invoker> Get(std::string_view network_config, std::string_view solver_id) const;
     // For find 1.0
     std::optional<Invoker> GetFound1_0(const std::string& network_config,
                                        const std::string& algorithm) const;
@@ -57,17 +68,11 @@ public:
                        const std::string& solver_id);
 
 private:
-    struct Item
-    {
-        // algorithm -> solver_id
-        // for find 1.0
-        std::map<std::string, std::string> found_1_0;
-        // solver_id -> invoker
-        std::map<std::string, Invoker> invokers;
-    };
+    template <class Value>
+    class Table;
+    struct Tables;
 
-    // network_config -> Item
-    std::map<std::string, Item> invokers;
+    std::unique_ptr<Tables> tables;
 };
 
 } // namespace miopen
@@ -42,10 +42,14 @@
 #ifndef GUARD_MIOPEN_KERNEL_CACHE_HPP_
 #define GUARD_MIOPEN_KERNEL_CACHE_HPP_
 
+#include <miopen/config.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/kernel.hpp>
 #include <miopen/simple_hash.hpp>
 #include <miopen/miopen.h>
+#include <array>
+#include <memory>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -56,13 +60,18 @@ namespace miopen {
 /**
  * @brief The KernelCache class Build and cache kernels
  *
+ * All members may be called concurrently. The maps are split into shards by the hash of the
+ * key, each with its own reader-writer lock, so lookups only take a shared lock and insertions
+ * only block the lookups that hash to the same shard. Programs are loaded or built outside of
+ * the locks. Kernel lists are immutable once published, GetKernels() returns a snapshot.
  */
-class KernelCache
+class MIOPEN_INTERNALS_EXPORT KernelCache
 {
 
 public:
     using Key        = std::pair<fs::path, std::string>;
-    using KernelMap  = std::unordered_map<Key, std::vector<Kernel>, SimpleHash>;
+    using Kernels    = std::shared_ptr<const std::vector<Kernel>>;
+    using KernelMap  = std::unordered_map<Key, Kernels, SimpleHash>;
     using ProgramMap = std::unordered_map<Key, Program, SimpleHash>;
 
     Kernel AddKernel(const Handle& h,
@@ -81,8 +90,7 @@ public:
 
     void ClearKernels(const std::string& algorithm, const std::string& network_config);
 
-    const std::vector<Kernel>& GetKernels(const std::string& algorithm,
-                                          const std::string& network_config);
+    Kernels GetKernels(const std::string& algorithm, const std::string& network_config) const;
 
     bool HasProgram(const fs::path& name, const std::string& params) const;
     void ClearProgram(const fs::path& name, const std::string& params);
@@ -92,8 +100,23 @@ public:
     KernelCache();
 
 private:
-    KernelMap kernel_map;
-    ProgramMap program_map;
+    static constexpr std::size_t shards_num = 16;
+
+    template <class Map>
+    struct Shard
+    {
+        mutable std::shared_mutex mutex;
+        Map map;
+    };
+
+    template <class Shards>
+    static auto& GetShard(Shards& shards, const Key& key)
+    {
+        return shards[SimpleHash{}(key) % shards_num];
+    }
+
+    std::array<Shard<KernelMap>, shards_num> kernel_shards;
+    std::array<Shard<ProgramMap>, shards_num> program_shards;
 };
 
 } // namespace miopen
@@ -28,6 +28,7 @@
 
 #include <miopen/filesystem.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/trace.hpp>
 
 #include <boost/date_time/posix_time/posix_time_duration.hpp>
 #include <boost/date_time/posix_time/posix_time_types.hpp>
@@ -76,11 +77,13 @@ public:
     }
     void lock()
     {
+        MIOPEN_TRACE_SCOPE_DETAIL("lock", "LockFile::lock", path.string());
         LockOperation("lock", MIOPEN_GET_FN_NAME, [&]() { std::lock(access_mutex, flock); });
     }
 
     void lock_shared()
     {
+        MIOPEN_TRACE_SCOPE_DETAIL("lock", "LockFile::lock_shared", path.string());
         access_mutex.lock_shared();
         try
         {
@@ -127,6 +130,7 @@ public:
     template <class TDuration>
     bool try_lock_for(TDuration duration)
     {
+        MIOPEN_TRACE_SCOPE_DETAIL("lock", "LockFile::try_lock_for", path.string());
         if(!access_mutex.try_lock_for(duration))
             return false;
 
@@ -141,6 +145,7 @@ public:
     template <class TDuration>
     bool try_lock_shared_for(TDuration duration)
     {
+        MIOPEN_TRACE_SCOPE_DETAIL("lock", "LockFile::try_lock_shared_for", path.string());
         if(!access_mutex.try_lock_shared_for(duration))
             return false;
 
@@ -37,6 +37,7 @@
 #include <miopen/each_args.hpp>
 #include <miopen/object.hpp>
 #include <miopen/config.hpp>
+#include <miopen/trace.hpp>
 
 #if MIOPEN_USE_ROCTRACER
 #include <roctracer/roctx.h>
@@ -222,6 +223,12 @@ MIOPEN_INTERNALS_EXPORT std::string LoggingLevelToCustomString(LoggingLevel leve
 MIOPEN_INTERNALS_EXPORT const char* LoggingLevelToCString(LoggingLevel level);
 MIOPEN_INTERNALS_EXPORT std::string LoggingPrefix();
 
+/// Writes the formatted message to stderr. With MIOPEN_LOG_ASYNC, it is queued and written on a
+/// background thread instead.
+MIOPEN_INTERNALS_EXPORT void LogWrite(std::string message);
+/// Blocks until the messages logged so far have been written.
+MIOPEN_INTERNALS_EXPORT void LogFlush();
+
 /// \return true if level is enabled.
 /// \param level - one of the values defined in LoggingLevel.
 MIOPEN_INTERNALS_EXPORT bool IsLogging(LoggingLevel level, bool disableQuieting = false);
@@ -256,6 +263,9 @@ inline void* LogObjImpl(void* x) { return x; }
 
 inline const void* LogObjImpl(const void* x) { return x; }
 
+// The functions logging their calls are traced as well.
+#define MIOPEN_TRACE_API_SPAN const miopen::trace::Span miopen_trace_api("api", __func__)
+
 #if !WORKAROUND_ISSUE_PP_TRANSFORM_ARGS
 template <class T, typename std::enable_if<(std::is_pointer<T>{}), int>::type = 0>
 std::ostream& LogParam(std::ostream& os, std::string name, const T& x, bool indent = true)
@@ -301,7 +311,7 @@ LogParam(std::ostream& os, std::string name, const std::vector<T>& vec, bool ind
         std::ostream& miopen_log_func_ostream = miopen_log_func_ss;             \
         miopen_log_func_ostream << miopen::LoggingPrefix();                     \
         miopen::LogParam(miopen_log_func_ostream, #param, param) << std::endl;  \
-        std::cerr << miopen_log_func_ss.str();                                  \
+        miopen::LogWrite(miopen_log_func_ss.str());                             \
     } while(false);
 
 #define MIOPEN_LOG_FUNCTION_EACH_ROCTX(param)                                     \
@@ -329,6 +339,7 @@ LogParam(std::ostream& os, std::string name, const std::vector<T>& vec, bool ind
 
 #define MIOPEN_LOG_FUNCTION(...)                                                        \
     MIOPEN_LOG_ROCTX_DEFINE_OBJECT                                                      \
+    MIOPEN_TRACE_API_SPAN;                                                              \
     do                                                                                  \
     {                                                                                   \
         if(miopen::IsLoggingFunctionCalls())                                            \
@@ -336,16 +347,16 @@ LogParam(std::ostream& os, std::string name, const std::vector<T>& vec, bool ind
             std::ostringstream miopen_log_func_ss;                                      \
             miopen_log_func_ss << miopen::LoggingPrefix() << __PRETTY_FUNCTION__ << "{" \
                                << std::endl;                                            \
-            std::cerr << miopen_log_func_ss.str();                                      \
+            miopen::LogWrite(miopen_log_func_ss.str());                                 \
             MIOPEN_PP_EACH_ARGS(MIOPEN_LOG_FUNCTION_EACH, __VA_ARGS__)                  \
             std::ostringstream().swap(miopen_log_func_ss);                              \
             miopen_log_func_ss << miopen::LoggingPrefix() << "}" << std::endl;          \
-            std::cerr << miopen_log_func_ss.str();                                      \
+            miopen::LogWrite(miopen_log_func_ss.str());                                 \
         }                                                                               \
         MIOPEN_LOG_ROCTX_DO_LOGGING(__VA_ARGS__)                                        \
     } while(false)
 #else
-#define MIOPEN_LOG_FUNCTION(...)
+#define MIOPEN_LOG_FUNCTION(...) MIOPEN_TRACE_API_SPAN
 #endif
 
 constexpr std::string_view LoggingParseFunction(const std::string_view func,
@@ -372,7 +383,7 @@ constexpr std::string_view LoggingParseFunction(const std::string_view func,
             std::ostringstream miopen_log_ss;                                               \
             miopen_log_ss << miopen::LoggingPrefix() << category << " [" << fn_name << "] " \
                           << __VA_ARGS__ << std::endl;                                      \
-            std::cerr << miopen_log_ss.str();                                               \
+            miopen::LogWrite(miopen_log_ss.str());                                          \
         }                                                                                   \
     } while(false)
 
@@ -411,7 +422,7 @@ constexpr std::string_view LoggingParseFunction(const std::string_view func,
         miopen_driver_cmd_ss << miopen::LoggingPrefix() << "Command"                         \
                              << " [" << MIOPEN_GET_FN_NAME << "] " driver " " << __VA_ARGS__ \
                              << std::endl;                                                   \
-        std::cerr << miopen_driver_cmd_ss.str();                                             \
+        miopen::LogWrite(miopen_driver_cmd_ss.str());                                        \
     } while(false)
 
 #ifdef _WIN32
@@ -26,34 +26,251 @@
 
 #pragma once
 
-#include <queue>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <mutex>
+#include <optional>
 
+/// Bounded multi-producer/multi-consumer queue. try_push() and try_pop() are lock free: every
+/// slot of the ring buffer has a sequence number that tells whether it holds an item and for
+/// which round, and producers and consumers claim positions with a CAS. The blocking and timed
+/// variants only take the mutex to sleep when the queue is full or empty.
+///
+/// Items are moved in and out. After close() all pending and future pushes fail, which lets
+/// consumers cancel producers that are still running, while the items already in the queue
+/// may still be popped.
 template <typename T>
 class ThreadSafeQueue
 {
-    std::mutex mutex;
-    std::condition_variable cond_var;
-    std::queue<T> queue;
-
 public:
-    void push(T&& item)
+    static constexpr std::size_t default_capacity = 1024;
+
+    ThreadSafeQueue() : ThreadSafeQueue(default_capacity) {}
+    explicit ThreadSafeQueue(std::size_t capacity_)
+        : capacity(capacity_ == 0 ? 1 : capacity_), cells(new cell[capacity])
     {
+        for(std::size_t i = 0; i < capacity; ++i)
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    ThreadSafeQueue(const ThreadSafeQueue&) = delete;
+    ThreadSafeQueue& operator=(const ThreadSafeQueue&) = delete;
+
+    /// Blocks while the queue is full. Returns false if the queue has been closed and the item
+    /// was not enqueued.
+    bool push(T&& item) { return push_until(std::move(item), time_point::max()); }
+
+    /// Returns false, leaving the item as it was, if the queue is full or closed.
+    bool try_push(T&& item)
+    {
+        if(closed.load(std::memory_order_acquire) || !enqueue(item))
+            return false;
+        wake(waiting_consumers, not_empty);
+        return true;
+    }
+
+    template <class Rep, class Period>
+    bool push_for(T&& item, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        return push_until(std::move(item), deadline(timeout));
+    }
+
+    /// Blocks until an item is available, also after close(). pop_for() and try_pop() return
+    /// nothing once the queue is closed and empty.
+    T pop() { return *pop_until(time_point::max(), false); }
+
+    std::optional<T> try_pop()
+    {
+        auto ret = dequeue();
+        if(ret)
+            wake(waiting_producers, not_full);
+        return ret;
+    }
 
+    /// Returns nothing on timeout or if the queue is closed and empty.
+    template <class Rep, class Period>
+    std::optional<T> pop_for(const std::chrono::duration<Rep, Period>& timeout)
+    {
+        return pop_until(deadline(timeout), true);
+    }
+
+    /// Wakes up all blocked producers and timed consumers.
+    void close()
+    {
+        closed.store(true, std::memory_order_release);
+        std::lock_guard<std::mutex> lock(mutex);
+        not_full.notify_all();
+        not_empty.notify_all();
+    }
+
+    bool is_closed() const { return closed.load(std::memory_order_acquire); }
+
+    /// Approximate while other threads push or pop.
+    std::size_t size() const
+    {
+        const auto tail = dequeue_pos.load(std::memory_order_relaxed);
+        const auto head = enqueue_pos.load(std::memory_order_relaxed);
+        return head > tail ? head - tail : 0;
+    }
+
+    std::size_t get_capacity() const { return capacity; }
+
+private:
+    using clock      = std::chrono::steady_clock;
+    using time_point = clock::time_point;
+
+    struct cell
+    {
+        std::atomic<std::size_t> sequence{0};
+        std::optional<T> item;
+    };
+
+    template <class Rep, class Period>
+    static time_point deadline(const std::chrono::duration<Rep, Period>& timeout)
+    {
+        return clock::now() + std::chrono::duration_cast<clock::duration>(timeout);
+    }
+
+    static std::ptrdiff_t distance(std::size_t sequence, std::size_t pos)
+    {
+        return static_cast<std::ptrdiff_t>(sequence - pos);
+    }
+
+    /// A cell is free for the position pos when its sequence is pos, and holds the item of
+    /// pos when it is pos + 1. Consumers release it for the next round with pos + capacity.
+    bool enqueue(T& item)
+    {
+        auto pos = enqueue_pos.load(std::memory_order_relaxed);
+        for(;;)
+        {
+            auto& c         = cells[pos % capacity];
+            const auto diff = distance(c.sequence.load(std::memory_order_acquire), pos);
+            if(diff == 0)
+            {
+                if(enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    c.item.emplace(std::move(item));
+                    c.sequence.store(pos + 1);
+                    return true;
+                }
+            }
+            else if(diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::optional<T> dequeue()
+    {
+        auto pos = dequeue_pos.load(std::memory_order_relaxed);
+        for(;;)
         {
-            std::lock_guard<std::mutex> lock(mutex);
-            queue.push(item);
+            auto& c         = cells[pos % capacity];
+            const auto diff = distance(c.sequence.load(std::memory_order_acquire), pos + 1);
+            if(diff == 0)
+            {
+                if(dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    std::optional<T> ret{std::move(*c.item)};
+                    c.item.reset();
+                    c.sequence.store(pos + capacity);
+                    return ret;
+                }
+            }
+            else if(diff < 0)
+            {
+                return std::nullopt;
+            }
+            else
+            {
+                pos = dequeue_pos.load(std::memory_order_relaxed);
+            }
         }
+    }
+
+    bool can_push() const
+    {
+        const auto pos = enqueue_pos.load(std::memory_order_relaxed);
+        return distance(cells[pos % capacity].sequence.load(), pos) >= 0;
+    }
+
+    bool can_pop() const
+    {
+        const auto pos = dequeue_pos.load(std::memory_order_relaxed);
+        return distance(cells[pos % capacity].sequence.load(), pos + 1) >= 0;
+    }
 
-        cond_var.notify_one();
+    /// The sequence stores that publish or release a cell, the waiting counters and the reads
+    /// of can_push()/can_pop() are sequentially consistent, so either the waker sees the waiter
+    /// or the waiter sees the new state of the queue before it sleeps.
+    void wake(const std::atomic<std::size_t>& waiting, std::condition_variable& cond)
+    {
+        if(waiting.load() == 0)
+            return;
+        std::lock_guard<std::mutex> lock(mutex);
+        cond.notify_all();
     }
-    T pop()
+
+    template <class Ready>
+    bool sleep(std::atomic<std::size_t>& waiting,
+               std::condition_variable& cond,
+               time_point until,
+               Ready ready)
     {
         std::unique_lock<std::mutex> lock(mutex);
-        cond_var.wait(lock, [&] { return !queue.empty(); });
-        T ret = queue.front();
-        queue.pop();
-        return ret;
+        waiting.fetch_add(1);
+        const auto woken = until == time_point::max() ? (cond.wait(lock, ready), true)
+                                                      : cond.wait_until(lock, until, ready);
+        waiting.fetch_sub(1);
+        return woken;
+    }
+
+    bool push_until(T&& item, time_point until)
+    {
+        for(;;)
+        {
+            if(try_push(std::move(item)))
+                return true;
+            if(is_closed())
+                return false;
+            const auto ready = [&] { return is_closed() || can_push(); };
+            if(!sleep(waiting_producers, not_full, until, ready))
+                return false;
+        }
+    }
+
+    std::optional<T> pop_until(time_point until, bool stop_on_close)
+    {
+        for(;;)
+        {
+            if(auto ret = try_pop())
+                return ret;
+            if(stop_on_close && is_closed())
+                return std::nullopt;
+            const auto ready = [&] { return (stop_on_close && is_closed()) || can_pop(); };
+            if(!sleep(waiting_consumers, not_empty, until, ready))
+                return std::nullopt;
+        }
     }
+
+    const std::size_t capacity;
+    std::unique_ptr<cell[]> cells;
+    // producers and consumers are on separate cache lines
+    alignas(64) std::atomic<std::size_t> enqueue_pos{0};
+    alignas(64) std::atomic<std::size_t> dequeue_pos{0};
+    alignas(64) std::atomic<bool> closed{false};
+    std::atomic<std::size_t> waiting_producers{0};
+    std::atomic<std::size_t> waiting_consumers{0};
+    std::mutex mutex;
+    std::condition_variable not_full;
+    std::condition_variable not_empty;
 };
@@ -59,7 +59,7 @@ struct HandleImpl
     std::size_t warp_size          = 64;
     std::size_t max_mem_alloc_size = 0;
     Allocator allocator{};
-    KernelCache cache;
+    std::shared_ptr<KernelCache> cache = std::make_shared<KernelCache>();
     std::int64_t ctx;
     TargetProperties target_properties;
 };
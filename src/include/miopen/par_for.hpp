@@ -27,10 +27,17 @@
 #ifndef MIOPEN_GUARD_MLOPEN_PAR_FOR_HPP
 #define MIOPEN_GUARD_MLOPEN_PAR_FOR_HPP
 
+#include <miopen/thread_pool.hpp>
+
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
+#include <condition_variable>
+#include <exception>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <vector>
 
@@ -38,60 +45,90 @@
 
 namespace miopen {
 
-struct joinable_thread : std::thread
+/// Runs f(0) ... f(n - 1) on the calling thread and up to threadsize - 1 tasks of the shared
+/// thread_pool. Each of them takes the next chunk of iterations until none is left, with a few
+/// chunks per thread, so that uneven iterations don't leave threads idle. The first exception
+/// thrown by f is rethrown once all of them are done.
+///
+/// The calling thread never runs other tasks of the pool, which may be long or wait for it.
+/// Having run out of chunks, it closes the call: the tasks which have not started yet do
+/// nothing, and it blocks until the started ones finish their chunks.
+template <class F>
+void par_for_impl(std::size_t n, std::size_t threadsize, F f)
 {
-    template <class... Xs>
-    joinable_thread(Xs&&... xs) : std::thread(std::forward<Xs>(xs)...) // NOLINT
+    auto& pool = thread_pool::get();
+    threadsize = std::min(threadsize, pool.size() + 1);
+    if(threadsize <= 1 || n <= 1)
     {
+        for(std::size_t i = 0; i < n; i++)
+            f(i);
+        return;
     }
 
-    joinable_thread& operator=(joinable_thread&& other) = default;
-    joinable_thread(joinable_thread&& other)            = default;
-
-    ~joinable_thread()
+    // outlives the call, because the tasks which have not started yet still check it
+    struct call_state
     {
-        if(this->joinable())
-            this->join();
-    }
-};
+        std::mutex mutex;
+        std::condition_variable done;
+        std::size_t active = 0;
+        bool closed        = false;
+    };
+    const auto state = std::make_shared<call_state>();
+
+    const std::size_t grainsize = std::max<std::size_t>(1, n / (threadsize * 4));
+    std::atomic<std::size_t> next{0};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    // every thread calls its own copy of f, as when each of them was spawned with one
+    const auto run = [&](F g) {
+        try
+        {
+            for(auto start = next.fetch_add(grainsize); start < n;)
+            {
+                const auto last = std::min(n, start + grainsize);
+                for(std::size_t i = start; i < last; i++)
+                    g(i);
+                start = next.fetch_add(grainsize);
+            }
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if(!error)
+                error = std::current_exception();
+            // the other threads skip the remaining iterations
+            next = n;
+        }
+    };
 
-struct thread_factory
-{
-    template <class F>
-    joinable_thread operator()(std::size_t& work, std::size_t n, std::size_t grainsize, F f) const
+    for(std::size_t k = 1; k < threadsize; k++)
     {
-        auto result = joinable_thread([=] {
-            std::size_t start = work;
-            std::size_t last  = std::min(n, work + grainsize);
-            for(std::size_t i = start; i < last; i++)
+        pool.submit([state, &run, &f] {
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if(state->closed)
+                    return;
+                ++state->active;
+            }
+            run(f);
             {
-                f(i);
+                std::lock_guard<std::mutex> lock(state->mutex);
+                --state->active;
             }
+            state->done.notify_one();
         });
-        work += grainsize;
-        return result;
     }
-};
+    run(f);
 
-template <class F>
-void par_for_impl(std::size_t n, std::size_t threadsize, F f)
-{
-    if(threadsize <= 1)
-    {
-        for(std::size_t i = 0; i < n; i++)
-            f(i);
-    }
-    else
     {
-        std::vector<joinable_thread> threads(threadsize);
-        const std::size_t grainsize = std::ceil(static_cast<double>(n) / threads.size());
-
-        std::size_t work = 0;
-        std::generate(threads.begin(),
-                      threads.end(),
-                      std::bind(thread_factory{}, std::ref(work), n, grainsize, f));
-        assert(work >= n);
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->closed = true;
+        state->done.wait(lock, [&] { return state->active == 0; });
     }
+
+    if(error)
+        std::rethrow_exception(error);
 }
 
 template <class F>
@@ -50,11 +50,21 @@ struct FindDbData : solver::Serializable<FindDbData>
     float time;
     std::size_t workspace;
     std::string algorithm;
+    std::string statistic; // how the time was computed from several runs, see TimingResult
+    float variance;
 
-    FindDbData() : time(-1), workspace(-1), algorithm("<invalid>") {}
+    FindDbData() : time(-1), workspace(-1), algorithm("<invalid>"), statistic(), variance(0) {}
 
-    FindDbData(float time_, std::size_t workspace_, const std::string& algorithm_)
-        : time(time_), workspace(workspace_), algorithm(algorithm_)
+    FindDbData(float time_,
+               std::size_t workspace_,
+               const std::string& algorithm_,
+               const std::string& statistic_ = "",
+               float variance_               = 0)
+        : time(time_),
+          workspace(workspace_),
+          algorithm(algorithm_),
+          statistic(statistic_),
+          variance(variance_)
     {
     }
 
@@ -64,8 +74,39 @@ struct FindDbData : solver::Serializable<FindDbData>
         f(self.time, "time");
         f(self.workspace, "workspace");
         f(self.algorithm, "algorithm");
+        f(self.statistic, "statistic");
+        f(self.variance, "variance");
     }
 
+    bool Deserialize(const std::string& s)
+    {
+        if(solver::Serializable<FindDbData>::Deserialize(s))
+            return true;
+
+        // Records written before the statistic and variance were added.
+        Legacy legacy;
+        if(!legacy.Deserialize(s))
+            return false;
+        *this = {legacy.time, legacy.workspace, legacy.algorithm};
+        return true;
+    }
+
+private:
+    struct Legacy : solver::Serializable<Legacy>
+    {
+        float time            = -1;
+        std::size_t workspace = -1;
+        std::string algorithm;
+
+        template <class Self, class F>
+        static void Visit(Self&& self, F f)
+        {
+            f(self.time, "time");
+            f(self.workspace, "workspace");
+            f(self.algorithm, "algorithm");
+        }
+    };
+
     friend std::ostream& operator<<(std::ostream& os, const FindDbData& obj)
     {
         obj.Serialize(os);
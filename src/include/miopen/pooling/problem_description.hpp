@@ -27,6 +27,7 @@
 #pragma once
 
 #include <miopen/problem_description_base.hpp>
+#include <miopen/problem_key.hpp>
 #include <miopen/tensor.hpp>
 #include <miopen/pooling.hpp>
 
@@ -100,9 +101,12 @@ struct ProblemDescription
         return save_index;
     }
 
+    ProblemKey MakeKey() const;
     NetworkConfig MakeNetworkConfig() const;
 
 private:
+    std::string MakeNetworkConfigText() const;
+
     Direction direction;
     PoolingDescriptor pooling;
     TensorDescriptor xDesc;
@@ -0,0 +1,183 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/config.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace miopen {
+
+class TensorDescriptor;
+
+/// Fixed-size binary identity of a problem description. Unlike the text forms (network configs
+/// and db keys) it is built without any formatting and is cheap to hash and compare, so hot-path
+/// caches use it. The text forms remain the keys of the on-disk databases, see
+/// ProblemKeyTextCache.
+class MIOPEN_INTERNALS_EXPORT ProblemKey
+{
+public:
+    /// Bump when the content of any kind of key changes.
+    static constexpr std::uint32_t version = 1;
+    static constexpr std::size_t capacity  = 64;
+
+    enum class Kind : std::uint32_t
+    {
+        Convolution = 1,
+        Batchnorm,
+        Pooling,
+    };
+
+    explicit ProblemKey(Kind kind)
+    {
+        Push(std::uint64_t{static_cast<std::uint32_t>(kind)} << 32 | version);
+    }
+
+    template <class T, std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>, bool> = true>
+    void Add(T value)
+    {
+        Push(static_cast<std::uint64_t>(value));
+    }
+
+    template <class T>
+    void Add(const std::optional<T>& value)
+    {
+        Push(value ? static_cast<std::uint64_t>(*value) + 1 : 0);
+    }
+
+    template <class T>
+    void Add(const std::vector<T>& values)
+    {
+        Push(values.size());
+        for(const auto& value : values)
+            Add(value);
+    }
+
+    void Add(std::string_view str);
+    void Add(const TensorDescriptor& desc);
+
+    /// Keys that did not fit into the capacity can't be used.
+    bool IsValid() const { return size <= capacity; }
+    std::size_t Hash() const;
+
+    friend bool operator==(const ProblemKey& lhs, const ProblemKey& rhs)
+    {
+        const auto bytes = lhs.Used() * sizeof(std::uint64_t);
+        return lhs.size == rhs.size && std::memcmp(lhs.words.data(), rhs.words.data(), bytes) == 0;
+    }
+    friend bool operator!=(const ProblemKey& lhs, const ProblemKey& rhs) { return !(lhs == rhs); }
+
+private:
+    void Push(std::uint64_t word)
+    {
+        if(size < capacity)
+            words[size] = word;
+        ++size;
+    }
+    std::size_t Used() const { return size < capacity ? size : capacity; }
+
+    std::array<std::uint64_t, capacity> words{};
+    std::size_t size = 0;
+};
+
+struct ProblemKeyHash
+{
+    std::size_t operator()(const ProblemKey& key) const { return key.Hash(); }
+};
+
+/// Maps binary keys to a text form, so the text is formatted once per distinct problem.
+/// The mapping is stable because the text is produced by the same function as before; the
+/// binary key only has to cover everything that function reads.
+///
+/// The instances are meant to be thread_local, so the lookups take no locks and do not contend.
+/// The cache is set-associative: a new problem only replaces the oldest text of its set, so no
+/// working set of a few hundred problems is thrown away at once.
+class MIOPEN_INTERNALS_EXPORT ProblemKeyTextCache
+{
+public:
+    /// The text stays valid until the next call on the same cache.
+    template <class F>
+    const std::string& Get(const ProblemKey& key, F&& make)
+    {
+        if(!key.IsValid() || !IsEnabled())
+        {
+            uncached = make();
+            return uncached;
+        }
+
+        const auto hash = key.Hash();
+        auto& set       = sets[hash & (set_count - 1)];
+        for(const auto& entry : set.entries)
+        {
+            if(entry != nullptr && entry->hash == hash && entry->key == key)
+                return entry->text;
+        }
+
+        auto fresh  = Entry{hash, key, make()};
+        auto& entry = set.entries[set.next++ % ways];
+        if(entry == nullptr)
+            entry = std::make_unique<Entry>(std::move(fresh));
+        else
+            *entry = std::move(fresh);
+        return entry->text;
+    }
+
+    /// Disabling makes every call format the text, e.g. to measure the savings.
+    static bool IsEnabled();
+    static void SetEnabled(bool enabled);
+
+private:
+    static constexpr std::size_t set_count = 256;
+    static constexpr std::size_t ways      = 4;
+
+    struct Entry
+    {
+        std::size_t hash;
+        ProblemKey key;
+        std::string text;
+    };
+
+    /// The entries are allocated on first use, so idle threads only hold the pointers.
+    struct Set
+    {
+        std::array<std::unique_ptr<Entry>, ways> entries;
+        std::size_t next = 0;
+    };
+
+    std::array<Set, set_count> sets;
+    std::string uncached;
+};
+
+} // namespace miopen
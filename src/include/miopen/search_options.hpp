@@ -30,9 +30,12 @@
 
 #include <miopen/common.hpp>
 #include <miopen/find_controls.hpp>
+#include <miopen/find_monitor.hpp>
 #include <miopen/object.hpp>
+#include <miopen/timing_policy.hpp>
 
 #include <limits>
+#include <memory>
 #include <unordered_map>
 #include <optional>
 
@@ -53,6 +56,9 @@ struct FindOptions : miopenFindOptions
     std::optional<Workspace> preallocated_workspace;
     std::optional<FindEnforce> find_enforce;
     bool attach_binaries = false;
+    TimingPolicy timing_policy;
+    // Progress callback and cancellation, may be null.
+    std::shared_ptr<FindMonitor> monitor;
 };
 
 } // namespace miopen
@@ -68,6 +74,7 @@ inline std::ostream& operator<<(std::ostream& stream, const miopen::FindOptions&
     case miopenFindResultsOrderByWorkspaceSize: stream << "by workspace size"; break;
     }
     stream << ", workspace limit: " << options.workspace_limit;
+    stream << ", timing: " << options.timing_policy;
     stream << ")";
     return stream;
 }
@@ -34,6 +34,7 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cstddef>
 #include <tuple>
 #include <vector>
 
@@ -59,6 +60,14 @@ class Sequence
     // returns iterator pointing to element of sequence equal to value or end().
     // this method may not be implemented. boost::find will be used instead than.
     constexpr <unspecified> find(TValue value) const;
+
+    // returns the number of values. this method may not be implemented. the values will be
+    // counted instead than.
+    constexpr std::size_t size() const;
+
+    // returns the n-th value. this method may not be implemented. begin() will be advanced n
+    // times instead than.
+    constexpr value_type nth(std::size_t n) const;
 }
 
 'value_type' may have any constraints depending on specific sequences but it also must have
@@ -88,6 +97,9 @@ value tupples. Affects all the fields speceified. Has several methods:
         specified fields of provided values.
     bool IsEqualToBegin(const Container& container) const - helper method comparing specified
         fields of provided value with begin()s.
+    std::size_t Size() const - number of permutations, i.e. product of sizes of the sequences.
+    void FillNth(Container& container, std::size_t n) const - fills provided structure with n-th
+        permutation in the order of Next(...). Allows random access to the set of permutations.
 
 Here Container means type fullfiling member definitions. In most cases member definition will look
 like &S::x, meaning that Container means S. There are no other constraints for it.
@@ -180,6 +192,53 @@ auto GenericFind(const TRange& range, const TValue& value)
     return GenericFindImpl(rank<16>{}, range, value);
 }
 
+template <class TSequence>
+auto SeqSizeImpl(rank<1>, const TSequence& seq) -> decltype(seq.size())
+{
+    return seq.size();
+}
+
+template <class TSequence>
+std::size_t SeqSizeImpl(rank<0>, const TSequence& seq)
+{
+    std::size_t size = 0;
+    for(auto it = seq.begin(); it != seq.end(); ++it)
+        ++size;
+    return size;
+}
+
+/// Returns the number of values in a sequence.
+template <class TSequence>
+std::size_t SeqSize(const TSequence& seq)
+{
+    return SeqSizeImpl(rank<16>{}, seq);
+}
+
+template <class TSequence>
+auto SeqNthImpl(rank<1>, const TSequence& seq, std::size_t n) -> decltype(seq.nth(n))
+{
+    return seq.nth(n);
+}
+
+template <class TSequence>
+typename TSequence::value_type SeqNthImpl(rank<0>, const TSequence& seq, std::size_t n)
+{
+    auto it = seq.begin();
+    for(; n != 0; --n)
+    {
+        assert(it != seq.end());
+        ++it;
+    }
+    return *it;
+}
+
+/// Returns the n-th value of a sequence. n shall be less than SeqSize(seq).
+template <class TSequence>
+typename TSequence::value_type SeqNth(const TSequence& seq, std::size_t n)
+{
+    return SeqNthImpl(rank<16>{}, seq, n);
+}
+
 /// The simpliest of sequences provided. It contains int values supplied as template arguments.
 template <class TValue, TValue... values>
 struct Sequence
@@ -200,6 +259,8 @@ struct Sequence
     {
         return std::next(data.begin(), find_(value));
     }
+    constexpr std::size_t size() const { return sizeof...(values); }
+    constexpr value_type nth(std::size_t n) const { return data[n]; }
 
 private:
     static constexpr std::array<int, sizeof...(values)> data = {{values...}};
@@ -303,6 +364,8 @@ struct Span
             return {value};
         return end();
     }
+    constexpr std::size_t size() const { return high - low + 1; }
+    constexpr value_type nth(std::size_t n) const { return low + static_cast<TValue>(n); }
 };
 
 template <class TValue, TValue high>
@@ -354,6 +417,14 @@ struct TwoPowersSpan
 
         return end();
     }
+    constexpr std::size_t size() const
+    {
+        std::size_t size = 1;
+        for(auto i = low; i < high; i *= 2)
+            ++size;
+        return size;
+    }
+    constexpr value_type nth(std::size_t n) const { return low << n; }
 
 private:
     static constexpr bool IsTwoPower(TValue i) { return ((i - 1) & i) == 0; }
@@ -455,8 +526,36 @@ struct Join
     constexpr const_iterator begin() const { return {*first.begin()}; }
     constexpr const_iterator end() const { return {}; }
     constexpr const_iterator find(value_type value) const { return find_(value); }
+    std::size_t size() const { return parts.size(); }
+    value_type nth(std::size_t n) const { return parts.nth(n); }
 
 private:
+    template <class TCur, class... TRest_>
+    struct Parts
+    {
+        std::size_t size() const { return SeqSize(cur) + rest.size(); }
+
+        value_type nth(std::size_t n) const
+        {
+            const auto cur_size = SeqSize(cur);
+            return n < cur_size ? SeqNth(cur, n) : rest.nth(n - cur_size);
+        }
+
+    private:
+        TCur cur              = {};
+        Parts<TRest_...> rest = {};
+    };
+
+    template <class TSeq>
+    struct Parts<TSeq>
+    {
+        std::size_t size() const { return SeqSize(seq); }
+        value_type nth(std::size_t n) const { return SeqNth(seq, n); }
+
+    private:
+        TSeq seq = {};
+    };
+
     template <class TCur, class... TRest_>
     struct Find
     {
@@ -504,8 +603,9 @@ private:
         return true;
     }
 
-    TFirst first                 = {};
-    Find<TFirst, TRest...> find_ = {};
+    TFirst first                  = {};
+    Find<TFirst, TRest...> find_  = {};
+    Parts<TFirst, TRest...> parts = {};
 };
 
 template <class TInner, typename TInner::value_type mul>
@@ -550,6 +650,8 @@ struct Multiplied
     {
         return {GenericFind(inner, value / mul)};
     }
+    std::size_t size() const { return SeqSize(inner); }
+    value_type nth(std::size_t n) const { return mul * SeqNth(inner, n); }
 
 private:
     TInner inner = {};
@@ -664,6 +766,13 @@ struct Rule
 
     void FillBegin(Container& container) const { member.LV(container) = *sequence.begin(); }
 
+    std::size_t Size() const { return SeqSize(sequence); }
+
+    void FillNth(Container& container, std::size_t n) const
+    {
+        member.LV(container) = SeqNth(sequence, n);
+    }
+
     /// Compares provided members of two values.
     bool Compare(const Container& left, const Container& right) const
     {
@@ -704,6 +813,14 @@ struct RuleSet
 
     void FillBegin(Container& container) const { impl.FillBegin(container); }
 
+    /// Returns the number of value combinations described by the rules.
+    std::size_t Size() const { return impl.Size(); }
+
+    /// Fills the container with n-th combination in the order of Next. FillNth(c, 0) is equal to
+    /// FillBegin(c) and FillNth(c, i + 1) is equal to FillNth(c, i) followed by Next(c).
+    /// The first rule varies fastest. n shall be less than Size().
+    void FillNth(Container& container, std::size_t n) const { impl.FillNth(container, n); }
+
     /// Compares all the fields specified in rules.
     bool Compare(const Container& left, const Container& right) const
     {
@@ -743,6 +860,15 @@ private:
             rest.FillBegin(container);
         }
 
+        std::size_t Size() const { return rule.Size() * rest.Size(); }
+
+        void FillNth(Container& container, std::size_t n) const
+        {
+            const auto size = rule.Size();
+            rule.FillNth(container, n % size);
+            rest.FillNth(container, n / size);
+        }
+
         bool Compare(const Container& left, const Container& right) const
         {
             return rule.Compare(left, right) && rest.Compare(left, right);
@@ -769,6 +895,10 @@ private:
 
         void FillBegin(Container& container) const { rule.FillBegin(container); }
 
+        std::size_t Size() const { return rule.Size(); }
+
+        void FillNth(Container& container, std::size_t n) const { rule.FillNth(container, n); }
+
         bool Compare(const Container& left, const Container& right) const
         {
             return rule.Compare(left, right);
@@ -101,6 +101,9 @@ struct MIOPEN_INTERNALS_EXPORT Solution : miopenSolution
 
     float GetTime() const { return time; }
     void SetTime(float value) { time = value; }
+    /// Time is the median of several runs, see TimingPolicy.
+    float GetTimeVariance() const { return time_variance; }
+    void SetTimeVariance(float value) { time_variance = value; }
     std::size_t GetWorkspaceSize() const { return workspace_required; }
     void SetWorkspaceSize(std::size_t value) { workspace_required = value; }
     const solver::Id& GetSolver() const { return solver; }
@@ -108,6 +111,10 @@ struct MIOPEN_INTERNALS_EXPORT Solution : miopenSolution
     void SetPerfConfig(const std::optional<std::string>& cfg) { perf_cfg = cfg; }
     const ProblemContainer& GetProblem() const { return problem; }
     void SetProblem(ProblemContainer value) { problem = std::move(value); }
+    /// Set for the results of a cancelled find. Their search or measurement has been cut short,
+    /// so the time may be unknown (the maximum float). Not serialized.
+    bool IsPartial() const { return partial; }
+    void SetPartial(bool value) { partial = value; }
 
     void Run(Handle& handle,
              const std::unordered_map<miopenTensorArgumentId_t, RunInput>& inputs,
@@ -150,10 +157,12 @@ struct MIOPEN_INTERNALS_EXPORT Solution : miopenSolution
 
 private:
     float time                     = 0;
+    float time_variance            = 0;
     std::size_t workspace_required = 0;
     solver::Id solver;
     ProblemContainer problem;
     std::optional<std::string> perf_cfg = std::nullopt;
+    bool partial                        = false;
     std::optional<Invoker> invoker;
     std::vector<KernelInfo> kernels;
 
@@ -30,6 +30,7 @@
 #include <miopen/config.hpp>
 
 #include <miopen/buffer_info.hpp>
+#include <miopen/conv/heuristics/roofline.hpp>
 #include <miopen/conv/problem_description.hpp>
 #include <miopen/conv_solution.hpp>
 #include <miopen/execution_context.hpp>
@@ -100,6 +101,11 @@ struct SolverBase
     /// GetDefaultPerformanceConfig() so that GetSolution() would return valid
     /// solution for a problem (i.e. convolution). In other words, if a Solution
     /// says "I'm suitable" for a problem, it agrees to solve that problem correctly.
+    ///
+    /// With MIOPEN_APPLICABILITY_THREADS_MAX other than 1, the checks of all the solvers of a
+    /// container run concurrently on the same context and problem. The implementations must not
+    /// modify shared state then: function-local statics are fine, lazily filled caches must be
+    /// synchronized, and the handle may only be queried.
     virtual bool IsApplicable(const ExecutionContext& ctx, const boost::any& problem) const = 0;
 
     /// [Informative as of Sep 2020] The minimum requirement for Dynamic Solvers:
@@ -155,6 +161,12 @@ struct SolverMixin : SolverBase
 
     virtual bool IsApplicable(const Context&, const Problem&) const = 0;
     virtual float GetWti(const Context&, const Problem&) const { return wti_approximate_worst; };
+    /// Describes the kernels to the roofline cost model of the immediate mode fallback.
+    /// The default has no efficiency, so the model falls back to GetWti() and the algorithm.
+    virtual miopen::conv::RooflineParams GetRooflineParams(const Context&, const Problem&) const
+    {
+        return {};
+    };
     virtual size_t GetWorkspaceSize(const Context&, const Problem&) const { return 0; };
 
     bool IsApplicable(const ExecutionContext& ctx, const boost::any& problem) const final
@@ -299,6 +311,24 @@ template <class PerformanceConfig>
 using ConvTunableSolver =
     TunableSolverMixin<ExecutionContext, miopen::conv::ProblemDescription, PerformanceConfig>;
 
+/// Base class for the composable kernel implicit GEMM solvers on the matrix cores, which
+/// describe the tile of their default instances to the roofline cost model.
+template <class PerformanceConfig>
+struct ConvCkXdlopsTunableSolver : ConvTunableSolver<PerformanceConfig>
+{
+    miopen::conv::RooflineParams
+    GetRooflineParams(const ExecutionContext&,
+                      const miopen::conv::ProblemDescription&) const override
+    {
+        auto params         = miopen::conv::RooflineParams{};
+        params.efficiency   = 0.5f;
+        params.matrix_cores = true;
+        params.tile_m       = 256;
+        params.tile_n       = 128;
+        return params;
+    }
+};
+
 struct PerformanceConfigConvAsm3x3U : PerfConfigBase<PerformanceConfigConvAsm3x3U>
 {
     int limit_wave_cnt;        // [0..9]
@@ -4505,7 +4535,7 @@ private:
 };
 
 struct ConvHipImplicitGemmFwdXdlops final
-    : ConvTunableSolver<PerformanceConfigHipImplicitGemmFwdXdlops>
+    : ConvCkXdlopsTunableSolver<PerformanceConfigHipImplicitGemmFwdXdlops>
 {
     const std::string& SolverDbId() const override
     {
@@ -4544,7 +4574,6 @@ struct ConvHipImplicitGemmFwdXdlops final
     {
         return 0.02f;
     };
-
 private:
     template <typename DataType>
     bool CheckCKApplicability(const miopen::conv::ProblemDescription&) const;
@@ -4587,7 +4616,7 @@ private:
 };
 
 struct ConvHipImplicitGemmBwdXdlops final
-    : ConvTunableSolver<PerformanceConfigHipImplicitGemmBwdXdlops>
+    : ConvCkXdlopsTunableSolver<PerformanceConfigHipImplicitGemmBwdXdlops>
 {
     const std::string& SolverDbId() const override
     {
@@ -4616,7 +4645,6 @@ struct ConvHipImplicitGemmBwdXdlops final
     {
         return 0.02f;
     };
-
 private:
     template <typename DataType>
     bool CheckCKApplicability(const miopen::conv::ProblemDescription&) const;
@@ -4672,7 +4700,7 @@ private:
 };
 
 struct ConvHipImplicitGemmGroupFwdXdlops final
-    : ConvTunableSolver<PerformanceConfigHipImplicitGemmGroupFwdXdlops>
+    : ConvCkXdlopsTunableSolver<PerformanceConfigHipImplicitGemmGroupFwdXdlops>
 {
     const std::string& SolverDbId() const override
     {
@@ -4702,7 +4730,6 @@ struct ConvHipImplicitGemmGroupFwdXdlops final
     {
         return 0.02f;
     };
-
     MIOPEN_INTERNALS_EXPORT size_t GetWorkspaceSize(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     bool MayNeedWorkspace() const override { return true; }
@@ -4749,7 +4776,7 @@ private:
 };
 
 struct ConvHipImplicitGemm3DGroupFwdXdlops final
-    : ConvTunableSolver<PerformanceConfigHipImplicitGemm3DGroupFwdXdlops>
+    : ConvCkXdlopsTunableSolver<PerformanceConfigHipImplicitGemm3DGroupFwdXdlops>
 {
     const std::string& SolverDbId() const override
     {
@@ -4779,7 +4806,6 @@ struct ConvHipImplicitGemm3DGroupFwdXdlops final
     {
         return 0.02f;
     };
-
     MIOPEN_INTERNALS_EXPORT size_t GetWorkspaceSize(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     bool MayNeedWorkspace() const override { return true; }
@@ -4826,7 +4852,7 @@ private:
 };
 
 struct ConvHipImplicitGemm3DGroupWrwXdlops final
-    : ConvTunableSolver<PerformanceConfigHipImplicitGemm3DGroupWrwXdlops>
+    : ConvCkXdlopsTunableSolver<PerformanceConfigHipImplicitGemm3DGroupWrwXdlops>
 {
     const std::string& SolverDbId() const override
     {
@@ -4856,7 +4882,6 @@ struct ConvHipImplicitGemm3DGroupWrwXdlops final
     {
         return 0.02f;
     };
-
     MIOPEN_INTERNALS_EXPORT size_t GetWorkspaceSize(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     bool MayNeedWorkspace() const override { return true; }
@@ -4903,7 +4928,7 @@ private:
 };
 
 struct ConvHipImplicitGemm3DGroupBwdXdlops final
-    : ConvTunableSolver<PerformanceConfigHipImplicitGemm3DGroupBwdXdlops>
+    : ConvCkXdlopsTunableSolver<PerformanceConfigHipImplicitGemm3DGroupBwdXdlops>
 {
     const std::string& SolverDbId() const override
     {
@@ -4933,7 +4958,6 @@ struct ConvHipImplicitGemm3DGroupBwdXdlops final
     {
         return 0.02f;
     };
-
     MIOPEN_INTERNALS_EXPORT size_t GetWorkspaceSize(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     bool MayNeedWorkspace() const override { return true; }
@@ -4994,7 +5018,7 @@ private:
 };
 
 struct ConvHipImplicitGemmGroupBwdXdlops final
-    : ConvTunableSolver<PerformanceConfigHipImplicitGemmGroupBwdXdlops>
+    : ConvCkXdlopsTunableSolver<PerformanceConfigHipImplicitGemmGroupBwdXdlops>
 {
     const std::string& SolverDbId() const override
     {
@@ -5024,7 +5048,6 @@ struct ConvHipImplicitGemmGroupBwdXdlops final
     {
         return 0.02f;
     };
-
     MIOPEN_INTERNALS_EXPORT size_t GetWorkspaceSize(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     bool MayNeedWorkspace() const override { return true; }
@@ -5088,7 +5111,7 @@ private:
 };
 
 struct ConvHipImplicitGemmGroupWrwXdlops final
-    : ConvTunableSolver<PerformanceConfigHipImplicitGemmGroupWrwXdlops>
+    : ConvCkXdlopsTunableSolver<PerformanceConfigHipImplicitGemmGroupWrwXdlops>
 {
     const std::string& SolverDbId() const override
     {
@@ -5118,7 +5141,6 @@ struct ConvHipImplicitGemmGroupWrwXdlops final
     {
         return 0.02f;
     };
-
     MIOPEN_INTERNALS_EXPORT size_t GetWorkspaceSize(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     bool MayNeedWorkspace() const override { return true; }
@@ -5165,7 +5187,7 @@ private:
 };
 
 struct ConvHipImplicitGemmF16F8F16FwdXdlops final
-    : ConvTunableSolver<PerformanceConfigHipImplicitGemmF16F8F16FwdXdlops>
+    : ConvCkXdlopsTunableSolver<PerformanceConfigHipImplicitGemmF16F8F16FwdXdlops>
 {
     const std::string& SolverDbId() const override
     {
@@ -5195,7 +5217,6 @@ struct ConvHipImplicitGemmF16F8F16FwdXdlops final
     {
         return 0.02f;
     };
-
 private:
     template <typename DataType, typename ComputeType>
     bool CheckCKApplicability(const miopen::conv::ProblemDescription&) const;
@@ -5238,7 +5259,7 @@ private:
 };
 
 struct ConvHipImplicitGemmF16F8F16BwdXdlops final
-    : ConvTunableSolver<PerformanceConfigHipImplicitGemmF16F8F16BwdXdlops>
+    : ConvCkXdlopsTunableSolver<PerformanceConfigHipImplicitGemmF16F8F16BwdXdlops>
 {
     const std::string& SolverDbId() const override
     {
@@ -5268,7 +5289,6 @@ struct ConvHipImplicitGemmF16F8F16BwdXdlops final
     {
         return 0.02f;
     };
-
 private:
     template <typename DataType, typename OutComputeType, typename WeiComputeType>
     bool CheckCKApplicability(const miopen::conv::ProblemDescription&) const;
@@ -5311,7 +5331,7 @@ private:
 };
 
 struct ConvHipImplicitGemmF16F8F16WrwXdlops final
-    : ConvTunableSolver<PerformanceConfigHipImplicitGemmF16F8F16WrwXdlops>
+    : ConvCkXdlopsTunableSolver<PerformanceConfigHipImplicitGemmF16F8F16WrwXdlops>
 {
     const std::string& SolverDbId() const override
     {
@@ -5341,7 +5361,6 @@ struct ConvHipImplicitGemmF16F8F16WrwXdlops final
     {
         return 0.02f;
     };
-
 private:
     template <typename DataType, typename OutComputeType, typename InComputeType>
     bool CheckCKApplicability(const miopen::conv::ProblemDescription&) const;
@@ -0,0 +1,208 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef MIOPEN_GUARD_MLOPEN_THREAD_POOL_HPP
+#define MIOPEN_GUARD_MLOPEN_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace miopen {
+
+/// Pool of hardware_concurrency() - 1 workers shared by the par_for calls of a module, started
+/// on first use. Every worker owns a deque: it pushes and pops its own tasks at the back and,
+/// when it has none, steals from the front of the others. The submitter must not depend on its
+/// tasks being run: par_for does the remaining work itself, so nested loops don't deadlock.
+///
+/// It is header only because the driver and the tests use par_for without the internal
+/// symbols of the library, so each of them has its own pool.
+class thread_pool
+{
+public:
+    using task = std::function<void()>;
+
+    static thread_pool& get()
+    {
+        static thread_pool pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+        return pool;
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ~thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for(auto& t : threads)
+            t.join();
+    }
+
+    std::size_t size() const { return threads.size(); }
+
+    /// Workers push to their own deque, other threads spread the tasks over all of them.
+    void submit(task t)
+    {
+        if(queues.empty())
+        {
+            t();
+            return;
+        }
+
+        const auto index =
+            current_worker() < queues.size() ? current_worker() : next_queue++ % queues.size();
+        {
+            // The task and the counter are published together, so that a pop never sees the
+            // task before its count.
+            std::lock_guard<std::mutex> wake_lock(wake_mutex);
+            std::lock_guard<std::mutex> lock(queues[index]->mutex);
+            queues[index]->tasks.push_back(std::move(t));
+            ++pending;
+        }
+        wake.notify_one();
+    }
+
+    /// Runs one pending task on the calling thread. Returns false if there was none.
+    bool run_pending()
+    {
+        task t;
+        if(!pop(current_worker(), t))
+            return false;
+        t();
+        return true;
+    }
+
+private:
+    struct queue
+    {
+        std::mutex mutex;
+        std::deque<task> tasks;
+    };
+
+    static constexpr std::size_t no_worker = std::numeric_limits<std::size_t>::max();
+
+    explicit thread_pool(std::size_t workers)
+    {
+        for(std::size_t i = 0; i < workers; ++i)
+            queues.emplace_back(std::make_unique<queue>());
+        for(std::size_t i = 0; i < workers; ++i)
+            threads.emplace_back([this, i] { work(i); });
+    }
+
+    static std::size_t& current_worker()
+    {
+        static thread_local std::size_t index = no_worker;
+        return index;
+    }
+
+    bool pop(std::size_t self, task& t)
+    {
+        if(pending.load() == 0)
+            return false;
+
+        if(self < queues.size())
+        {
+            auto& own = *queues[self];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if(!own.tasks.empty())
+            {
+                t = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                take_pending();
+                return true;
+            }
+        }
+
+        const auto start = self < queues.size() ? self + 1 : 0;
+        for(std::size_t k = 0; k < queues.size(); ++k)
+        {
+            auto& victim = *queues[(start + k) % queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if(!victim.tasks.empty())
+            {
+                t = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                take_pending();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void take_pending()
+    {
+        auto count = pending.load();
+        do
+        {
+            if(count == 0)
+                return;
+        } while(!pending.compare_exchange_weak(count, count - 1));
+    }
+
+    void work(std::size_t self)
+    {
+        current_worker() = self;
+        for(;;)
+        {
+            task t;
+            if(pop(self, t))
+            {
+                t();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(wake_mutex);
+            wake.wait(lock, [&] { return stopping || pending.load() != 0; });
+            if(stopping)
+                return;
+        }
+    }
+
+    std::vector<std::unique_ptr<queue>> queues;
+    std::vector<std::thread> threads;
+    std::atomic<std::size_t> next_queue{0};
+    // tasks in the deques, increased under wake_mutex together with the push so that no wake up
+    // is lost, and never decreased below zero
+    std::atomic<std::size_t> pending{0};
+    std::mutex wake_mutex;
+    std::condition_variable wake;
+    bool stopping = false;
+};
+
+} // namespace miopen
+
+#endif
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/config.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <ostream>
+#include <vector>
+
+namespace miopen {
+
+/// Describes how the time of a candidate kernel is measured by Find and auto-tuning.
+///
+/// After the warm-up runs, the candidate is run until the confidence interval of the median
+/// time becomes narrower than confidence_interval (relative to the median), or until max_runs
+/// or time_limit_ms is reached. Samples too far from the median (see outlier_threshold) are
+/// rejected. A candidate is eliminated early once it is clearly slower than the best one, i.e.
+/// the lower bound of its confidence interval exceeds the best time by elimination_margin.
+struct TimingPolicy
+{
+    std::size_t warmup_runs   = 1;
+    std::size_t min_runs      = 3;
+    std::size_t max_runs      = 10;
+    float time_limit_ms       = 5000.0f; // per candidate, warm-up included
+    float confidence_interval = 0.02f;   // relative half-width, 95% confidence
+    float outlier_threshold   = 3.0f;    // in robust standard deviations, 0 keeps all samples
+    float elimination_margin  = 0.05f;   // relative to the best time, negative disables
+
+    friend std::ostream& operator<<(std::ostream& os, const TimingPolicy& policy)
+    {
+        return os << "warm-up " << policy.warmup_runs << ", runs " << policy.min_runs << ".."
+                  << policy.max_runs << ", time limit " << policy.time_limit_ms << " ms, ci "
+                  << policy.confidence_interval << ", outliers " << policy.outlier_threshold
+                  << ", elimination " << policy.elimination_margin;
+    }
+};
+
+/// The outcome of a measurement. The time is the median of the samples left after the outlier
+/// rejection, and the variance is the sample variance of these samples.
+struct TimingResult
+{
+    float time                = std::numeric_limits<float>::max();
+    float variance            = 0.0f;
+    float confidence_interval = 0.0f; // relative half-width
+    std::size_t runs          = 0;    // not counting warm-up
+    std::size_t outliers      = 0;
+    bool eliminated           = false;
+
+    static constexpr const char* statistic = "median";
+};
+
+/// Computes the result over the given samples without any early stopping logic.
+MIOPEN_INTERNALS_EXPORT TimingResult GetTimingResult(std::vector<float> samples,
+                                                     float outlier_threshold);
+
+/// Measures the candidate according to the policy. run shall execute the candidate once and
+/// return the time it took in ms. best_time is the time of the best candidate so far.
+MIOPEN_INTERNALS_EXPORT TimingResult
+MeasureTime(const TimingPolicy& policy,
+            const std::function<float()>& run,
+            float best_time = std::numeric_limits<float>::max());
+
+} // namespace miopen
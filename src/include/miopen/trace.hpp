@@ -0,0 +1,97 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/config.hpp>
+
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace miopen {
+namespace trace {
+
+using Clock = std::chrono::steady_clock;
+
+/// \return true if the spans are recorded, i.e. MIOPEN_TRACE_FILE is set.
+MIOPEN_INTERNALS_EXPORT bool IsEnabled();
+
+/// Records a span which started at start and ends now on the current thread.
+/// The category and the name have to outlive the trace, e.g. be string literals.
+MIOPEN_INTERNALS_EXPORT void Record(std::string_view category,
+                                    std::string_view name,
+                                    Clock::time_point start,
+                                    std::string detail);
+
+/// Writes the spans recorded so far into MIOPEN_TRACE_FILE as Chrome trace events, which can be
+/// opened with Perfetto or chrome://tracing. Called at exit.
+MIOPEN_INTERNALS_EXPORT void Write();
+
+/// Records the time from its construction to its destruction. Costs a function call when
+/// tracing is disabled.
+class Span
+{
+public:
+    Span(std::string_view category_, std::string_view name_)
+        : category(category_), name(name_), active(IsEnabled())
+    {
+        if(active)
+            start = Clock::now();
+    }
+    Span(const Span&)            = delete;
+    Span& operator=(const Span&) = delete;
+
+    ~Span()
+    {
+        if(active)
+            Record(category, name, start, std::move(detail));
+    }
+
+    bool IsActive() const { return active; }
+    /// Shown in the arguments of the span.
+    void SetDetail(std::string detail_) { detail = std::move(detail_); }
+
+private:
+    std::string_view category;
+    std::string_view name;
+    bool active;
+    Clock::time_point start;
+    std::string detail;
+};
+
+} // namespace trace
+} // namespace miopen
+
+#define MIOPEN_TRACE_SCOPE(category, name) \
+    const miopen::trace::Span miopen_trace_span(category, name)
+
+/// The detail expression is only evaluated while tracing.
+#define MIOPEN_TRACE_SCOPE_DETAIL(category, name, ...)     \
+    miopen::trace::Span miopen_trace_span(category, name); \
+    if(miopen_trace_span.IsActive())                       \
+        miopen_trace_span.SetDetail(__VA_ARGS__)
@@ -0,0 +1,196 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace miopen {
+namespace solver {
+
+/// A part of the config space of a tuning job. See ConfigSpace::Shard().
+struct TuningSlice
+{
+    std::size_t index = 0;
+    std::size_t count = 1;
+    /// Identifies the claim of the slice. It changes when the slice is claimed again after
+    /// the lease of the previous worker has expired.
+    std::size_t lease = 0;
+};
+
+/// The best config found within one slice. Negative time means that the slice
+/// has no valid configs or the search within it has failed.
+struct TuningSliceResult
+{
+    std::size_t slice = 0;
+    std::size_t lease = 0;
+    std::string config;
+    float time = -1.0f;
+};
+
+/// Distributes the slices of the config space of tuning jobs between workers, which may
+/// live in different processes or on different machines, and collects the results.
+/// A job is a (solver, problem) pair identified by a string key.
+///
+/// Each worker claims slices until none are left, searches within them and reports the
+/// best config of each slice. Then it waits until all slices of the job are reported and
+/// takes the best config among them, so every worker ends up with the same result, which
+/// is stored to its perf-db as usual.
+///
+/// A claim is a lease which the worker renews while it searches the slice. If the worker
+/// dies, the lease expires and the slice is claimed and searched again by another worker.
+/// Results reported under an expired lease are rejected.
+class MIOPEN_INTERNALS_EXPORT TuningCoordinator
+{
+public:
+    TuningCoordinator(std::size_t slice_count_, std::chrono::milliseconds lease_time_);
+    explicit TuningCoordinator(std::size_t slice_count_);
+    virtual ~TuningCoordinator() = default;
+
+    /// Claims the next unclaimed slice of the job or a slice whose lease has expired before it
+    /// was reported. Returns nullopt when there are none.
+    virtual std::optional<TuningSlice> Acquire(const std::string& job) = 0;
+    /// Extends the lease of the slice. Returns false if the slice has been claimed by another
+    /// worker in the meantime.
+    virtual bool Renew(const std::string& job, const TuningSlice& slice) = 0;
+    /// Returns false if the result is rejected because the lease has been lost.
+    virtual bool Report(const std::string& job, const TuningSliceResult& result) = 0;
+    /// Returns the results reported so far.
+    virtual std::vector<TuningSliceResult> Collect(const std::string& job) = 0;
+
+    std::size_t GetSliceCount() const { return slice_count; }
+    std::chrono::milliseconds GetLeaseTime() const { return lease_time; }
+
+    /// Claims and searches the slices of the job until all of them are reported, renewing the
+    /// lease of each slice while it is searched. When no slices are left to claim, waits up to
+    /// wait_timeout for the ones searched by the other workers, restarting the wait after each
+    /// slice searched meanwhile. Returns the best result, or nullopt if some slices are not
+    /// reported in time.
+    std::optional<TuningSliceResult>
+    Run(const std::string& job,
+        std::chrono::milliseconds wait_timeout,
+        const std::function<TuningSliceResult(const TuningSlice&)>& search);
+
+protected:
+    const std::size_t slice_count;
+    const std::chrono::milliseconds lease_time;
+
+    /// The claims and the results of a job, with the lease expiry times in ms since the epoch
+    /// of the system clock, so that they can be shared between machines.
+    struct Job
+    {
+        struct Claim
+        {
+            std::size_t lease    = 0;
+            std::int64_t expires = 0;
+        };
+
+        std::map<std::size_t, Claim> claims;
+        std::vector<TuningSliceResult> results;
+
+        std::optional<TuningSlice>
+        Acquire(const std::string& job, std::size_t count, std::chrono::milliseconds lease_time);
+        bool Renew(const TuningSlice& slice, std::chrono::milliseconds lease_time);
+        bool Report(const TuningSliceResult& result);
+    };
+
+private:
+    TuningSliceResult Search(const std::string& job,
+                             const TuningSlice& slice,
+                             const std::function<TuningSliceResult(const TuningSlice&)>& search);
+};
+
+/// In-process stand-in for the transport. Allows several handles (e.g. one per GPU)
+/// used from different threads of one process to share a tuning job.
+class MIOPEN_INTERNALS_EXPORT LocalTuningCoordinator : public TuningCoordinator
+{
+public:
+    using TuningCoordinator::TuningCoordinator;
+
+    std::optional<TuningSlice> Acquire(const std::string& job) override;
+    bool Renew(const std::string& job, const TuningSlice& slice) override;
+    bool Report(const std::string& job, const TuningSliceResult& result) override;
+    std::vector<TuningSliceResult> Collect(const std::string& job) override;
+
+private:
+    std::mutex mutex;
+    std::map<std::string, Job> jobs;
+};
+
+/// Keeps the state of the jobs in a directory shared by the workers. Each job is
+/// described by two files named after the hash of the job key: *.claims holds the
+/// number of slices and one line per claimed slice with its lease, *.results holds one
+/// line per reported slice. Accesses are serialized with a lock file in the same directory.
+/// The lease expiry times come from the system clock, so the clocks of the machines
+/// sharing the directory must be in sync to well within the lease time.
+/// The directory keeps the results after the job is finished, so a rerun
+/// of the same job returns them immediately. Clean it up to tune again.
+/// The names also hash the version of the library and of the file format, so the results of
+/// other versions are not reused.
+class MIOPEN_INTERNALS_EXPORT FileTuningCoordinator : public TuningCoordinator
+{
+public:
+    /// Bump when the content of the files changes.
+    static constexpr int file_format_version = 1;
+
+    FileTuningCoordinator(const fs::path& directory_, std::size_t slice_count_);
+    FileTuningCoordinator(const fs::path& directory_,
+                          std::size_t slice_count_,
+                          std::chrono::milliseconds lease_time_);
+
+    std::optional<TuningSlice> Acquire(const std::string& job) override;
+    bool Renew(const std::string& job, const TuningSlice& slice) override;
+    bool Report(const std::string& job, const TuningSliceResult& result) override;
+    std::vector<TuningSliceResult> Collect(const std::string& job) override;
+
+private:
+    fs::path directory;
+
+    fs::path JobPath(const std::string& job, const std::string& ext) const;
+    Job Load(const std::string& job) const;
+    void Store(const std::string& job, const Job& state) const;
+};
+
+/// Returns the coordinator to be used by GenericSearch or nullptr if tuning is not distributed.
+/// The coordinator set by SetTuningCoordinator() takes priority. Otherwise a FileTuningCoordinator
+/// is used if MIOPEN_TUNING_COORDINATOR_DIR is set.
+MIOPEN_INTERNALS_EXPORT std::shared_ptr<TuningCoordinator> GetTuningCoordinator();
+MIOPEN_INTERNALS_EXPORT void SetTuningCoordinator(std::shared_ptr<TuningCoordinator> coordinator);
+
+} // namespace solver
+} // namespace miopen
@@ -0,0 +1,112 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+namespace miopen {
+namespace solver {
+
+/// Expected cost of tuning one solver for one problem, see EstimateTuningCost().
+struct TuningCostEstimate
+{
+    std::string solver;
+    std::size_t primary_configs  = 0;    // valid configs in the primary set
+    std::size_t spare_configs    = 0;    // valid configs in the spare set
+    std::size_t searched_configs = 0;    // configs the search would measure
+    std::size_t unique_kernels   = 0;    // kernels to compile for the searched configs
+    std::size_t unknown_kernels  = 0;    // kernels without historical compile times
+    float compile_time_ms        = 0.0f; // total for all the unique kernels, single thread
+    float measure_time_ms        = 0.0f;
+    float wall_time_ms           = 0.0f; // parallel compilation overlaps measurement
+    bool estimated               = true; // false for solvers not searching with GenericSearch
+};
+
+MIOPEN_INTERNALS_EXPORT std::ostream& operator<<(std::ostream& os,
+                                                 const TuningCostEstimate& estimate);
+
+/// Historical compile and measure times used to estimate the cost of tuning. The times are
+/// kept in a small text file shared by all the processes. Each line of the file is
+/// "<kind> <key> <count> <total ms>", where the key is a kernel file for compile times
+/// and a solver id for measure times (of a single config).
+class MIOPEN_INTERNALS_EXPORT TuningStats
+{
+public:
+    /// Empty path keeps the stats in memory only.
+    explicit TuningStats(const fs::path& path_);
+
+    void AddCompileTime(const std::string& kernel_file, float ms);
+    void AddMeasureTime(const std::string& solver_id, float ms);
+
+    /// Mean time for the key. Unknown keys get the mean over all the known ones, or
+    /// a conservative default if there is no history at all; known is set to false then.
+    float GetCompileTime(const std::string& kernel_file, bool& known) const;
+    float GetMeasureTime(const std::string& solver_id, bool& known) const;
+
+    /// Merges the times added since the last call into the file.
+    void Save();
+
+private:
+    struct Entry
+    {
+        std::size_t count = 0;
+        double total_ms   = 0.0;
+    };
+    using Entries = std::map<std::string, Entry>;
+
+    void Add(const std::string& key, float ms);
+    float Get(const std::string& kind, const std::string& key, float fallback, bool& known) const;
+    Entries Load() const;
+
+    fs::path path;
+    mutable std::mutex mutex;
+    Entries entries;
+    Entries unsaved;
+};
+
+/// Set by MIOPEN_TUNING_STATS_PATH, defaults to tuning_stats.txt in the User PerfDb directory.
+MIOPEN_INTERNALS_EXPORT TuningStats& GetTuningStats();
+
+/// MIOPEN_TUNING_DRY_RUN makes the searches only estimate their cost and report it to the log.
+MIOPEN_INTERNALS_EXPORT bool IsTuningDryRunEnabled();
+
+/// Logs the estimate and skips the search by throwing miopenStatusGpuOperationsSkipped.
+[[noreturn]] MIOPEN_INTERNALS_EXPORT void ReportTuningCost(const TuningCostEstimate& estimate);
+
+/// Called first by the Search() of the solvers that do not use GenericSearch(), whose cost can't
+/// be estimated. In a dry run, reports the solver as not estimated and skips the search.
+MIOPEN_INTERNALS_EXPORT void SkipSearchInDryRun(const std::string& solver_id);
+
+} // namespace solver
+} // namespace miopen
@@ -0,0 +1,101 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/config.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace miopen {
+namespace solver {
+
+/// Max number of configs taken from perf-db records of similar problems to seed the search.
+/// 0 disables the warm start.
+MIOPEN_INTERNALS_EXPORT std::size_t GetTuningWarmStartSeedsMax();
+/// Number of configs following each seed (in the SetNextValue order) which are measured
+/// right after the seeds, before the rest of the config space is sampled.
+MIOPEN_INTERNALS_EXPORT std::size_t GetTuningWarmStartRadius();
+
+/// Returns the problems which differ from the given one only in the batch size, nearest first.
+MIOPEN_INTERNALS_EXPORT std::vector<miopen::conv::ProblemDescription>
+GetNeighborProblems(const miopen::conv::ProblemDescription& problem);
+
+/// There are no known neighbors for other kinds of problems.
+template <class Problem>
+std::vector<Problem> GetNeighborProblems(const Problem&)
+{
+    return {};
+}
+
+/// Which config has won the warm-started search.
+enum class WarmStartOutcome
+{
+    Seed,
+    SeedNeighbor,
+    Sampled,
+};
+
+/// Accumulates the outcomes of warm-started searches and logs how often the seeds win.
+MIOPEN_INTERNALS_EXPORT void ReportWarmStartOutcome(const std::string& solver_id,
+                                                    WarmStartOutcome outcome);
+
+/// Collects the serialized configs of the nearest problems that have perf-db records
+/// for the solver and are valid for the given problem.
+template <class Solver, class Context, class Problem, class Db>
+std::vector<std::string>
+GetTuningSeeds(const Solver& s, const Context& context, const Problem& problem, Db&& db)
+{
+    std::vector<std::string> seeds;
+    const auto seeds_max = GetTuningWarmStartSeedsMax();
+    if(seeds_max == 0)
+        return seeds;
+
+    using PerformanceConfig = decltype(s.GetDefaultPerformanceConfig(context, problem));
+    for(const auto& neighbor : GetNeighborProblems(problem))
+    {
+        PerformanceConfig config{};
+        if(!db().Load(neighbor, s.SolverDbId(), config) ||
+           !s.IsValidPerformanceConfig(context, problem, config))
+            continue;
+        auto seed = config.ToString();
+        if(std::find(seeds.begin(), seeds.end(), seed) != seeds.end())
+            continue;
+        MIOPEN_LOG_I2(s.SolverDbId() << ": warm start seed " << seed);
+        seeds.emplace_back(std::move(seed));
+        if(seeds.size() >= seeds_max)
+            break;
+    }
+    return seeds;
+}
+
+} // namespace solver
+} // namespace miopen
@@ -27,90 +27,315 @@
 #include <miopen/invoker_cache.hpp>
 #include <miopen/logger.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace miopen {
 
-std::optional<Invoker> InvokerCache::operator[](const Key& key) const
+namespace {
+
+std::size_t HashKey(std::string_view first, std::string_view second)
 {
-    const auto item = invokers.find(key.first);
-    if(item == invokers.end())
-        return std::nullopt;
-    const auto& item_invokers = item->second.invokers;
-    const auto invoker        = item_invokers.find(key.second);
-    if(invoker == item_invokers.end())
-        return std::nullopt;
-    return invoker->second;
+    const auto h1 = std::hash<std::string_view>{}(first);
+    const auto h2 = std::hash<std::string_view>{}(second);
+    return h1 ^ (h2 + 0x9e3779b97f4a7c15 + (h1 << 6) + (h1 >> 2));
 }
 
-std::optional<Invoker> InvokerCache::GetFound1_0(const std::string& network_config,
-                                                 const std::string& algorithm) const
+/// Hazard pointer of a thread: the value it is reading, which must not be deleted meanwhile.
+/// The records are shared by all the tables and are never freed. A thread takes one on its
+/// first lookup and gives it back on exit, to be reused by another thread.
+struct HazardRecord
 {
-    const auto item = invokers.find(network_config);
-    if(item == invokers.end())
+    std::atomic<const void*> pointer{nullptr};
+    std::atomic<bool> used{false};
+    HazardRecord* next = nullptr;
+};
+
+std::atomic<HazardRecord*>& GetHazardRecords()
+{
+    static std::atomic<HazardRecord*> head{nullptr};
+    return head;
+}
+
+HazardRecord& AcquireHazardRecord()
+{
+    auto& head = GetHazardRecords();
+    for(auto record = head.load(std::memory_order_acquire); record != nullptr;
+        record      = record->next)
     {
-        MIOPEN_LOG_I2("No invokers found for " << network_config);
-        return std::nullopt;
+        auto expected = false;
+        if(!record->used.load(std::memory_order_relaxed) &&
+           record->used.compare_exchange_strong(expected, true, std::memory_order_acquire))
+            return *record;
     }
-    if(item->second.found_1_0.empty())
+
+    auto* const record = new HazardRecord{};
+    record->used.store(true, std::memory_order_relaxed);
+    record->next = head.load(std::memory_order_relaxed);
+    while(!head.compare_exchange_weak(
+        record->next, record, std::memory_order_release, std::memory_order_relaxed))
     {
-        MIOPEN_LOG_I2("Invokers found for " << network_config
-                                            << " but there is no find 1.0 result.");
-        return std::nullopt;
     }
-    const auto& item_invokers = item->second.invokers;
-    const auto& found_1_0_ids = item->second.found_1_0;
-    const auto found_1_0_id   = found_1_0_ids.find(algorithm);
-    if(found_1_0_id == found_1_0_ids.end())
+    return *record;
+}
+
+HazardRecord& GetThreadHazardRecord()
+{
+    struct Owner
     {
-        MIOPEN_LOG_I2("Invokers found for "
-                      << network_config << " but there is no one with an algorithm " << algorithm);
-        return std::nullopt;
-    }
-    const auto invoker = item_invokers.find(found_1_0_id->second);
-    if(invoker == item_invokers.end())
+        HazardRecord& record = AcquireHazardRecord();
+        ~Owner() { record.used.store(false, std::memory_order_release); }
+    };
+    thread_local Owner owner;
+    return owner.record;
+}
+
+bool IsHazard(const void* pointer)
+{
+    for(auto record = GetHazardRecords().load(std::memory_order_acquire); record != nullptr;
+        record      = record->next)
     {
-        MIOPEN_THROW("No invoker with solver_id of " + found_1_0_id->second +
-                     " was registered for " + network_config);
+        if(record->pointer.load() == pointer)
+            return true;
     }
-    return invoker->second;
+    return false;
 }
 
-std::optional<std::string> InvokerCache::GetFound1_0SolverId(const std::string& network_config,
-                                                             const std::string& algorithm) const
+} // namespace
+
+/// Hash table with lock-free lookups. Each key has one value slot, an atomic pointer to an
+/// immutable value. Registering a key again publishes a new value and retires the old one, which
+/// is deleted once no lookup reads it. Lookups announce the value they read with a hazard pointer
+/// and copy it, so they take no locks and touch no shared reference counts. Retired values are
+/// reclaimed by the next registrations. The chain nodes are immutable once published. Replaced
+/// bucket arrays and their nodes may still be traversed by the readers, so they live as long as
+/// the table. The buckets grow geometrically, which keeps that overhead proportional to the
+/// number of keys.
+template <class Value>
+class InvokerCache::Table
 {
-    const auto item = invokers.find(network_config);
-    if(item == invokers.end())
+public:
+    Table() { buckets = Grow(); }
+    Table(const Table&)            = delete;
+    Table& operator=(const Table&) = delete;
+
+    /// No lookups may be running.
+    ~Table()
     {
-        MIOPEN_LOG_I2("No invokers found for " << network_config);
-        return std::nullopt;
+        for(auto& slot : slots)
+            delete slot.value.load(std::memory_order_relaxed);
+        for(const auto* value : retired)
+            delete value;
     }
-    if(item->second.found_1_0.empty())
+
+    std::optional<Value>
+    Find(std::string_view first, std::string_view second, std::size_t hash) const
     {
-        MIOPEN_LOG_I2("Invokers found for " << network_config
-                                            << " but there is no find 1.0 result.");
-        return std::nullopt;
+        const auto* const slot = FindSlot(first, second, hash);
+        if(slot == nullptr)
+            return std::nullopt;
+
+        // The value is safe to read once it is still in the slot after the hazard is announced.
+        auto& hazard = GetThreadHazardRecord().pointer;
+        auto* value  = slot->value.load(std::memory_order_acquire);
+        for(;;)
+        {
+            hazard.store(value);
+            const auto* const current = slot->value.load();
+            if(current == value)
+                break;
+            value = current;
+        }
+
+        struct Release
+        {
+            std::atomic<const void*>& hazard;
+            ~Release() { hazard.store(nullptr, std::memory_order_release); }
+        } release{hazard};
+        return *value;
+    }
+
+    /// Must be serialized by the caller.
+    void Insert(const std::string& first, const std::string& second, const Value& value)
+    {
+        // Also the values still read by the lookups when they were replaced.
+        Reclaim();
+
+        auto fresh      = std::make_unique<const Value>(value);
+        const auto hash = HashKey(first, second);
+        if(auto* const slot = FindSlot(first, second, hash))
+        {
+            retired.reserve(retired.size() + 1);
+            retired.push_back(slot->value.exchange(fresh.release()));
+            Reclaim();
+            return;
+        }
+
+        if(++size > buckets.load(std::memory_order_relaxed)->heads.size())
+            buckets.store(Grow(), std::memory_order_release);
+        slots.emplace_back(fresh.release());
+        Link(*buckets.load(std::memory_order_relaxed), hash, first, second, &slots.back());
+    }
+
+private:
+    struct Slot
+    {
+        explicit Slot(const Value* value_) : value(value_) {}
+
+        std::atomic<const Value*> value;
+    };
+
+    struct Node
+    {
+        std::size_t hash;
+        std::string first;
+        std::string second;
+        Slot* slot;
+        const Node* next;
+    };
+
+    struct Buckets
+    {
+        explicit Buckets(std::size_t n) : heads(n)
+        {
+            for(auto& head : heads)
+                head.store(nullptr, std::memory_order_relaxed);
+        }
+
+        std::vector<std::atomic<const Node*>> heads;
+    };
+
+    static constexpr std::size_t initial_buckets = 64;
+
+    Slot* FindSlot(std::string_view first, std::string_view second, std::size_t hash) const
+    {
+        const auto* const current = buckets.load(std::memory_order_acquire);
+        const auto& head          = current->heads[hash & (current->heads.size() - 1)];
+        for(auto node = head.load(std::memory_order_acquire); node != nullptr; node = node->next)
+        {
+            if(node->hash == hash && node->first == first && node->second == second)
+                return node->slot;
+        }
+        return nullptr;
+    }
+
+    void Link(Buckets& to,
+              std::size_t hash,
+              const std::string& first,
+              const std::string& second,
+              Slot* slot)
+    {
+        auto& head = to.heads[hash & (to.heads.size() - 1)];
+        nodes.push_back(Node{hash, first, second, slot, head.load(std::memory_order_relaxed)});
+        head.store(&nodes.back(), std::memory_order_release);
     }
-    const auto& found_1_0_ids = item->second.found_1_0;
-    const auto found_1_0_id   = found_1_0_ids.find(algorithm);
-    if(found_1_0_id == found_1_0_ids.end())
+
+    Buckets* Grow()
     {
-        MIOPEN_LOG_I2("Invokers found for "
-                      << network_config << " but there is no one with an algorithm " << algorithm);
+        auto* const old = all_buckets.empty() ? nullptr : all_buckets.back().get();
+        all_buckets.push_back(
+            std::make_unique<Buckets>(old == nullptr ? initial_buckets : old->heads.size() * 2));
+        auto& grown = *all_buckets.back();
+        if(old == nullptr)
+            return &grown;
+
+        // Every key has one node per bucket array, which shares the slot of the key.
+        for(const auto& head : old->heads)
+        {
+            for(auto node = head.load(std::memory_order_relaxed); node != nullptr;
+                node      = node->next)
+            {
+                Link(grown, node->hash, node->first, node->second, node->slot);
+            }
+        }
+        return &grown;
+    }
+
+    /// Deletes the retired values no lookup is reading. Must be serialized by the caller.
+    void Reclaim()
+    {
+        const auto reclaimed = std::remove_if(retired.begin(), retired.end(), [](auto value) {
+            if(IsHazard(value))
+                return false;
+            delete value;
+            return true;
+        });
+        retired.erase(reclaimed, retired.end());
+    }
+
+    std::atomic<Buckets*> buckets;
+    std::vector<std::unique_ptr<Buckets>> all_buckets;
+    std::deque<Node> nodes; // stable addresses
+    std::deque<Slot> slots; // stable addresses
+    std::vector<const Value*> retired;
+    std::size_t size = 0;
+};
+
+struct InvokerCache::Tables
+{
+    // network_config, solver_id -> invoker
+    Table<Invoker> invokers;
+    // network_config, algorithm -> solver_id
+    // for find 1.0
+    Table<std::string> found_1_0;
+    std::mutex write_mutex;
+};
+
+InvokerCache::InvokerCache() : tables(std::make_unique<Tables>()) {}
+InvokerCache::InvokerCache(InvokerCache&&) noexcept = default;
+InvokerCache& InvokerCache::operator=(InvokerCache&&) noexcept = default;
+InvokerCache::~InvokerCache()                                  = default;
+
+std::optional<Invoker> InvokerCache::operator[](const Key& key) const
+{
+    return Get(key.first, key.second);
+}
+
+std::optional<Invoker> InvokerCache::Get(std::string_view network_config,
+                                         std::string_view solver_id) const
+{
+    return tables->invokers.Find(network_config, solver_id, HashKey(network_config, solver_id));
+}
+
+std::optional<Invoker> InvokerCache::GetFound1_0(const std::string& network_config,
+                                                 const std::string& algorithm) const
+{
+    const auto found_1_0_id = GetFound1_0SolverId(network_config, algorithm);
+    if(!found_1_0_id)
         return std::nullopt;
+    const auto invoker = Get(network_config, *found_1_0_id);
+    if(!invoker)
+    {
+        MIOPEN_THROW("No invoker with solver_id of " + *found_1_0_id + " was registered for " +
+                     network_config);
     }
-    return found_1_0_id->second;
+    return invoker;
 }
 
-void InvokerCache::Register(const Key& key, const Invoker& invoker)
+std::optional<std::string> InvokerCache::GetFound1_0SolverId(const std::string& network_config,
+                                                             const std::string& algorithm) const
 {
-    auto it = invokers.find(key.first);
-    if(it != invokers.end())
+    const auto found_1_0_id =
+        tables->found_1_0.Find(network_config, algorithm, HashKey(network_config, algorithm));
+    if(!found_1_0_id)
     {
-        it->second.invokers.insert({key.second, invoker});
+        MIOPEN_LOG_I2("There is no find 1.0 result for " << network_config
+                                                         << " with an algorithm " << algorithm);
+        return std::nullopt;
     }
-    else
+    return found_1_0_id;
+}
+
+void InvokerCache::Register(const Key& key, const Invoker& invoker)
+{
     {
-        auto& item = invokers.insert({key.first, Item{}}).first->second;
-        item.invokers.insert({key.second, invoker});
+        std::lock_guard<std::mutex> lock(tables->write_mutex);
+        tables->invokers.Insert(key.first, key.second, invoker);
     }
     MIOPEN_LOG_I2("Invoker registered for algorithm " << key.first << " and solver " << key.second);
 }
@@ -119,22 +344,17 @@ void InvokerCache::SetAsFound1_0(const std::string& network_config,
                                  const std::string& algorithm,
                                  const std::string& solver_id)
 {
-    const auto item = invokers.find(network_config);
-    if(item == invokers.end())
-        MIOPEN_THROW("No invoker was registered for " + network_config);
-
+    // Validating at find time
+    if(!Get(network_config, solver_id))
     {
-        // Validating at find time
-        const auto& item_invokers = item->second.invokers;
-        const auto invoker        = item_invokers.find(solver_id);
-        if(invoker == item_invokers.end())
-        {
-            MIOPEN_THROW("No invoker with solver_id of " + solver_id + " was registered for " +
-                         network_config);
-        }
+        MIOPEN_THROW("No invoker with solver_id of " + solver_id + " was registered for " +
+                     network_config);
     }
 
-    item->second.found_1_0[algorithm] = solver_id;
+    {
+        std::lock_guard<std::mutex> lock(tables->write_mutex);
+        tables->found_1_0.Insert(network_config, algorithm, solver_id);
+    }
     MIOPEN_LOG_I2("Solver " << solver_id << " registered as find 1.0 best for " << algorithm
                             << " in " << network_config);
 }
@@ -44,51 +44,63 @@
 #include <miopen/kernel_cache.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/stringutils.hpp>
+#include <miopen/trace.hpp>
 
 #include <iostream>
 #include <iterator>
+#include <mutex>
+#include <optional>
 
 MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_DEVICE_ARCH)
 
 namespace miopen {
 
-const std::vector<Kernel>& KernelCache::GetKernels(const std::string& algorithm,
-                                                   const std::string& network_config)
+KernelCache::Kernels KernelCache::GetKernels(const std::string& algorithm,
+                                             const std::string& network_config) const
 {
 
-    std::pair<std::string, std::string> key = std::make_pair(algorithm, network_config);
+    const auto key    = Key{algorithm, network_config};
+    const auto& shard = GetShard(kernel_shards, key);
+    auto kernels      = [&]() -> Kernels {
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        const auto it = shard.map.find(key);
+        return it != shard.map.end() ? it->second : nullptr;
+    }();
 
-    const auto it = kernel_map.find(key);
-    if(it != kernel_map.end())
+    if(kernels != nullptr)
     {
-        MIOPEN_LOG_I2(it->second.size()
+        MIOPEN_LOG_I2(kernels->size()
                       << " kernels for key: " << key.first << " \"" << key.second << '\"');
-        return it->second;
+        return kernels;
     }
 
-    static const std::vector<Kernel> empty{};
+    static const auto empty = std::make_shared<const std::vector<Kernel>>();
     MIOPEN_LOG_I2("0 kernels for key: " << key.first << " \"" << key.second << '\"');
     return empty;
 }
 
 bool KernelCache::HasProgram(const fs::path& name, const std::string& params) const
 {
-    const auto key = std::make_pair(name, params);
-    return program_map.count(key) > 0;
+    const auto key    = Key{name, params};
+    const auto& shard = GetShard(program_shards, key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.count(key) > 0;
 }
 
 void KernelCache::ClearProgram(const fs::path& name, const std::string& params)
 {
-    if(HasProgram(name, params))
-    {
-        const auto key = std::make_pair(name, params);
-        program_map.erase(key);
-    }
+    const auto key = Key{name, params};
+    auto& shard    = GetShard(program_shards, key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    shard.map.erase(key);
 }
 
 void KernelCache::AddProgram(Program prog, const fs::path& program_name, std::string params)
 {
-    program_map[std::make_pair(program_name, params)] = prog;
+    const auto key = Key{program_name, std::move(params)};
+    auto& shard    = GetShard(program_shards, key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    shard.map[key] = std::move(prog);
 }
 
 Kernel KernelCache::AddKernel(const Handle& h,
@@ -108,29 +120,34 @@ Kernel KernelCache::AddKernel(const Handle& h,
         MIOPEN_LOG_I2("Key: " << key.first << " \"" << key.second << '\"');
 
     const auto program = [&] {
-        auto program_it = program_map.find(std::make_pair(program_name, params));
-        if(program_it != program_map.end())
-        {
-            auto& program = program_it->second;
-
-            if(program_out != nullptr && !program.IsCodeObjectInMemory() &&
-               !program.IsCodeObjectInFile())
-            {
-                // We need the binaries attached to the program.
-                // This may happen if someone calls immediate mode and then find 2.0 with request
-                // for binaries.
-                program = h.LoadProgram(program_name, params, kernel_src, true);
-            }
-
-            return program;
-        }
-        else
-        {
-            auto program = h.LoadProgram(program_name, params, kernel_src, program_out != nullptr);
-
-            program_map[std::make_pair(program_name, params)] = program;
-            return program;
-        }
+        const auto program_key = Key{program_name, params};
+        auto& shard            = GetShard(program_shards, program_key);
+
+        auto cached = [&]() -> std::optional<Program> {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            const auto program_it = shard.map.find(program_key);
+            if(program_it == shard.map.end())
+                return std::nullopt;
+            return program_it->second;
+        }();
+
+        if(cached && (program_out == nullptr || cached->IsCodeObjectInMemory() ||
+                      cached->IsCodeObjectInFile()))
+            return *cached;
+
+        // Loading may build the program, so it is done without holding the lock. When several
+        // threads miss the same program at once, all of them build it and the first one to
+        // finish publishes its result.
+        // A cached program is reloaded if we need the binaries attached to it. This may happen
+        // if someone calls immediate mode and then find 2.0 with request for binaries.
+        auto program = h.LoadProgram(program_name, params, kernel_src, program_out != nullptr);
+
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        const auto [program_it, inserted] = shard.map.try_emplace(program_key, program);
+        if(!inserted && program_out == nullptr)
+            return program_it->second;
+        program_it->second = program;
+        return program;
     }();
 
     if(program_out != nullptr)
@@ -156,12 +173,18 @@ Kernel KernelCache::AddKernel(const Handle& h,
 
 void KernelCache::AddKernel(Key key, Kernel k, std::size_t cache_index)
 {
-    auto&& v = kernel_map[key];
+    MIOPEN_TRACE_SCOPE_DETAIL("kernel cache", "AddKernel", key.first.string() + " " + key.second);
+    auto& shard = GetShard(kernel_shards, key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto& kernels = shard.map[key];
+    // Readers may still hold the old list, so it is copied instead of modified.
+    auto v = kernels != nullptr ? std::vector<Kernel>(*kernels) : std::vector<Kernel>{};
     if(cache_index >= v.size())
     {
         v.resize(cache_index + 1);
     }
-    v[cache_index] = k;
+    v[cache_index] = std::move(k);
+    kernels        = std::make_shared<const std::vector<Kernel>>(std::move(v));
 }
 
 void KernelCache::ClearKernels(const std::string& algorithm, const std::string& network_config)
@@ -170,13 +193,17 @@ void KernelCache::ClearKernels(const std::string& algorithm, const std::string&
     {
         MIOPEN_THROW("Network config or algorithm empty.");
     }
-    const std::pair<std::string, std::string> key = std::make_pair(algorithm, network_config);
-    auto&& v                                      = this->kernel_map[key];
-    if(!v.empty())
+    const auto key = Key{algorithm, network_config};
+    auto& shard    = GetShard(kernel_shards, key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    const auto it = shard.map.find(key);
+    if(it != shard.map.end() && !it->second->empty())
     {
-        MIOPEN_LOG_I2(v.size() << " kernels for key: " << key.first << " \"" << key.second << '\"');
+        MIOPEN_LOG_I2(it->second->size()
+                      << " kernels for key: " << key.first << " \"" << key.second << '\"');
     }
-    v.clear();
+    if(it != shard.map.end())
+        shard.map.erase(it);
 }
 
 KernelCache::KernelCache() {}
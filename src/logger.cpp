@@ -23,10 +23,12 @@
  * SOFTWARE.
  *
  *******************************************************************************/
+#include <miopen/async_log_writer.hpp>
 #include <miopen/env.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/config.h>
 
+#include <array>
 #include <cstdlib>
 #include <chrono>
 #include <ios>
@@ -34,6 +36,7 @@
 #include <sstream>
 
 #ifdef __linux__
+#include <csignal>
 #include <unistd.h>
 #include <sys/syscall.h> /* For SYS_xxx definitions */
 #endif
@@ -65,6 +68,18 @@ MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_ENABLE_LOGGING_ROCTX)
 /// Disable logging quieting.
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_LOGGING_QUIETING_DISABLE)
 
+/// Write the log messages to stderr on a background thread instead of the logging one.
+/// The queued messages are written on exit.
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_LOG_ASYNC)
+
+/// In the asynchronous mode, also write the queued messages on a crash (Linux only). This installs
+/// process-wide handlers of the crash signals, which pass the signals on to the previous ones.
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_LOG_ASYNC_CRASH_HANDLER)
+
+/// Max number of log messages waiting to be written in the asynchronous mode.
+/// Newer messages are dropped when it is exceeded, and the number of dropped ones is logged.
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_LOG_ASYNC_CAPACITY, 4096)
+
 namespace miopen {
 
 namespace debug {
@@ -116,6 +131,78 @@ inline float GetTimeDiff()
     return rv;
 }
 
+AsyncLogWriter* GetAsyncLogWriter();
+
+#ifdef __linux__
+constexpr std::array<int, 5> crash_signals = {SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGABRT};
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+std::array<struct sigaction, crash_signals.size()> prev_crash_actions;
+
+/// Writes the queued log messages, then restores the previous handler and passes the signal
+/// on to it with its info and context, or re-raises it for the default action.
+/// This is the best effort, the writing is not async-signal-safe.
+void OnCrash(int sig, siginfo_t* info, void* context)
+{
+    while(auto message = GetAsyncLogWriter()->TakeQueued())
+    {
+        if(write(STDERR_FILENO, message->data(), message->size()) < 0)
+            break;
+    }
+
+    for(std::size_t i = 0; i < crash_signals.size(); ++i)
+    {
+        if(crash_signals[i] != sig)
+            continue;
+        const auto& prev = prev_crash_actions[i];
+        sigaction(sig, &prev, nullptr);
+        if((prev.sa_flags & SA_SIGINFO) != 0)
+        {
+            prev.sa_sigaction(sig, info, context);
+            return;
+        }
+        if(prev.sa_handler != SIG_DFL && prev.sa_handler != SIG_IGN)
+        {
+            prev.sa_handler(sig);
+            return;
+        }
+    }
+    raise(sig);
+}
+
+void SetCrashHandlers()
+{
+    struct sigaction action = {};
+    action.sa_sigaction     = OnCrash;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_SIGINFO | SA_RESETHAND;
+
+    for(std::size_t i = 0; i < crash_signals.size(); ++i)
+        sigaction(crash_signals[i], &action, &prev_crash_actions[i]);
+}
+#endif
+
+AsyncLogWriter* CreateAsyncLogWriter()
+{
+    if(!env::enabled(MIOPEN_LOG_ASYNC))
+        return nullptr;
+
+    // Never destroyed, messages may be logged from static destructors. These are written
+    // directly once the writer is stopped at exit.
+    auto* const writer = new AsyncLogWriter{std::cerr, env::value(MIOPEN_LOG_ASYNC_CAPACITY)};
+    std::atexit([]() { GetAsyncLogWriter()->Stop(); });
+#ifdef __linux__
+    if(env::enabled(MIOPEN_LOG_ASYNC_CRASH_HANDLER))
+        SetCrashHandlers();
+#endif
+    return writer;
+}
+
+AsyncLogWriter* GetAsyncLogWriter()
+{
+    static auto* const writer = CreateAsyncLogWriter();
+    return writer;
+}
+
 } // namespace
 
 bool IsLoggingDebugQuiet()
@@ -174,6 +261,22 @@ const char* LoggingLevelToCString(const LoggingLevel level)
     }
 }
 
+void LogWrite(std::string message)
+{
+    auto* const writer = GetAsyncLogWriter();
+    if(writer == nullptr || !writer->Write(message))
+        std::cerr << message;
+}
+
+void LogFlush()
+{
+    auto* const writer = GetAsyncLogWriter();
+    if(writer != nullptr)
+        writer->Flush();
+    else
+        std::cerr.flush();
+}
+
 bool IsLoggingCmd() { return env::enabled(MIOPEN_ENABLE_LOGGING_CMD) && !IsLoggingDebugQuiet(); }
 
 std::string LoggingPrefix()
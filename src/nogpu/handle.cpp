@@ -35,6 +35,7 @@
 #include <miopen/kernel_cache.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/timer.hpp>
+#include <miopen/trace.hpp>
 #include <miopen/hipoc_program.hpp>
 
 #if !MIOPEN_ENABLE_SQLITE_KERN_CACHE
@@ -66,9 +67,24 @@ Handle::Handle(miopenAcceleratorQueue_t /* stream */) : Handle::Handle() {}
 Handle::Handle() : impl(new HandleImpl())
 {
     this->impl->target_properties.Init(this);
+    this->decision_tables = std::make_shared<conv::DecisionTableCache>(*this);
     MIOPEN_LOG_NQI(*this);
 }
 
+Handle::Handle(const Handle& parent, miopenAcceleratorQueue_t /* stream */) : Handle::Handle()
+{
+    this->impl->cache     = parent.impl->cache;
+    this->invokers        = parent.invokers;
+    this->applicability   = parent.applicability;
+    this->decision_tables = parent.decision_tables;
+    this->execution_plans = parent.execution_plans;
+}
+
+std::unique_ptr<Handle> Handle::CreateChild(const Handle& parent)
+{
+    return std::make_unique<Handle>(parent, nullptr);
+}
+
 Handle::~Handle() {}
 
 void Handle::SetStream(miopenAcceleratorQueue_t /* streamID */) const {}
@@ -116,7 +132,7 @@ KernelInvoke Handle::AddKernel(const std::string& algorithm,
                                std::size_t cache_index,
                                const std::string& kernel_src) const
 {
-    auto obj = this->impl->cache.AddKernel(*this,
+    auto obj = this->impl->cache->AddKernel(*this,
                                            algorithm,
                                            network_config,
                                            program_name,
@@ -145,7 +161,7 @@ Invoker Handle::PrepareInvoker(const InvokerFactory& factory,
 
         MIOPEN_LOG_I2("Preparing kernel: " << k.kernel_name);
 
-        const auto kernel = this->impl->cache.AddKernel(*this,
+        const auto kernel = this->impl->cache->AddKernel(*this,
                                                         "",
                                                         "",
                                                         k.kernel_file,
@@ -163,17 +179,17 @@ Invoker Handle::PrepareInvoker(const InvokerFactory& factory,
 
 void Handle::ClearKernels(const std::string& algorithm, const std::string& network_config) const
 {
-    this->impl->cache.ClearKernels(algorithm, network_config);
+    this->impl->cache->ClearKernels(algorithm, network_config);
 }
 void Handle::ClearProgram(const fs::path& program_name, const std::string& params) const
 {
-    this->impl->cache.ClearProgram(program_name, params);
+    this->impl->cache->ClearProgram(program_name, params);
 }
 
-const std::vector<Kernel>& Handle::GetKernelsImpl(const std::string& algorithm,
-                                                  const std::string& network_config) const
+std::shared_ptr<const std::vector<Kernel>>
+Handle::GetKernelsImpl(const std::string& algorithm, const std::string& network_config) const
 {
-    return this->impl->cache.GetKernels(algorithm, network_config);
+    return this->impl->cache->GetKernels(algorithm, network_config);
 }
 
 KernelInvoke Handle::Run(Kernel /*k*/, bool /*coop_launch*/) const { return {}; }
@@ -183,6 +199,7 @@ Program Handle::LoadProgram(const fs::path& program_name,
                             const std::string& kernel_src,
                             bool force_attach_binary) const
 {
+    MIOPEN_TRACE_SCOPE_DETAIL("compile", "LoadProgram", program_name.string());
     std::ignore = force_attach_binary;
 
     if(program_name.extension() == ".mlir")
@@ -230,12 +247,12 @@ Program Handle::LoadProgram(const fs::path& program_name,
 
 bool Handle::HasProgram(const fs::path& program_name, const std::string& params) const
 {
-    return this->impl->cache.HasProgram(program_name, params);
+    return this->impl->cache->HasProgram(program_name, params);
 }
 
 void Handle::AddProgram(Program prog, const fs::path& program_name, const std::string& params) const
 {
-    this->impl->cache.AddProgram(prog, program_name, params);
+    this->impl->cache->AddProgram(prog, program_name, params);
 }
 
 void Handle::Finish() const {}
@@ -27,7 +27,10 @@
 #include <miopen/convolution.hpp>
 
 #include <miopen/algorithm.hpp>
+#include <miopen/applicability_cache.hpp>
 #include <miopen/conv_algo_name.hpp>
+#include <miopen/conv/heuristics/decision_table.hpp>
+#include <miopen/conv/heuristics/roofline.hpp>
 #include <miopen/conv/solver_finders.hpp>
 #include <miopen/check_numerics.hpp>
 #include <miopen/config.h>
@@ -65,6 +68,7 @@ MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_CONV_IMMED_FALLBACK)
 MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_DUMP_TENSOR_PATH)
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_ENABLE_AI_IMMED_MODE_FALLBACK)
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_FORCE_IMMED_MODE_FALLBACK)
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_DISABLE_CONV_ROOFLINE_FALLBACK)
 
 namespace miopen {
 
@@ -598,13 +602,44 @@ ConvolutionDescriptor::GetSolutionsFallback(const ExecutionContext& ctx,
 
     auto interim = std::vector<miopenConvSolution_t>{};
     interim.reserve(maxSolutionCount); // For speed. In most cases we have less entries than asked.
+    auto applicability = ConvApplicability{ctx, problem};
+
+    // Decision table Fallback
+    if(const auto solvers = conv::GetDecisionTableSolvers(ctx, problem))
+    {
+        MIOPEN_LOG_I2("Using decision table Fallback");
+        const auto rank_time = [](const int& idx) {
+            return 10.0f * static_cast<float>(idx); // Assume idx == 1 (best solver) is 10 ms.
+        };
+        int idx = 1;
+        for(const auto solver_id : *solvers)
+        {
+            const auto sol  = solver_id.GetSolver();
+            const auto algo = solver_id.GetAlgo();
+            if(conv::IsAlgorithmDisabled(algo))
+                continue;
+            if(!sol.IsDynamic())
+                continue;
+            if(!applicability.IsApplicable(solver_id))
+                continue;
+            const auto ws = sol.GetWorkspaceSize(ctx, problem);
+            if(!conv::IsEnoughWorkspace(
+                   "GetSolutionsFallback decision table", solver_id, ws, invokeParams))
+                continue;
+            interim.emplace_back(miopenConvSolution_t{rank_time(idx), ws, solver_id.Value(), algo});
+            ++idx;
+        }
+    }
 
     // TunaNet Fallback
+    auto ai_applicable = false;
 #if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
-    if(!env::disabled(MIOPEN_DEBUG_ENABLE_AI_IMMED_MODE_FALLBACK))
+    // if the decision table has no entry for the problem or no applicable solvers
+    if(interim.empty() && !env::disabled(MIOPEN_DEBUG_ENABLE_AI_IMMED_MODE_FALLBACK))
     {
         const static std::string arch = ctx.GetStream().GetDeviceName();
         auto solvers                  = ai::immed_mode::PredictSolver(problem, ctx, arch);
+        ai_applicable                 = !solvers.empty();
         if(!solvers.empty())
         {
             MIOPEN_LOG_I2("Using TunaNet Fallback");
@@ -621,7 +656,7 @@ ConvolutionDescriptor::GetSolutionsFallback(const ExecutionContext& ctx,
                     continue;
                 if(!sol.IsDynamic())
                     continue; // branch should never be taken
-                if(!sol.IsApplicable(ctx, problem))
+                if(!applicability.IsApplicable(solver_id))
                     continue;
                 const auto ws = sol.GetWorkspaceSize(ctx, problem);
                 if(!conv::IsEnoughWorkspace("GetSolutionsFallback AI", solver_id, ws, invokeParams))
@@ -634,11 +669,16 @@ ConvolutionDescriptor::GetSolutionsFallback(const ExecutionContext& ctx,
     }
 #endif // MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
 
-    // WTI Fallback
-    // if TunaNet is not enabled or produces no applicable solvers then fallback to WTI
+    // Roofline or WTI Fallback
+    // if TunaNet is not enabled or has no model for the problem then fallback to the roofline
+    // cost model, which ranks the solvers by their estimated time. If TunaNet produces no
+    // applicable solvers then fallback to WTI.
     if(interim.empty())
     {
-        MIOPEN_LOG_I2("Using WTI Fallback");
+        const auto use_roofline =
+            !ai_applicable && !env::enabled(MIOPEN_DEBUG_DISABLE_CONV_ROOFLINE_FALLBACK);
+        MIOPEN_LOG_I2("Using " << (use_roofline ? "roofline" : "WTI") << " Fallback");
+        const auto device   = conv::RooflineDevice::Get(ctx);
         const auto wti2time = [](const float& wti) {
             assert(wti != 0.0f);
             if(wti <= 0.0f) // Return negative values as is, avoid DIV/0.
@@ -655,12 +695,22 @@ ConvolutionDescriptor::GetSolutionsFallback(const ExecutionContext& ctx,
                 continue;
             const auto& s = solver_id.GetSolver();
             // Let's allow non-dynamic later, if necessary.
-            if(s.IsEmpty() || !s.IsDynamic() || !s.IsApplicable(ctx, problem))
+            if(s.IsEmpty() || !s.IsDynamic() || !applicability.IsApplicable(solver_id))
                 continue;
             const auto ws = s.GetWorkspaceSize(ctx, problem);
             if(!conv::IsEnoughWorkspace("GetSolutionsFallback WTI", solver_id, ws, invokeParams))
                 continue;
 
+            if(use_roofline)
+            {
+                const auto time = conv::EstimateSolverTime(device, ctx, problem, solver_id, ws);
+                MIOPEN_LOG_I2(solver_id.ToString() << " Estimated time = " << time);
+                if(time < 0.0f) // Skip unknown estimations.
+                    continue;
+                interim.emplace_back(miopenConvSolution_t{time, ws, solver_id.Value(), algo});
+                continue;
+            }
+
             const auto wti = s.GetWti(ctx, problem);
             MIOPEN_LOG_I2(solver_id.ToString() << " Estimated WTI = " << wti);
             if(wti < 0.0f) // Skip unknown WTIs.
@@ -743,11 +793,12 @@ std::vector<miopenConvSolution_t> GetSolutions(const ExecutionContext& ctx,
     std::sort(begin(interim), end(interim), SolutionTimeComparator{});
     auto out = std::vector<miopenConvSolution_t>{};
     out.reserve(maxSolutionCount);
-    auto n_copied = 0;
+    auto n_copied      = 0;
+    auto applicability = ConvApplicability{ctx, problem};
     for(const auto& s : interim)
     {
         const auto solver_id = solver::Id{s.solution_id};
-        if(!solver_id.GetSolver().IsApplicable(ctx, problem))
+        if(!applicability.IsApplicable(solver_id))
             continue;
         if(!conv::IsEnoughWorkspace("GetSolutions", solver_id, s.workspace_size, invokeParams))
             continue;
@@ -803,7 +854,7 @@ std::size_t ConvolutionDescriptor::GetForwardSolutionWorkspaceSize(Handle& handl
         conv::ProblemDescription{xDesc, wDesc, yDesc, *this, conv::Direction::Forward};
     auto ctx = ExecutionContext{};
     ctx.SetStream(&handle);
-    if(sol.IsApplicable(ctx, problem))
+    if(ConvApplicability{ctx, problem}.IsApplicable(solver_id))
         return sol.GetWorkspaceSize(ctx, problem);
     MIOPEN_THROW(miopenStatusBadParm,
                  "The supplied solution id: " + solver_id.ToString() +
@@ -1008,7 +1059,7 @@ std::size_t ConvolutionDescriptor::GetBackwardSolutionWorkspaceSize(Handle& hand
         conv::ProblemDescription{dyDesc, wDesc, dxDesc, *this, conv::Direction::BackwardData};
     auto ctx = ExecutionContext{};
     ctx.SetStream(&handle);
-    if(sol.IsApplicable(ctx, problem))
+    if(ConvApplicability{ctx, problem}.IsApplicable(solver_id))
     {
         return sol.GetWorkspaceSize(ctx, problem);
     }
@@ -1212,7 +1263,7 @@ std::size_t ConvolutionDescriptor::GetWrwSolutionWorkspaceSize(Handle& handle,
         conv::ProblemDescription{dyDesc, dwDesc, xDesc, *this, conv::Direction::BackwardWeights};
     auto ctx = ExecutionContext{};
     ctx.SetStream(&handle);
-    if(sol.IsApplicable(ctx, problem))
+    if(ConvApplicability{ctx, problem}.IsApplicable(solver_id))
     {
         return sol.GetWorkspaceSize(ctx, problem);
     }
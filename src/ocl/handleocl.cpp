@@ -38,6 +38,7 @@
 #include <miopen/manage_ptr.hpp>
 #include <miopen/ocldeviceinfo.hpp>
 #include <miopen/timer.hpp>
+#include <miopen/trace.hpp>
 
 #include <miopen/filesystem.hpp>
 #include <boost/filesystem/operations.hpp>
@@ -79,10 +80,10 @@ struct HandleImpl
     AqPtr queue         = nullptr;
     cl_device_id device = nullptr; // NOLINT
     Allocator allocator{};
-    KernelCache cache;
     bool enable_profiling  = false;
     float profiling_result = 0.0;
     TargetProperties target_properties;
+    std::shared_ptr<KernelCache> cache = std::make_shared<KernelCache>();
 
     std::string get_device_name() const
     {
@@ -180,9 +181,50 @@ Handle::Handle(miopenAcceleratorQueue_t stream) : impl(new HandleImpl())
 
     this->SetAllocator(nullptr, nullptr, nullptr);
     this->impl->target_properties.Init(this);
+    this->decision_tables = std::make_shared<conv::DecisionTableCache>(*this);
     MIOPEN_LOG_NQI(*this);
 }
 
+Handle::Handle(const Handle& parent, miopenAcceleratorQueue_t stream)
+    : impl(new HandleImpl()),
+      invokers(parent.invokers),
+      applicability(parent.applicability),
+      decision_tables(parent.decision_tables),
+      execution_plans(parent.execution_plans)
+{
+    clRetainCommandQueue(stream);
+    impl->queue   = HandleImpl::AqPtr{stream};
+    impl->device  = miopen::GetDevice(impl->queue.get());
+    impl->context = impl->create_context_from_queue();
+
+    // The programs are only valid within the context they were built for.
+    if(impl->context.get() != parent.impl->context.get())
+        MIOPEN_THROW(miopenStatusBadParm, "The queue does not belong to the parent's context");
+
+    impl->cache             = parent.impl->cache;
+    impl->allocator         = parent.impl->allocator;
+    impl->target_properties = parent.impl->target_properties;
+    MIOPEN_LOG_NQI(*this);
+}
+
+std::unique_ptr<Handle> Handle::CreateChild(const Handle& parent)
+{
+    cl_int status = 0;
+#ifdef CL_VERSION_2_0
+    const cl_queue_properties cq_props[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_PROFILING_ENABLE, 0};
+
+    const auto queue = HandleImpl::AqPtr{clCreateCommandQueueWithProperties(
+        parent.impl->context.get(), parent.impl->device, cq_props, &status)};
+#else
+    const auto queue = HandleImpl::AqPtr{clCreateCommandQueue(
+        parent.impl->context.get(), parent.impl->device, CL_QUEUE_PROFILING_ENABLE, &status)};
+#endif
+    if(status != CL_SUCCESS)
+        MIOPEN_THROW_CL_STATUS(status, "Error creating command queue");
+    // The child retains the queue.
+    return std::make_unique<Handle>(parent, queue.get());
+}
+
 static bool PrintOpenCLDeprecateMsg()
 {
     MIOPEN_LOG_W("Please note that the OpenCL backend to MIOpen is being deprecated, ");
@@ -261,6 +303,7 @@ Handle::Handle() : impl(new HandleImpl())
     }
     this->SetAllocator(nullptr, nullptr, nullptr);
     this->impl->target_properties.Init(this);
+    this->decision_tables = std::make_shared<conv::DecisionTableCache>(*this);
     MIOPEN_LOG_NQI(*this);
 }
 
@@ -320,7 +363,7 @@ KernelInvoke Handle::AddKernel(const std::string& algorithm,
                                std::size_t cache_index,
                                const std::string& kernel_src) const
 {
-    auto obj = this->impl->cache.AddKernel(*this,
+    auto obj = this->impl->cache->AddKernel(*this,
                                            algorithm,
                                            network_config,
                                            program_name,
@@ -343,7 +386,7 @@ Invoker Handle::PrepareInvoker(const InvokerFactory& factory,
     for(auto& k : kernels)
     {
         MIOPEN_LOG_I2("Preparing kernel: " << k.kernel_name);
-        const auto kernel = this->impl->cache.AddKernel(*this,
+        const auto kernel = this->impl->cache->AddKernel(*this,
                                                         "",
                                                         "",
                                                         k.kernel_file,
@@ -360,13 +403,13 @@ Invoker Handle::PrepareInvoker(const InvokerFactory& factory,
 void Handle::ClearKernels(const std::string& algorithm, const std::string& network_config) const
 {
 
-    this->impl->cache.ClearKernels(algorithm, network_config);
+    this->impl->cache->ClearKernels(algorithm, network_config);
 }
 
-const std::vector<Kernel>& Handle::GetKernelsImpl(const std::string& algorithm,
-                                                  const std::string& network_config) const
+std::shared_ptr<const std::vector<Kernel>>
+Handle::GetKernelsImpl(const std::string& algorithm, const std::string& network_config) const
 {
-    return this->impl->cache.GetKernels(algorithm, network_config);
+    return this->impl->cache->GetKernels(algorithm, network_config);
 }
 
 KernelInvoke Handle::Run(Kernel k, bool coop_launch) const
@@ -393,6 +436,7 @@ Program Handle::LoadProgram(const std::string& program_name,
                             const std::string& kernel_src,
                             bool force_attach_binary) const
 {
+    MIOPEN_TRACE_SCOPE_DETAIL("compile", "LoadProgram", program_name);
     // Binary serialization is not supported on OpenCL anyway
     std::ignore = force_attach_binary;
 
@@ -436,19 +480,19 @@ Program Handle::LoadProgram(const std::string& program_name,
 
 void Handle::ClearProgram(const std::string& program_name, const std::string& params) const
 {
-    this->impl->cache.ClearProgram(program_name, params);
+    this->impl->cache->ClearProgram(program_name, params);
 }
 
 bool Handle::HasProgram(const std::string& program_name, const std::string& params) const
 {
-    return this->impl->cache.HasProgram(program_name, params);
+    return this->impl->cache->HasProgram(program_name, params);
 }
 
 void Handle::AddProgram(Program prog,
                         const std::string& program_name,
                         const std::string& params) const
 {
-    this->impl->cache.AddProgram(prog, program_name, params);
+    this->impl->cache->AddProgram(prog, program_name, params);
 }
 
 void Handle::Finish() const { clFinish(this->GetStream()); }
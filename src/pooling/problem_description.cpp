@@ -49,7 +49,40 @@ std::string get_vect_config(const std::vector<T>& v)
 
 } // namespace
 
+ProblemKey ProblemDescription::MakeKey() const
+{
+    // Covers everything MakeNetworkConfig() prints.
+    auto key = ProblemKey{ProblemKey::Kind::Pooling};
+    key.Add(direction);
+    key.Add(pooling.GetMode());
+    key.Add(pooling.GetIndexType());
+    key.Add(pooling.GetWorkspaceIndexMode());
+    key.Add(pooling.GetLengths());
+    key.Add(pooling.GetStrides());
+    key.Add(pooling.GetPads());
+    key.Add(xDesc);
+    key.Add(yDesc);
+    if(direction == Direction::Forward)
+    {
+        key.Add(save_index);
+    }
+    else
+    {
+        key.Add(dxDesc);
+        key.Add(dyDesc);
+    }
+    return key;
+}
+
 NetworkConfig ProblemDescription::MakeNetworkConfig() const
+{
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    thread_local ProblemKeyTextCache cache;
+
+    return NetworkConfig{cache.Get(MakeKey(), [&]() { return MakeNetworkConfigText(); })};
+}
+
+std::string ProblemDescription::MakeNetworkConfigText() const
 {
     std::ostringstream ss;
 
@@ -84,7 +117,7 @@ NetworkConfig ProblemDescription::MakeNetworkConfig() const
         ss << "_dys" << get_vect_config(dyDesc.GetStrides());
     }
 
-    return NetworkConfig{ss.str()};
+    return ss.str();
 }
 
 } // namespace pooling
@@ -507,7 +507,8 @@ std::vector<Solution> Problem::FindSolutionsImpl(Handle& handle,
 
     auto ctx = ExecutionContext{&handle};
     conv_problem.SetupFloats(ctx);
-    ctx.do_search = options.exhaustive_search;
+    ctx.do_search    = options.exhaustive_search;
+    ctx.find_monitor = options.monitor;
 
     const auto invoke_ctx =
         MakeConvInvokeParams(x_desc, x, w_desc, w, y_desc, y, workspace, workspace_size);
@@ -519,7 +520,9 @@ std::vector<Solution> Problem::FindSolutionsImpl(Handle& handle,
     {
         result.SetProblem({*this});
 
-        if(result.GetKernels().empty())
+        // The config of a partial result may not be in the perf-db to prepare it again, but its
+        // invoker is set by the find.
+        if(result.GetKernels().empty() && !result.IsPartial())
         {
             // If find-db was used binaries and invoker have not been set.
             // This would make binaries not serialized and invoker not cached.
@@ -0,0 +1,84 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/problem_key.hpp>
+
+#include <miopen/tensor.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+namespace miopen {
+
+namespace {
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<bool> text_cache_enabled{true};
+
+} // namespace
+
+void ProblemKey::Add(std::string_view str)
+{
+    Push(str.size());
+    for(std::size_t i = 0; i < str.size(); i += sizeof(std::uint64_t))
+    {
+        std::uint64_t word = 0;
+        std::memcpy(&word, str.data() + i, std::min(sizeof(word), str.size() - i));
+        Push(word);
+    }
+}
+
+void ProblemKey::Add(const TensorDescriptor& desc)
+{
+    const auto cast_type = desc.GetCastType();
+    // The small fields share one word.
+    Push(static_cast<std::uint64_t>(desc.GetType()) |
+         (cast_type ? static_cast<std::uint64_t>(*cast_type) + 1 : 0) << 8 |
+         static_cast<std::uint64_t>(desc.GetLayout_t()) << 16 |
+         static_cast<std::uint64_t>(desc.GetVectorLength()) << 24 |
+         static_cast<std::uint64_t>(desc.GetNumDims()) << 32);
+    for(const auto len : desc.GetLengths())
+        Push(len);
+    for(const auto stride : desc.GetStrides())
+        Push(stride);
+}
+
+std::size_t ProblemKey::Hash() const
+{
+    auto hash = std::uint64_t{size};
+    for(std::size_t i = 0; i < Used(); ++i)
+    {
+        hash = (hash ^ words[i]) * 0x9e3779b97f4a7c15;
+        hash ^= hash >> 32;
+    }
+    return static_cast<std::size_t>(hash);
+}
+
+bool ProblemKeyTextCache::IsEnabled() { return text_cache_enabled; }
+
+void ProblemKeyTextCache::SetEnabled(bool enabled) { text_cache_enabled = enabled; }
+
+} // namespace miopen
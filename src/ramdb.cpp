@@ -29,6 +29,7 @@
 #include <miopen/errors.hpp>
 #include <miopen/lock_file.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/trace.hpp>
 
 #include <miopen/filesystem.hpp>
 
@@ -38,6 +39,7 @@
 #include <limits>
 #include <map>
 #include <mutex>
+#include <shared_mutex>
 #include <sstream>
 
 namespace miopen {
@@ -85,6 +87,7 @@ static void UpdateDbModificationTime(const fs::path& path)
 static std::chrono::seconds GetLockTimeout() { return std::chrono::seconds{60}; }
 
 using exclusive_lock = std::unique_lock<LockFile>;
+using shared_lock    = std::shared_lock<LockFile>;
 
 RamDb::RamDb(DbKinds db_kind_, const fs::path& path, bool is_system)
     : PlainTextDb(db_kind_, path, is_system)
@@ -94,13 +97,21 @@ RamDb::RamDb(DbKinds db_kind_, const fs::path& path, bool is_system)
 RamDb& RamDb::GetCached(DbKinds db_kind_, const fs::path& path, bool is_system)
 {
     // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
-    static std::mutex mutex;
-    const std::lock_guard<std::mutex> lock{mutex};
+    static std::shared_mutex mutex;
 
     // We don't have to store kind to properly index as different dbs would have different paths
     // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
     static auto instances = std::map<fs::path, std::unique_ptr<RamDb>>{};
-    const auto it         = instances.find(path);
+
+    {
+        const std::shared_lock<std::shared_mutex> lock{mutex};
+        const auto it = instances.find(path);
+        if(it != instances.end())
+            return *it->second;
+    }
+
+    const std::unique_lock<std::shared_mutex> lock{mutex};
+    const auto it = instances.find(path);
 
     if(it != instances.end())
         return *it->second;
@@ -118,6 +129,16 @@ RamDb& RamDb::GetCached(DbKinds db_kind_, const fs::path& path, bool is_system)
 
 boost::optional<DbRecord> RamDb::FindRecord(const std::string& problem)
 {
+    MIOPEN_TRACE_SCOPE_DETAIL("db", "RamDb::FindRecord", problem);
+    {
+        // Lookups of several threads only share the lock unless the cache has to be refreshed.
+        const auto lock = shared_lock(GetLockFile(), GetLockTimeout());
+        MIOPEN_VALIDATE_LOCK(lock);
+
+        if(ValidateUnsafe())
+            return FindRecordUnsafe(problem);
+    }
+
     const auto lock = exclusive_lock(GetLockFile(), GetLockTimeout());
     MIOPEN_VALIDATE_LOCK(lock);
 
@@ -132,6 +153,7 @@ boost::optional<DbRecord> RamDb::FindRecord(const std::string& problem)
 
 bool RamDb::StoreRecord(const DbRecord& record)
 {
+    MIOPEN_TRACE_SCOPE_DETAIL("db", "RamDb::StoreRecord", record.GetKey());
     const auto& key = record.GetKey();
     MIOPEN_LOG_I2("Trying to store record at key " << key << " in cache for file "
                                                    << GetFileName());
@@ -155,6 +177,7 @@ bool RamDb::StoreRecord(const DbRecord& record)
 
 bool RamDb::UpdateRecord(DbRecord& record)
 {
+    MIOPEN_TRACE_SCOPE_DETAIL("db", "RamDb::UpdateRecord", record.GetKey());
     const auto& key = record.GetKey();
     MIOPEN_LOG_I2("Trying to update record at key " << key << " in cache for file "
                                                     << GetFileName());
@@ -303,6 +326,7 @@ bool RamDb::ValidateUnsafe()
 
 void RamDb::Prefetch()
 {
+    MIOPEN_TRACE_SCOPE("db", "RamDb::Prefetch");
     if(DisableUserDbFileIO)
         MIOPEN_THROW("Prefetch should never happen with disabled File IO");
 
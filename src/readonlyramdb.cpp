@@ -28,6 +28,7 @@
 #include <miopen/logger.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/filesystem.hpp>
+#include <miopen/trace.hpp>
 
 #if MIOPEN_EMBED_DB
 #include <miopen_data.hpp>
@@ -35,6 +36,7 @@
 
 #include <fstream>
 #include <mutex>
+#include <shared_mutex>
 #include <sstream>
 #include <map>
 
@@ -53,13 +55,22 @@ ReadonlyRamDb&
 ReadonlyRamDb::GetCached(DbKinds db_kind_, const fs::path& path, bool warn_if_unreadable)
 {
     // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
-    static std::mutex mutex;
-    const std::lock_guard<std::mutex> lock{mutex};
+    static std::shared_mutex mutex;
 
     // We don't have to store kind to properly index as different dbs would have different paths
     // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
     static auto instances = std::map<fs::path, ReadonlyRamDb*>{};
-    const auto it         = instances.find(path);
+
+    {
+        // Every find-db lookup passes through here, so the common case only takes a shared lock.
+        const std::shared_lock<std::shared_mutex> lock{mutex};
+        const auto it = instances.find(path);
+        if(it != instances.end())
+            return *it->second;
+    }
+
+    const std::unique_lock<std::shared_mutex> lock{mutex};
+    const auto it = instances.find(path);
 
     if(it != instances.end())
         return *it->second;
@@ -129,6 +140,7 @@ void ReadonlyRamDb::ParseAndLoadDb(std::istream& input_stream, bool warn_if_unre
 
 void ReadonlyRamDb::Prefetch(bool warn_if_unreadable)
 {
+    MIOPEN_TRACE_SCOPE("db", "ReadonlyRamDb::Prefetch");
     Measure("Prefetch", [this, warn_if_unreadable]() {
         if(db_path.empty())
             return;
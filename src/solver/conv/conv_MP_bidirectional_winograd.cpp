@@ -945,6 +945,8 @@ ConvMPBidirectWinograd_xdlops<WinoDataH, WinoFilterH, WinoDataW, WinoFilterW>::S
     const ProblemDescription& problem,
     const AnyInvokeParams& invoke_ctx) const
 {
+    // The search of the transformed problem would be reported under another solver.
+    SkipSearchInDryRun(SolverDbId());
     const auto xdlops_invoke_ctx =
         GetTransformedInvokeContext<WinoDataH, WinoFilterH, WinoDataW, WinoFilterW>(problem,
                                                                                     invoke_ctx);
@@ -37,6 +37,7 @@
 #include <miopen/gcn_asm_utils.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/sequences.hpp>
 #include <miopen/solver.hpp>
 #include <miopen/conv/heuristics/ai_heuristics.hpp>
 
@@ -89,21 +90,6 @@ bool IsTwoPower(const int v)
     return L <= v && v <= H;
 }
 
-template <int L, int H>
-bool NextTwoPower(int& v)
-{
-    static_assert((((L - 1) & L) == 0), "L is not power of 2");
-    static_assert((((H - 1) & H) == 0), "H is not power of 2");
-    assert((IsTwoPower<L, H>(v)));
-    if(v == H)
-    {
-        v = L;
-        return true;
-    }
-    v *= 2;
-    return false;
-}
-
 template <int L, int H>
 bool IsLinear(const int v)
 {
@@ -111,95 +97,64 @@ bool IsLinear(const int v)
     return L <= v && v <= H;
 }
 
-template <int L, int H>
-bool NextLinear(int& v)
-{
-    assert((IsLinear<L, H>(v)));
-    if(H == v)
-    {
-        v = L;
-        return true;
-    }
-    ++v;
-    return false;
-}
-
 // This range is like regular range [0,4,8...32], but 1 is used instead of 0.
 bool Is_1_4_8_12_to_32(const int& v) { return v == 1 || (v % 4 == 0 && IsLinear<1, 8>(v / 4)); }
 
-bool Next_1_4_8_12_to_32(int& v)
+// clang-format off
+using PerfConfig = PerformanceConfigConvAsm1x1U;
+
+/// The full search space. The first rule varies fastest.
+auto FullPerfFieldRules()
 {
-    assert(Is_1_4_8_12_to_32(v));
-    int tmp        = v / 4;
-    const bool ret = NextLinear<0, 8>(tmp);
-    v              = ret ? 1 : tmp * 4;
-    return ret;
+    // This range is like regular range [0,4,8...32], but 1 is used instead of 0.
+    using KMult = seq::Join<seq::Sequence<int, 1>, seq::Multiplied<seq::Span<int, 1, 8>, 4>>;
+    return seq::MakeRuleSet(
+        std::make_tuple(seq::Span<int, 1, 4>{}, &PerfConfig::read_size),
+        std::make_tuple(KMult{}, &PerfConfig::k_mult),
+        std::make_tuple(seq::Span<int, 1, 16>{}, &PerfConfig::chunks_per_wave),
+        std::make_tuple(seq::TwoPowersSpan<int, 1, 64>{}, &PerfConfig::chunk_size),
+        std::make_tuple(seq::Span<int, 1, 8>{}, &PerfConfig::n_mult),
+        std::make_tuple(seq::TwoPowersSpan<int, 1, 32>{}, &PerfConfig::c_mult),
+        std::make_tuple(seq::Span<int, 1, 8>{}, &PerfConfig::waves_c_in_group),
+        std::make_tuple(seq::TwoPowersSpan<int, 1, 8>{}, &PerfConfig::waves_k_in_group)
+    );
 }
 
-#ifndef NDEBUG
-bool Is_1_4(const int& v) { return v == 1 || v == 4; }
-#endif
+/// Narrowed search space of the optimized mode.
+template <class TKMult, class TChunkSize>
+auto OptimizedPerfFieldRules()
+{
+    return seq::MakeRuleSet(
+        std::make_tuple(seq::Span<int, 1, 4>{}, &PerfConfig::read_size),
+        std::make_tuple(TKMult{}, &PerfConfig::k_mult),
+        std::make_tuple(seq::Span<int, 1, 8>{}, &PerfConfig::chunks_per_wave),
+        std::make_tuple(TChunkSize{}, &PerfConfig::chunk_size),
+        std::make_tuple(seq::Span<int, 1, 4>{}, &PerfConfig::n_mult),
+        std::make_tuple(seq::TwoPowersSpan<int, 1, 4>{}, &PerfConfig::c_mult),
+        std::make_tuple(seq::TwoPowersSpan<int, 1, 4>{}, &PerfConfig::waves_c_in_group),
+        std::make_tuple(seq::TwoPowersSpan<int, 1, 8>{}, &PerfConfig::waves_k_in_group)
+    );
+}
+// clang-format on
 
-bool Next_1_4(int& v)
+/// Calls f with the rules of the main or the spare set of the current search mode.
+template <class F>
+auto VisitPerfFieldRules(bool spare, F f)
 {
-    assert(Is_1_4(v));
-    if(v == 4)
-    {
-        v = 1;
-        return true;
-    }
-    v = 4;
-    return false;
+    if(env::disabled(MIOPEN_DEBUG_CONV_DIRECT_ASM_1X1U_SEARCH_OPTIMIZED))
+        return f(FullPerfFieldRules());
+    if(spare)
+        return f(OptimizedPerfFieldRules<seq::Sequence<int, 1, 4>, seq::Sequence<int, 1, 4>>());
+    return f(OptimizedPerfFieldRules<seq::TwoPowersSpan<int, 8, 32>,
+                                     seq::TwoPowersSpan<int, 16, 64>>());
 }
 
 } // namespace
 
 bool PerformanceConfigConvAsm1x1U::SetNextValue(const ProblemDescription&)
 {
-    // Increment with wrap-around:
-    do
-    {
-        if(!NextLinear<1, 4>(read_size))
-            break;
-        if(!env::disabled(MIOPEN_DEBUG_CONV_DIRECT_ASM_1X1U_SEARCH_OPTIMIZED))
-        {
-            /// Narrow search space in optimized mode.
-            if(use_spare_set ? !Next_1_4(k_mult) : !NextTwoPower<8, 32>(k_mult))
-                break;
-            if(!NextLinear<1, 8>(chunks_per_wave))
-                break;
-            if(use_spare_set ? !Next_1_4(chunk_size) : !NextTwoPower<16, 64>(chunk_size))
-                break;
-            if(!NextLinear<1, 4>(n_mult))
-                break;
-            if(!NextTwoPower<1, 4>(c_mult))
-                break;
-            if(!NextTwoPower<1, 4>(waves_c_in_group))
-                break;
-            if(!NextTwoPower<1, 8>(waves_k_in_group))
-                break;
-        }
-        else
-        {
-            if(!Next_1_4_8_12_to_32(k_mult))
-                break;
-            if(!NextLinear<1, 16>(chunks_per_wave))
-                break;
-            if(!NextTwoPower<1, 64>(chunk_size))
-                break;
-            if(!NextLinear<1, 8>(n_mult))
-                break;
-            if(!NextTwoPower<1, 32>(c_mult))
-                break;
-            if(!NextLinear<1, 8>(waves_c_in_group))
-                break;
-            if(!NextTwoPower<1, 8>(waves_k_in_group))
-                break;
-        }
-        // All the fields of performance config have wrapped around.
-        return false;
-    } while(false);
-    return true;
+    return VisitPerfFieldRules(use_spare_set,
+                               [&](const auto& rules) { return !rules.Next(*this); });
 }
 
 PerformanceConfigConvAsm1x1U::PerformanceConfigConvAsm1x1U(bool spare)
@@ -915,7 +870,16 @@ PerformanceConfigConvAsm1x1U ConvAsm1x1U::Search(const ExecutionContext& ctx,
                                                  const ProblemDescription& problem,
                                                  const AnyInvokeParams& invoke_ctx) const
 {
-    return GenericSearch(*this, ctx, problem, invoke_ctx);
+    // The full set has millions of configs, so the space is decoded by index instead of being
+    // materialized.
+    auto context                  = ctx;
+    context.is_for_generic_search = true;
+    const auto spare              = UseSpareConfigs(*this, context, problem);
+
+    const auto space = VisitPerfFieldRules(spare, [&](const auto& rules) {
+        return MakeConfigSpace(rules, PerformanceConfigConvAsm1x1U{spare});
+    });
+    return GenericSearch(*this, ctx, problem, invoke_ctx, space);
 }
 
 } // namespace conv
@@ -324,7 +324,11 @@ PerformanceConfigConvAsm3x3U ConvAsm3x3U::Search(const ExecutionContext& ctx,
                                                  const ProblemDescription& problem,
                                                  const AnyInvokeParams& invoke_ctx) const
 {
-    return GenericSearch(*this, ctx, problem, invoke_ctx);
+    return GenericSearch(*this,
+                         ctx,
+                         problem,
+                         invoke_ctx,
+                         MakeConfigSpace<PerformanceConfigConvAsm3x3U>(PerfFieldRules()));
 }
 
 } // namespace conv
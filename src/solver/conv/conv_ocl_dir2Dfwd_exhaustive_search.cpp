@@ -31,6 +31,7 @@
 #include <miopen/db_path.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/legacy_exhaustive_search.hpp>
+#include <miopen/tuning_cost.hpp>
 #include <miopen/bfloat16.hpp>
 #include <miopen/fusion/fusion_invoke_params.hpp>
 #include <half/half.hpp>
@@ -214,6 +215,7 @@ ConvOclDirectFwdLegacyExhaustiveSearch::Search(const ExecutionContext& ctx,
                                                const ProblemDescription& problem,
                                                const AnyInvokeParams& invoke_ctx) const
 {
+    SkipSearchInDryRun(SolverDbId());
     if(problem.IsFp16())
     {
         return SearchImpl<half_float::half>(ctx, problem, invoke_ctx);
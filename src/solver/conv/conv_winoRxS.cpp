@@ -431,7 +431,11 @@ ConvBinWinoRxS<Winodata, Winofilter>::Search(const ExecutionContext& ctx,
                                              const ProblemDescription& problem,
                                              const AnyInvokeParams& invoke_ctx) const
 {
-    return GenericSearch(*this, ctx, problem, invoke_ctx);
+    return GenericSearch(*this,
+                         ctx,
+                         problem,
+                         invoke_ctx,
+                         MakeConfigSpace<PerformanceConfigConvBinWinogradRxS>(PerfFieldRules()));
 }
 
 namespace {
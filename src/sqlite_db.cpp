@@ -28,6 +28,7 @@
 #include <miopen/errors.hpp>
 #include <miopen/lock_file.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/trace.hpp>
 #include <miopen/conv/problem_description.hpp>
 #include <miopen/exp_backoff.hpp>
 #include <miopen/filesystem.hpp>
@@ -208,6 +209,7 @@ SQLite::SQLite(SQLite&&) noexcept = default;
 SQLite& SQLite::operator=(SQLite&&) noexcept = default;
 SQLite::result_type SQLite::Exec(const std::string& query) const
 {
+    MIOPEN_TRACE_SCOPE("db", "SQLite::Exec");
     SQLite::result_type res;
     MIOPEN_LOG_T(std::this_thread::get_id() << ":" << query);
     {
@@ -0,0 +1,145 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/timing_policy.hpp>
+
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace miopen {
+
+namespace {
+
+constexpr float z_95 = 1.96f;
+// Scales MAD to the standard deviation for normally distributed samples.
+constexpr float mad_to_sigma = 1.4826f;
+// Standard error of the median relative to the one of the mean, for normal distribution.
+constexpr float median_efficiency = 1.2533f;
+
+float Median(std::vector<float>& samples)
+{
+    const auto middle = samples.begin() + samples.size() / 2;
+    std::nth_element(samples.begin(), middle, samples.end());
+    if(samples.size() % 2 != 0)
+        return *middle;
+    const auto lower = *std::max_element(samples.begin(), middle);
+    return (lower + *middle) / 2;
+}
+
+} // namespace
+
+TimingResult GetTimingResult(std::vector<float> samples, float outlier_threshold)
+{
+    TimingResult result;
+    result.runs = samples.size();
+    if(samples.empty())
+        return result;
+
+    auto median = Median(samples);
+    std::vector<float> deviations;
+    deviations.reserve(samples.size());
+    for(const auto sample : samples)
+        deviations.push_back(std::abs(sample - median));
+    const auto sigma = mad_to_sigma * Median(deviations);
+
+    if(outlier_threshold > 0.0f && sigma > 0.0f)
+    {
+        const auto limit = outlier_threshold * sigma;
+        const auto end   = std::remove_if(samples.begin(), samples.end(), [&](auto sample) {
+            return std::abs(sample - median) > limit;
+        });
+        result.outliers  = std::distance(end, samples.end());
+        samples.erase(end, samples.end());
+        median = Median(samples);
+    }
+
+    const auto n = static_cast<float>(samples.size());
+    float mean   = 0.0f;
+    for(const auto sample : samples)
+        mean += sample;
+    mean /= n;
+    float sum_sq = 0.0f;
+    for(const auto sample : samples)
+        sum_sq += (sample - mean) * (sample - mean);
+
+    result.time     = median;
+    result.variance = samples.size() > 1 ? sum_sq / (n - 1) : 0.0f;
+    if(samples.size() < 2)
+        result.confidence_interval = std::numeric_limits<float>::max();
+    else if(median > 0.0f)
+        result.confidence_interval =
+            z_95 * median_efficiency * std::sqrt(result.variance / n) / median;
+    return result;
+}
+
+TimingResult
+MeasureTime(const TimingPolicy& policy, const std::function<float()>& run, float best_time)
+{
+    float elapsed = 0.0f;
+    for(std::size_t i = 0; i < policy.warmup_runs && elapsed < policy.time_limit_ms; ++i)
+        elapsed += run();
+
+    const auto max_runs = std::max<std::size_t>(policy.max_runs, 1);
+    const auto min_runs = std::clamp<std::size_t>(policy.min_runs, 1, max_runs);
+    std::vector<float> samples;
+    samples.reserve(max_runs);
+    TimingResult result;
+
+    while(true)
+    {
+        const auto sample = run();
+        samples.push_back(sample);
+        elapsed += sample;
+
+        const auto done = samples.size() >= max_runs || elapsed >= policy.time_limit_ms;
+        if(samples.size() < min_runs && !done)
+            continue;
+
+        result = GetTimingResult(samples, policy.outlier_threshold);
+        if(done || result.confidence_interval <= policy.confidence_interval)
+            break;
+
+        if(policy.elimination_margin >= 0.0f && best_time != std::numeric_limits<float>::max())
+        {
+            const auto lower_bound = result.time * (1.0f - result.confidence_interval);
+            if(lower_bound > best_time * (1.0f + policy.elimination_margin))
+            {
+                result.eliminated = true;
+                break;
+            }
+        }
+    }
+
+    MIOPEN_LOG_I2("Timing: " << result.time << " ms (variance " << result.variance << ", ci "
+                             << result.confidence_interval << ", runs " << result.runs
+                             << ", outliers " << result.outliers
+                             << (result.eliminated ? ", eliminated" : "") << ')');
+    return result;
+}
+
+} // namespace miopen
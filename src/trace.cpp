@@ -0,0 +1,208 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/trace.hpp>
+
+#include <miopen/env.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/logger.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+/// Records the spans of the library activity (API calls, finds, compilation, database and binary
+/// cache accesses, lock waits) and writes them into this file at exit, as Chrome trace events.
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_TRACE_FILE)
+/// Maximum number of spans kept in memory, 0 means no limit. Once it is reached, the trace is
+/// written right away and the later spans are dropped.
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_TRACE_MAX_EVENTS, 1000000)
+
+namespace miopen {
+namespace trace {
+
+namespace {
+
+struct Event
+{
+    std::string_view category;
+    std::string_view name;
+    Clock::time_point start;
+    Clock::time_point end;
+    std::string detail;
+};
+
+/// Each thread appends to its own events, the mutex is only contended while writing the trace.
+struct ThreadEvents
+{
+    std::size_t tid;
+    std::mutex mutex;
+    std::vector<Event> events;
+};
+
+struct Registry
+{
+    Clock::time_point epoch = Clock::now();
+    std::mutex mutex;
+    // Kept after the threads exit.
+    std::vector<std::shared_ptr<ThreadEvents>> threads;
+    std::atomic<std::size_t> recorded{0};
+    std::atomic<std::size_t> dropped{0};
+};
+
+Registry& GetRegistry()
+{
+    // Never destroyed, spans may end in static destructors.
+    static auto* const registry = new Registry{};
+    return *registry;
+}
+
+ThreadEvents& GetThreadEvents()
+{
+    thread_local const auto events = []() {
+        auto& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        auto ret = std::make_shared<ThreadEvents>();
+        ret->tid = registry.threads.size() + 1;
+        registry.threads.push_back(ret);
+        return ret;
+    }();
+    return *events;
+}
+
+bool Init()
+{
+    GetRegistry();
+    std::atexit([]() { Write(); });
+    return true;
+}
+
+int GetProcessId()
+{
+#ifdef __linux__
+    return getpid();
+#else
+    return 0; // Not implemented.
+#endif
+}
+
+} // namespace
+
+bool IsEnabled()
+{
+    // Not cached, so the tests may enable it with env::update().
+    if(!MIOPEN_TRACE_FILE)
+        return false;
+    static const bool initialized = Init();
+    return initialized;
+}
+
+void Record(std::string_view category,
+            std::string_view name,
+            Clock::time_point start,
+            std::string detail)
+{
+    const auto end        = Clock::now();
+    auto& registry        = GetRegistry();
+    const auto max_events = env::value(MIOPEN_TRACE_MAX_EVENTS);
+    if(max_events != 0 && registry.recorded++ >= max_events)
+    {
+        if(registry.dropped++ == 0)
+        {
+            MIOPEN_LOG_W("MIOPEN_TRACE_MAX_EVENTS=" << max_events
+                                                    << " reached, the later spans are dropped");
+            // Not deferred to the exit, which may never come if the application crashes.
+            Write();
+        }
+        return;
+    }
+
+    auto& thread = GetThreadEvents();
+    std::lock_guard<std::mutex> lock(thread.mutex);
+    thread.events.push_back({category, name, start, end, std::move(detail)});
+}
+
+void Write()
+{
+    if(!IsEnabled())
+        return;
+
+    const auto path = fs::path{env::value(MIOPEN_TRACE_FILE)};
+    const auto pid  = GetProcessId();
+    auto& registry  = GetRegistry();
+
+    const auto micros = [&](Clock::time_point time) {
+        return std::chrono::duration<double, std::micro>(time - registry.epoch).count();
+    };
+
+    auto events = nlohmann::json::array();
+    {
+        std::lock_guard<std::mutex> registry_lock(registry.mutex);
+        for(const auto& thread : registry.threads)
+        {
+            std::lock_guard<std::mutex> lock(thread->mutex);
+            for(const auto& event : thread->events)
+            {
+                auto json = nlohmann::json{
+                    {"name", event.name},
+                    {"cat", event.category},
+                    {"ph", "X"},
+                    {"ts", micros(event.start)},
+                    {"dur", micros(event.end) - micros(event.start)},
+                    {"pid", pid},
+                    {"tid", thread->tid},
+                };
+                if(!event.detail.empty())
+                    json["args"] = {{"detail", event.detail}};
+                events.push_back(std::move(json));
+            }
+        }
+    }
+
+    std::ofstream file(path);
+    if(!file)
+    {
+        MIOPEN_LOG_E("Unable to write the trace to " << path);
+        return;
+    }
+    auto trace = nlohmann::json{{"traceEvents", std::move(events)}, {"displayTimeUnit", "ms"}};
+    if(const auto dropped = registry.dropped.load(); dropped != 0)
+        trace["otherData"] = {{"dropped_events", dropped}};
+    file << trace;
+    MIOPEN_LOG_I("Trace has been written to " << path);
+}
+
+} // namespace trace
+} // namespace miopen
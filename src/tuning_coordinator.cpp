@@ -0,0 +1,410 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/tuning_coordinator.hpp>
+
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/expanduser.hpp>
+#include <miopen/lock_file.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/md5.hpp>
+#include <miopen/stringutils.hpp>
+#include <miopen/version.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <fstream>
+#include <shared_mutex>
+#include <sstream>
+#include <thread>
+
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_TUNING_COORDINATOR_DIR)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_TUNING_SLICES, 16)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_TUNING_LEASE_MS, 60000)
+
+namespace miopen {
+namespace solver {
+
+namespace {
+
+std::optional<TuningSliceResult> Best(const std::vector<TuningSliceResult>& results)
+{
+    std::optional<TuningSliceResult> best;
+    for(const auto& result : results)
+    {
+        if(result.time < 0.0f)
+            continue;
+        if(!best || result.time < best->time)
+            best = result;
+    }
+    return best;
+}
+
+std::size_t CountSlices(const std::vector<TuningSliceResult>& results)
+{
+    std::vector<std::size_t> slices;
+    slices.reserve(results.size());
+    for(const auto& result : results)
+        slices.push_back(result.slice);
+    std::sort(slices.begin(), slices.end());
+    return std::distance(slices.begin(), std::unique(slices.begin(), slices.end()));
+}
+
+std::int64_t NowMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+} // namespace
+
+TuningCoordinator::TuningCoordinator(std::size_t slice_count_,
+                                     std::chrono::milliseconds lease_time_)
+    : slice_count(slice_count_), lease_time(std::max(lease_time_, std::chrono::milliseconds{4}))
+{
+}
+
+TuningCoordinator::TuningCoordinator(std::size_t slice_count_)
+    : TuningCoordinator(slice_count_,
+                        std::chrono::milliseconds{env::value(MIOPEN_TUNING_LEASE_MS)})
+{
+}
+
+std::optional<TuningSlice> TuningCoordinator::Job::Acquire(const std::string& job,
+                                                           std::size_t count,
+                                                           std::chrono::milliseconds lease_time)
+{
+    const auto now         = NowMs();
+    const auto is_reported = [&](std::size_t index) {
+        return std::any_of(results.begin(), results.end(), [&](const auto& result) {
+            return result.slice == index;
+        });
+    };
+
+    for(std::size_t index = 0; index < count; ++index)
+    {
+        auto& claim = claims[index];
+        if((claim.lease != 0 && claim.expires > now) || is_reported(index))
+            continue;
+        if(claim.lease != 0)
+            MIOPEN_LOG_W("Tuning job " << job << ": the lease of slice " << index
+                                       << " has expired, searching it again");
+        ++claim.lease;
+        claim.expires = now + lease_time.count();
+        return TuningSlice{index, count, claim.lease};
+    }
+    return std::nullopt;
+}
+
+bool TuningCoordinator::Job::Renew(const TuningSlice& slice, std::chrono::milliseconds lease_time)
+{
+    const auto claim = claims.find(slice.index);
+    if(claim == claims.end() || claim->second.lease != slice.lease)
+        return false;
+    claim->second.expires = NowMs() + lease_time.count();
+    return true;
+}
+
+bool TuningCoordinator::Job::Report(const TuningSliceResult& result)
+{
+    const auto claim = claims.find(result.slice);
+    if(claim == claims.end() || claim->second.lease != result.lease)
+        return false;
+    results.push_back(result);
+    return true;
+}
+
+TuningSliceResult
+TuningCoordinator::Search(const std::string& job,
+                          const TuningSlice& slice,
+                          const std::function<TuningSliceResult(const TuningSlice&)>& search)
+{
+    std::mutex mutex;
+    std::condition_variable stopped;
+    bool done = false;
+
+    // Renews the lease several times per lease time while the slice is searched.
+    std::thread heartbeat([&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while(!stopped.wait_for(lock, lease_time / 4, [&]() { return done; }))
+        {
+            try
+            {
+                if(Renew(job, slice))
+                    continue;
+                MIOPEN_LOG_W("Tuning job " << job << ": lost the lease of slice " << slice.index);
+                return;
+            }
+            catch(const std::exception& ex)
+            {
+                MIOPEN_LOG_W("Tuning job " << job << ": unable to renew the lease of slice "
+                                           << slice.index << ": " << ex.what());
+            }
+        }
+    });
+    const auto stop = [&]() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            done = true;
+        }
+        stopped.notify_one();
+        heartbeat.join();
+    };
+
+    auto result = TuningSliceResult{};
+    try
+    {
+        result = search(slice);
+    }
+    catch(...)
+    {
+        stop();
+        throw;
+    }
+    stop();
+    result.slice = slice.index;
+    result.lease = slice.lease;
+    return result;
+}
+
+std::optional<TuningSliceResult>
+TuningCoordinator::Run(const std::string& job,
+                       std::chrono::milliseconds wait_timeout,
+                       const std::function<TuningSliceResult(const TuningSlice&)>& search)
+{
+    auto deadline = std::chrono::steady_clock::now() + wait_timeout;
+
+    // The slices of dead workers become available again when their leases expire, so keep
+    // claiming while waiting for the others.
+    while(true)
+    {
+        auto searched = false;
+        while(const auto slice = Acquire(job))
+        {
+            searched = true;
+            if(!Report(job, Search(job, *slice, search)))
+                MIOPEN_LOG_W("Tuning job " << job << ": the lease of slice " << slice->index
+                                           << " has expired, the result is dropped");
+        }
+        // Only the time spent waiting for the others counts.
+        if(searched)
+            deadline = std::chrono::steady_clock::now() + wait_timeout;
+
+        const auto results  = Collect(job);
+        const auto reported = CountSlices(results);
+        if(reported >= slice_count)
+            return Best(results);
+        if(std::chrono::steady_clock::now() >= deadline)
+        {
+            MIOPEN_LOG_W("Tuning job " << job << ": only " << reported << " of " << slice_count
+                                       << " slices reported in time, the results are not used");
+            return std::nullopt;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    }
+}
+
+std::optional<TuningSlice> LocalTuningCoordinator::Acquire(const std::string& job)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return jobs[job].Acquire(job, slice_count, lease_time);
+}
+
+bool LocalTuningCoordinator::Renew(const std::string& job, const TuningSlice& slice)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return jobs[job].Renew(slice, lease_time);
+}
+
+bool LocalTuningCoordinator::Report(const std::string& job, const TuningSliceResult& result)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return jobs[job].Report(result);
+}
+
+std::vector<TuningSliceResult> LocalTuningCoordinator::Collect(const std::string& job)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return jobs[job].results;
+}
+
+FileTuningCoordinator::FileTuningCoordinator(const fs::path& directory_, std::size_t slice_count_)
+    : TuningCoordinator(slice_count_), directory(directory_)
+{
+    if(!fs::exists(directory))
+        fs::create_directories(directory);
+}
+
+FileTuningCoordinator::FileTuningCoordinator(const fs::path& directory_,
+                                             std::size_t slice_count_,
+                                             std::chrono::milliseconds lease_time_)
+    : TuningCoordinator(slice_count_, lease_time_), directory(directory_)
+{
+    if(!fs::exists(directory))
+        fs::create_directories(directory);
+}
+
+fs::path FileTuningCoordinator::JobPath(const std::string& job, const std::string& ext) const
+{
+    // The configs may not be valid for another version of the library and the format of the
+    // files may change, so the files of other versions are ignored.
+    static const auto version = std::to_string(MIOPEN_VERSION_MAJOR) + "." +
+                                std::to_string(MIOPEN_VERSION_MINOR) + "." +
+                                std::to_string(MIOPEN_VERSION_PATCH) + "." +
+                                MIOPEN_STRINGIZE(MIOPEN_VERSION_TWEAK) + "/" +
+                                std::to_string(file_format_version);
+    return directory / (md5(version + ':' + job) + ext);
+}
+
+// *.claims: <slice count> followed by <slice> <lease> <expires> per claimed slice.
+// *.results: <slice> <lease> <time> <config> per reported slice.
+TuningCoordinator::Job FileTuningCoordinator::Load(const std::string& job) const
+{
+    auto state = Job{};
+    {
+        std::ifstream in(JobPath(job, ".claims"));
+        std::size_t count = slice_count;
+        if(in)
+            in >> count;
+        if(count != slice_count)
+            MIOPEN_THROW("Tuning job " + job + " is split into " + std::to_string(count) +
+                         " slices by another worker. MIOPEN_TUNING_SLICES must be the same for "
+                         "all the workers.");
+        std::size_t slice = 0;
+        auto claim        = Job::Claim{};
+        while(in >> slice >> claim.lease >> claim.expires)
+            state.claims[slice] = claim;
+    }
+
+    std::ifstream in(JobPath(job, ".results"));
+    std::string line;
+    while(std::getline(in, line))
+    {
+        std::istringstream ss(line);
+        TuningSliceResult result;
+        if(!(ss >> result.slice >> result.lease >> result.time))
+        {
+            MIOPEN_LOG_W("Tuning job " << job << ": skipping malformed result: " << line);
+            continue;
+        }
+        ss >> result.config;
+        state.results.push_back(result);
+    }
+    return state;
+}
+
+void FileTuningCoordinator::Store(const std::string& job, const Job& state) const
+{
+    const auto claims_path = JobPath(job, ".claims");
+    std::ofstream out(claims_path, std::ios::trunc);
+    out << slice_count << std::endl;
+    for(const auto& [slice, claim] : state.claims)
+        out << slice << ' ' << claim.lease << ' ' << claim.expires << std::endl;
+    if(!out)
+        MIOPEN_THROW("Unable to update " + claims_path);
+}
+
+std::optional<TuningSlice> FileTuningCoordinator::Acquire(const std::string& job)
+{
+    auto& lock_file = LockFile::Get(JobPath(job, ".lock"));
+    std::lock_guard<LockFile> lock(lock_file);
+
+    auto state       = Load(job);
+    const auto slice = state.Acquire(job, slice_count, lease_time);
+    if(!slice)
+        return std::nullopt;
+    Store(job, state);
+    MIOPEN_LOG_I("Tuning job " << job << ": claimed slice " << slice->index << '/'
+                               << slice_count);
+    return slice;
+}
+
+bool FileTuningCoordinator::Renew(const std::string& job, const TuningSlice& slice)
+{
+    auto& lock_file = LockFile::Get(JobPath(job, ".lock"));
+    std::lock_guard<LockFile> lock(lock_file);
+
+    auto state = Load(job);
+    if(!state.Renew(slice, lease_time))
+        return false;
+    Store(job, state);
+    return true;
+}
+
+bool FileTuningCoordinator::Report(const std::string& job, const TuningSliceResult& result)
+{
+    auto& lock_file = LockFile::Get(JobPath(job, ".lock"));
+    std::lock_guard<LockFile> lock(lock_file);
+
+    if(!Load(job).Report(result))
+        return false;
+    std::ofstream out(JobPath(job, ".results"), std::ios::app);
+    out << result.slice << ' ' << result.lease << ' ' << result.time << ' ' << result.config
+        << std::endl;
+    if(!out)
+        MIOPEN_THROW("Unable to report tuning results to " + directory);
+    return true;
+}
+
+std::vector<TuningSliceResult> FileTuningCoordinator::Collect(const std::string& job)
+{
+    auto& lock_file = LockFile::Get(JobPath(job, ".lock"));
+    std::shared_lock<LockFile> lock(lock_file);
+    return Load(job).results;
+}
+
+namespace {
+std::shared_ptr<TuningCoordinator>& CoordinatorOverride()
+{
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::shared_ptr<TuningCoordinator> instance;
+    return instance;
+}
+} // namespace
+
+std::shared_ptr<TuningCoordinator> GetTuningCoordinator()
+{
+    if(CoordinatorOverride())
+        return CoordinatorOverride();
+
+    const auto dir = env::value(MIOPEN_TUNING_COORDINATOR_DIR);
+    if(dir.empty())
+        return nullptr;
+
+    static const auto file_coordinator = std::make_shared<FileTuningCoordinator>(
+        ExpandUser(dir), std::max<std::size_t>(env::value(MIOPEN_TUNING_SLICES), 1));
+    return file_coordinator;
+}
+
+void SetTuningCoordinator(std::shared_ptr<TuningCoordinator> coordinator)
+{
+    CoordinatorOverride() = std::move(coordinator);
+}
+
+} // namespace solver
+} // namespace miopen
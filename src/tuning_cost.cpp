@@ -0,0 +1,207 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/tuning_cost.hpp>
+
+#include <miopen/db_path.hpp>
+#include <miopen/env.hpp>
+#include <miopen/expanduser.hpp>
+#include <miopen/lock_file.hpp>
+#include <miopen/logger.hpp>
+
+#include <fstream>
+#include <sstream>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_TUNING_DRY_RUN)
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_TUNING_STATS_PATH)
+
+namespace miopen {
+namespace solver {
+
+namespace {
+
+// Used before any history is collected. Pessimistic, to not underestimate tuning jobs.
+constexpr float default_compile_time_ms = 2000.0f;
+constexpr float default_measure_time_ms = 10.0f;
+
+const std::string compile_kind = "compile";
+const std::string measure_kind = "measure";
+
+} // namespace
+
+std::ostream& operator<<(std::ostream& os, const TuningCostEstimate& estimate)
+{
+    if(!estimate.estimated)
+        return os << estimate.solver << ": not estimated, the solver has its own search";
+    return os << estimate.solver << ": configs " << estimate.searched_configs << " (primary "
+              << estimate.primary_configs << ", spare " << estimate.spare_configs << "), kernels "
+              << estimate.unique_kernels << " (" << estimate.unknown_kernels
+              << " without history), compile " << estimate.compile_time_ms << " ms, measure "
+              << estimate.measure_time_ms << " ms, wall " << estimate.wall_time_ms << " ms";
+}
+
+TuningStats::TuningStats(const fs::path& path_) : path(path_)
+{
+    if(!path.empty())
+        entries = Load();
+}
+
+void TuningStats::AddCompileTime(const std::string& kernel_file, float ms)
+{
+    Add(compile_kind + ' ' + kernel_file, ms);
+}
+
+void TuningStats::AddMeasureTime(const std::string& solver_id, float ms)
+{
+    Add(measure_kind + ' ' + solver_id, ms);
+}
+
+float TuningStats::GetCompileTime(const std::string& kernel_file, bool& known) const
+{
+    return Get(compile_kind, kernel_file, default_compile_time_ms, known);
+}
+
+float TuningStats::GetMeasureTime(const std::string& solver_id, bool& known) const
+{
+    return Get(measure_kind, solver_id, default_measure_time_ms, known);
+}
+
+void TuningStats::Add(const std::string& key, float ms)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for(auto* to : {&entries, &unsaved})
+    {
+        auto& entry = (*to)[key];
+        ++entry.count;
+        entry.total_ms += ms;
+    }
+}
+
+float TuningStats::Get(const std::string& kind,
+                       const std::string& key,
+                       float fallback,
+                       bool& known) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto found = entries.find(kind + ' ' + key);
+    known            = found != entries.end() && found->second.count != 0;
+    if(known)
+        return static_cast<float>(found->second.total_ms / found->second.count);
+
+    Entry all;
+    for(auto it = entries.lower_bound(kind + ' '); it != entries.end(); ++it)
+    {
+        if(it->first.compare(0, kind.size() + 1, kind + ' ') != 0)
+            break;
+        all.count += it->second.count;
+        all.total_ms += it->second.total_ms;
+    }
+    return all.count != 0 ? static_cast<float>(all.total_ms / all.count) : fallback;
+}
+
+TuningStats::Entries TuningStats::Load() const
+{
+    Entries loaded;
+    std::ifstream in(path);
+    std::string line;
+    while(std::getline(in, line))
+    {
+        std::istringstream ss(line);
+        std::string kind;
+        std::string key;
+        Entry entry;
+        if(!(ss >> kind >> key >> entry.count >> entry.total_ms))
+        {
+            MIOPEN_LOG_W("Skipping malformed line in " << path << ": " << line);
+            continue;
+        }
+        loaded[kind + ' ' + key] = entry;
+    }
+    return loaded;
+}
+
+void TuningStats::Save()
+{
+    if(path.empty())
+        return;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if(unsaved.empty())
+        return;
+
+    auto& lock_file = LockFile::Get(path + ".lock");
+    std::lock_guard<LockFile> file_lock(lock_file);
+
+    // Other processes may have updated the file since it was read.
+    entries = Load();
+    for(const auto& [key, entry] : unsaved)
+    {
+        auto& merged = entries[key];
+        merged.count += entry.count;
+        merged.total_ms += entry.total_ms;
+    }
+    unsaved.clear();
+
+    std::ofstream out(path, std::ios::trunc);
+    for(const auto& [key, entry] : entries)
+        out << key << ' ' << entry.count << ' ' << entry.total_ms << '\n';
+    if(!out)
+        MIOPEN_LOG_W("Unable to save tuning stats to " << path);
+}
+
+TuningStats& GetTuningStats()
+{
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static TuningStats instance{[]() -> fs::path {
+        const auto path = env::value(MIOPEN_TUNING_STATS_PATH);
+        if(!path.empty())
+            return ExpandUser(path);
+        const auto& udb = GetUserDbPath();
+        return udb.empty() ? fs::path{} : udb / "tuning_stats.txt";
+    }()};
+    return instance;
+}
+
+bool IsTuningDryRunEnabled() { return env::enabled(MIOPEN_TUNING_DRY_RUN); }
+
+void ReportTuningCost(const TuningCostEstimate& estimate)
+{
+    MIOPEN_LOG_W("Dry run: " << estimate);
+    MIOPEN_THROW(miopenStatusGpuOperationsSkipped, "Dry run. Search skipped");
+}
+
+void SkipSearchInDryRun(const std::string& solver_id)
+{
+    if(!IsTuningDryRunEnabled())
+        return;
+    auto estimate      = TuningCostEstimate{};
+    estimate.solver    = solver_id;
+    estimate.estimated = false;
+    ReportTuningCost(estimate);
+}
+
+} // namespace solver
+} // namespace miopen
@@ -0,0 +1,141 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/tuning_warm_start.hpp>
+
+#include <miopen/env.hpp>
+#include <miopen/tensor.hpp>
+
+#include <cmath>
+#include <map>
+#include <mutex>
+
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_TUNING_WARM_START_SEEDS, 4)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_TUNING_WARM_START_RADIUS, 4)
+
+namespace miopen {
+namespace solver {
+
+namespace {
+
+constexpr std::size_t neighbors_max  = 8;
+constexpr std::size_t batch_size_max = 4096;
+
+TensorDescriptor WithBatchSize(const TensorDescriptor& desc, std::size_t batch_size)
+{
+    // Lengths are always in the NC[D]HW order. Stride of N does not depend on N.
+    auto lens = desc.GetLengths();
+    lens[0]   = batch_size;
+    TensorDescriptor ret{desc.GetType(), lens, desc.GetStrides()};
+    if(const auto cast_type = desc.GetCastType())
+        ret.SetCastType(*cast_type);
+    return ret;
+}
+
+} // namespace
+
+std::size_t GetTuningWarmStartSeedsMax() { return env::value(MIOPEN_TUNING_WARM_START_SEEDS); }
+
+std::size_t GetTuningWarmStartRadius() { return env::value(MIOPEN_TUNING_WARM_START_RADIUS); }
+
+std::vector<miopen::conv::ProblemDescription>
+GetNeighborProblems(const miopen::conv::ProblemDescription& problem)
+{
+    const auto batch_size = problem.GetBatchSize();
+    if(batch_size == 0)
+        return {};
+
+    // Powers of two and multiples of the batch size, ordered by the ratio to the batch size.
+    std::vector<std::size_t> candidates;
+    for(std::size_t n = 1; n <= batch_size_max; n *= 2)
+    {
+        candidates.push_back(n);
+        if(batch_size * n <= batch_size_max)
+            candidates.push_back(batch_size * n);
+        if(batch_size / n != 0)
+            candidates.push_back(batch_size / n);
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+    candidates.erase(std::remove(candidates.begin(), candidates.end(), batch_size),
+                     candidates.end());
+    const auto distance = [&](std::size_t n) {
+        return std::abs(std::log2(static_cast<double>(n) / static_cast<double>(batch_size)));
+    };
+    std::stable_sort(candidates.begin(), candidates.end(), [&](auto l, auto r) {
+        return distance(l) < distance(r);
+    });
+    if(candidates.size() > neighbors_max)
+        candidates.resize(neighbors_max);
+
+    std::vector<miopen::conv::ProblemDescription> neighbors;
+    neighbors.reserve(candidates.size());
+    for(const auto n : candidates)
+    {
+        neighbors.emplace_back(WithBatchSize(problem.GetIn(), n),
+                               problem.GetWeights(),
+                               WithBatchSize(problem.GetOut(), n),
+                               problem.GetConv(),
+                               problem.GetDirection(),
+                               problem.GetBias(),
+                               problem.GetAlpha(),
+                               problem.GetBeta());
+    }
+    return neighbors;
+}
+
+void ReportWarmStartOutcome(const std::string& solver_id, WarmStartOutcome outcome)
+{
+    struct Counters
+    {
+        std::size_t total         = 0;
+        std::size_t seed          = 0;
+        std::size_t seed_neighbor = 0;
+    };
+
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::mutex mutex;
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::map<std::string, Counters> stats;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& counters = stats[solver_id];
+    ++counters.total;
+    if(outcome == WarmStartOutcome::Seed)
+        ++counters.seed;
+    else if(outcome == WarmStartOutcome::SeedNeighbor)
+        ++counters.seed_neighbor;
+
+    MIOPEN_LOG_I(solver_id << ": warm start, winner is "
+                           << (outcome == WarmStartOutcome::Seed           ? "a seed"
+                               : outcome == WarmStartOutcome::SeedNeighbor ? "a seed neighbor"
+                                                                           : "sampled")
+                           << ". Seeds won " << counters.seed << ", seed neighbors won "
+                           << counters.seed_neighbor << " of " << counters.total << " searches");
+}
+
+} // namespace solver
+} // namespace miopen
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <miopen/applicability_cache.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/env.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/tmp_dir.hpp>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_APPLICABILITY_CACHE_TEST)
+
+namespace {
+
+miopen::conv::ProblemDescription MakeProblem(const miopen::ConvolutionDescriptor& conv,
+                                             const std::vector<std::size_t>& in_strides,
+                                             double beta = 0.0)
+{
+    const auto in      = miopen::TensorDescriptor{miopenHalf, {16, 64, 28, 28}, in_strides};
+    const auto weights = miopen::TensorDescriptor{miopenHalf, {64, 64, 3, 3}};
+    const auto out     = miopen::TensorDescriptor{miopenHalf, {16, 64, 28, 28}};
+    return miopen::conv::ProblemDescription{in,
+                                            weights,
+                                            out,
+                                            conv,
+                                            miopen::conv::Direction::Forward,
+                                            0,
+                                            miopen::Scalar{1.0},
+                                            miopen::Scalar{beta}};
+}
+
+} // namespace
+
+TEST(CPU_ApplicabilityCache_NONE, Entry)
+{
+    miopen::ApplicabilityCache::Entry entry;
+    EXPECT_FALSE(entry.Get(3).has_value());
+
+    entry.Set(3, true);
+    entry.Set(130, false);
+    EXPECT_EQ(entry.Get(3), true);
+    EXPECT_EQ(entry.Get(130), false);
+    EXPECT_FALSE(entry.Get(4).has_value());
+
+    const auto parsed = miopen::ApplicabilityCache::Entry::FromString(entry.ToString());
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(parsed->checked, entry.checked);
+    EXPECT_EQ(parsed->applicable, entry.applicable);
+    EXPECT_FALSE(miopen::ApplicabilityCache::Entry::FromString("1,x 0").has_value());
+}
+
+TEST(CPU_ApplicabilityCache_NONE, SaveAndLoad)
+{
+    const miopen::TmpDir dir{"applicability_cache"};
+    const auto path = dir.path / "test.applicability.txt";
+
+    {
+        miopen::ApplicabilityCache cache;
+        cache.Open(path, "1.0 gfx900");
+        cache.Set("problem_a", 1, true);
+        cache.Set("problem_a", 70, false);
+    } // Saved by the destructor.
+
+    // Another process adds its results to the same file.
+    {
+        miopen::ApplicabilityCache cache;
+        cache.Open(path, "1.0 gfx900");
+        cache.Set("problem_b", 2, true);
+        cache.Save();
+    }
+
+    miopen::ApplicabilityCache cache;
+    cache.Open(path, "1.0 gfx900");
+    EXPECT_EQ(cache.Get("problem_a").Get(1), true);
+    EXPECT_EQ(cache.Get("problem_a").Get(70), false);
+    EXPECT_EQ(cache.Get("problem_b").Get(2), true);
+
+    // Results of another build or target are not used.
+    miopen::ApplicabilityCache other;
+    other.Open(path, "1.1 gfx900");
+    EXPECT_FALSE(other.Get("problem_a").Get(1).has_value());
+}
+
+TEST(CPU_ApplicabilityCache_NONE, Key)
+{
+    const auto ctx     = miopen::ExecutionContext{};
+    auto conv          = miopen::ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}};
+    const auto packed  = std::vector<std::size_t>{64 * 28 * 28, 28 * 28, 28, 1};
+    const auto padded  = std::vector<std::size_t>{64 * 28 * 32, 28 * 32, 32, 1};
+    const auto key     = miopen::GetApplicabilityKey(ctx, MakeProblem(conv, packed));
+
+    // The perf-db key is the same for all of these, the applicability may differ.
+    EXPECT_EQ(miopen::GetApplicabilityKey(ctx, MakeProblem(conv, packed)), key);
+    EXPECT_NE(miopen::GetApplicabilityKey(ctx, MakeProblem(conv, padded)), key);
+    EXPECT_NE(miopen::GetApplicabilityKey(ctx, MakeProblem(conv, packed, 1.0)), key);
+    conv.attribute.Set(MIOPEN_CONVOLUTION_ATTRIB_DETERMINISTIC, 1);
+    EXPECT_NE(miopen::GetApplicabilityKey(ctx, MakeProblem(conv, packed)), key);
+}
+
+TEST(CPU_ApplicabilityCache_NONE, EnvFingerprint)
+{
+    const auto fingerprint = miopen::GetApplicabilityEnvFingerprint();
+    EXPECT_EQ(miopen::GetApplicabilityEnvFingerprint(), fingerprint);
+
+    miopen::env::update(MIOPEN_DEBUG_APPLICABILITY_CACHE_TEST, true);
+    EXPECT_NE(miopen::GetApplicabilityEnvFingerprint(), fingerprint);
+    miopen::env::clear(MIOPEN_DEBUG_APPLICABILITY_CACHE_TEST);
+    EXPECT_EQ(miopen::GetApplicabilityEnvFingerprint(), fingerprint);
+}
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/execution_context.hpp>
+#include <miopen/find_controls.hpp>
+#include <miopen/find_solution.hpp>
+#include <miopen/problem_description_base.hpp>
+#include <miopen/solver.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct CheckProblem : miopen::ProblemDescriptionBase
+{
+    mutable std::vector<std::thread::id> checked_on;
+    mutable std::vector<std::string> checked;
+
+    auto MakeNetworkConfig() const -> miopen::NetworkConfig override
+    {
+        return miopen::NetworkConfig{"check"};
+    }
+};
+
+template <bool applicable>
+struct CheckSolver : miopen::solver::NonTunableSolverBase<miopen::ExecutionContext, CheckProblem>
+{
+    auto SolverDbId() const -> const std::string& override
+    {
+        return GetSolverDbId<CheckSolver<applicable>>();
+    }
+
+    auto IsApplicable(const miopen::ExecutionContext&, const CheckProblem& problem) const
+        -> bool override
+    {
+        problem.checked_on.push_back(std::this_thread::get_id());
+        problem.checked.push_back(SolverDbId());
+        return applicable;
+    }
+
+    auto GetSolution(const miopen::ExecutionContext&, const CheckProblem&) const
+        -> miopen::solver::ConvSolution override
+    {
+        return {};
+    }
+};
+
+} // namespace
+
+TEST(CPU_ApplicabilityChecks_NONE, SequentialByDefault)
+{
+    if(std::getenv("MIOPEN_APPLICABILITY_THREADS_MAX") != nullptr)
+        GTEST_SKIP() << "MIOPEN_APPLICABILITY_THREADS_MAX is set";
+
+    // The concurrent checks are opt-in, since not all the solvers are known to be thread-safe.
+    EXPECT_EQ(miopen::GetApplicabilityThreadsMax(), 1);
+
+    const auto ctx     = miopen::ExecutionContext{};
+    const auto problem = CheckProblem{};
+    const auto sizes   =
+        miopen::solver::SolverContainer<CheckSolver<false>, CheckSolver<true>, CheckSolver<true>>{}
+            .GetWorkspaceSizes(ctx, problem, true);
+
+    ASSERT_EQ(sizes.size(), 2);
+    ASSERT_EQ(problem.checked.size(), 3);
+    EXPECT_EQ(problem.checked[0], CheckSolver<false>{}.SolverDbId());
+    EXPECT_EQ(problem.checked[1], CheckSolver<true>{}.SolverDbId());
+    EXPECT_EQ(problem.checked[2], CheckSolver<true>{}.SolverDbId());
+    for(const auto& id : problem.checked_on)
+        EXPECT_EQ(id, std::this_thread::get_id());
+}
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <miopen/async_log_writer.hpp>
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(CPU_AsyncLogWriter_NONE, KeepsOrder)
+{
+    auto stream   = std::ostringstream{};
+    auto writer   = miopen::AsyncLogWriter{stream, 1024};
+    auto expected = std::string{};
+
+    for(auto i = 0; i < 100; ++i)
+    {
+        auto message = std::to_string(i) + "\n";
+        expected += message;
+        EXPECT_TRUE(writer.Write(message));
+    }
+
+    writer.Flush();
+    EXPECT_EQ(stream.str(), expected);
+    EXPECT_EQ(writer.GetDroppedCount(), std::size_t{0});
+}
+
+TEST(CPU_AsyncLogWriter_NONE, CountsDropped)
+{
+    constexpr auto n_threads  = 4;
+    constexpr auto n_messages = 10000;
+
+    auto stream = std::ostringstream{};
+    auto writer = miopen::AsyncLogWriter{stream, 2};
+
+    auto threads = std::vector<std::thread>{};
+    for(auto i = 0; i < n_threads; ++i)
+    {
+        threads.emplace_back([&]() {
+            for(auto j = 0; j < n_messages; ++j)
+            {
+                auto message = std::string{"message\n"};
+                writer.Write(message);
+            }
+        });
+    }
+    for(auto& thread : threads)
+        thread.join();
+    writer.Flush();
+
+    auto written = std::size_t{0};
+    auto line    = std::string{};
+    auto output  = std::istringstream{stream.str()};
+    while(std::getline(output, line))
+    {
+        if(line == "message")
+            ++written;
+    }
+    EXPECT_EQ(written + writer.GetDroppedCount(), std::size_t{n_threads * n_messages});
+}
+
+TEST(CPU_AsyncLogWriter_NONE, Stop)
+{
+    auto stream  = std::ostringstream{};
+    auto writer  = miopen::AsyncLogWriter{stream, 16};
+    auto message = std::string{"first\n"};
+
+    EXPECT_TRUE(writer.Write(message));
+    writer.Stop();
+    EXPECT_EQ(stream.str(), "first\n");
+
+    // The caller writes the message itself once the writer is stopped.
+    message = "second\n";
+    EXPECT_FALSE(writer.Write(message));
+    EXPECT_EQ(message, "second\n");
+    writer.Flush();
+}
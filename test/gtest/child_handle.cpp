@@ -0,0 +1,68 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <miopen/handle.hpp>
+#include <miopen/solver_id.hpp>
+
+#include <memory>
+
+TEST(GPU_ChildHandle_NONE, SharesCaches)
+{
+    const auto config = miopen::NetworkConfig{"child_handle"};
+    const auto solver = miopen::solver::Id{"ConvDirectNaiveConvFwd"};
+    auto parent       = std::make_unique<miopen::Handle>();
+    auto child        = std::make_unique<miopen::Handle>(*parent, parent->GetStream());
+
+    child->RegisterInvoker(
+        [](const miopen::Handle&, const miopen::AnyInvokeParams&) {}, config, solver.ToString());
+    EXPECT_TRUE(parent->GetInvoker(config, solver).has_value());
+    EXPECT_EQ(&parent->GetApplicabilityCache(), &child->GetApplicabilityCache());
+    EXPECT_EQ(&parent->GetExecutionPlanCache(), &child->GetExecutionPlanCache());
+    EXPECT_EQ(parent->GetDeviceName(), child->GetDeviceName());
+
+    // The shared caches outlive the parent.
+    parent.reset();
+    EXPECT_TRUE(child->GetInvoker(config, solver).has_value());
+
+    const auto other = miopen::Handle{};
+    EXPECT_FALSE(other.GetInvoker(config, solver).has_value());
+}
+
+TEST(GPU_ChildHandle_NONE, CApi)
+{
+    miopenHandle_t parent = nullptr;
+    miopenHandle_t child  = nullptr;
+    ASSERT_EQ(miopenCreate(&parent), miopenStatusSuccess);
+
+    miopenAcceleratorQueue_t stream = nullptr;
+    ASSERT_EQ(miopenGetStream(parent, &stream), miopenStatusSuccess);
+    EXPECT_EQ(miopenCreateChildHandle(&child, nullptr, stream), miopenStatusBadParm);
+    ASSERT_EQ(miopenCreateChildHandle(&child, parent, stream), miopenStatusSuccess);
+
+    EXPECT_EQ(miopenDestroy(parent), miopenStatusSuccess);
+    EXPECT_EQ(miopenDestroy(child), miopenStatusSuccess);
+}
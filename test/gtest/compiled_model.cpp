@@ -0,0 +1,188 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <miopen/config.h>
+#include <miopen/db_path.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK || MIOPEN_ENABLE_AI_KERNEL_TUNING
+#include <miopen/conv/heuristics/compiled_model.hpp>
+#include <miopen/stringutils.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#if MIOPEN_ENABLE_AI_KERNEL_TUNING
+#include <fdeep/fdeep.hpp>
+#endif
+
+namespace {
+
+std::vector<miopen::fs::path> GetModelFiles()
+{
+    auto files = std::vector<miopen::fs::path>{};
+    if(!miopen::fs::exists(miopen::GetSystemDbPath()))
+        return files;
+    for(const auto& entry : miopen::fs::directory_iterator(miopen::GetSystemDbPath()))
+    {
+        const auto name = entry.path().filename().string();
+        if(name.find("_metadata.") != std::string::npos)
+            continue;
+        if(miopen::EndsWith(name, ".tn.model") || miopen::EndsWith(name, "coder.ktn.model"))
+            files.push_back(entry.path());
+    }
+    return files;
+}
+
+miopen::ai::CompiledModel::Tensors MakeInputs(const miopen::ai::CompiledModel& model,
+                                              unsigned seed = std::mt19937::default_seed)
+{
+    // Values below 1 are valid inputs for the embeddings too.
+    auto gen    = std::mt19937{seed};
+    auto dist   = std::uniform_real_distribution<float>{0.0f, 1.0f};
+    auto inputs = miopen::ai::CompiledModel::Tensors{};
+    for(const auto& shape : model.GetInputShapes())
+    {
+        auto size = std::size_t{1};
+        for(const auto dim : shape)
+            size *= dim;
+        auto& input = inputs.emplace_back(size);
+        for(auto& value : input)
+            value = dist(gen);
+    }
+    return inputs;
+}
+
+#if MIOPEN_ENABLE_AI_KERNEL_TUNING
+std::vector<std::vector<float>> PredictFdeep(const miopen::fs::path& path,
+                                             const miopen::ai::CompiledModel& model,
+                                             const miopen::ai::CompiledModel::Tensors& inputs)
+{
+    const auto fdeep_model = fdeep::load_model(path.string(), false, fdeep::dev_null_logger);
+    auto fdeep_inputs      = fdeep::tensors{};
+    for(std::size_t i = 0; i < inputs.size(); ++i)
+    {
+        const auto& shape      = model.GetInputShapes()[i];
+        const auto fdeep_shape = shape.size() == 1 ? fdeep::tensor_shape(shape[0])
+                                                   : fdeep::tensor_shape(shape[0], shape[1]);
+        fdeep_inputs.emplace_back(fdeep_shape, inputs[i]);
+    }
+    auto outputs = std::vector<std::vector<float>>{};
+    for(const auto& output : fdeep_model.predict(fdeep_inputs))
+        outputs.push_back(output.to_vector());
+    return outputs;
+}
+#endif
+
+} // namespace
+
+TEST(CPU_CompiledModel_NONE, MatchesReference)
+{
+    const auto files = GetModelFiles();
+    if(files.empty())
+        GTEST_SKIP();
+
+    const miopen::TmpDir dir{"compiled_model"};
+    for(const auto& file : files)
+    {
+        SCOPED_TRACE(file.string());
+        const auto model = miopen::ai::CompiledModel::FromJsonFile(file);
+        EXPECT_LE(model.MaxTestError(), 1e-4f);
+
+        const auto inputs  = MakeInputs(model);
+        const auto outputs = model.Predict(inputs);
+        model.SaveBinary(dir.path / "model.bin");
+        EXPECT_EQ(miopen::ai::CompiledModel::FromBinaryFile(dir.path / "model.bin").Predict(inputs),
+                  outputs);
+
+#if MIOPEN_ENABLE_AI_KERNEL_TUNING
+        const auto expected = PredictFdeep(file, model, inputs);
+        ASSERT_EQ(outputs.size(), expected.size());
+        for(std::size_t i = 0; i < outputs.size(); ++i)
+        {
+            ASSERT_EQ(outputs[i].size(), expected[i].size());
+            for(std::size_t j = 0; j < outputs[i].size(); ++j)
+            {
+                const auto tolerance = 1e-4f * std::max(1.0f, std::abs(expected[i][j]));
+                EXPECT_NEAR(outputs[i][j], expected[i][j], tolerance);
+            }
+        }
+#endif
+    }
+}
+
+TEST(CPU_CompiledModel_NONE, PredictBatchMatchesPredict)
+{
+    const auto files = GetModelFiles();
+    if(files.empty())
+        GTEST_SKIP();
+
+    for(const auto& file : files)
+    {
+        SCOPED_TRACE(file.string());
+        const auto model = miopen::ai::CompiledModel::Load(file);
+
+        // An odd batch size covers both the full row tiles and the remainder rows.
+        auto batch = std::vector<miopen::ai::CompiledModel::Tensors>{};
+        for(unsigned seed = 1; seed <= 7; ++seed)
+            batch.push_back(MakeInputs(model, seed));
+        const auto outputs = model.PredictBatch(batch);
+        ASSERT_EQ(outputs.size(), batch.size());
+
+        for(std::size_t b = 0; b < batch.size(); ++b)
+        {
+            const auto expected = model.Predict(batch[b]);
+            ASSERT_EQ(outputs[b].size(), expected.size());
+            for(std::size_t i = 0; i < expected.size(); ++i)
+            {
+                ASSERT_EQ(outputs[b][i].size(), expected[i].size());
+                for(std::size_t j = 0; j < expected[i].size(); ++j)
+                {
+                    // The batched pass sums in a different order.
+                    const auto tolerance = 1e-3f * std::max(1.0f, std::abs(expected[i][j]));
+                    EXPECT_NEAR(outputs[b][i][j], expected[i][j], tolerance);
+                }
+            }
+        }
+    }
+}
+
+TEST(CPU_CompiledModel_NONE, RejectsInvalidBinary)
+{
+    const miopen::TmpDir dir{"compiled_model"};
+    const auto path = dir.path / "model.bin";
+    {
+        std::ofstream file{path, std::ios::binary};
+        file << "MIOPENAI garbage";
+    }
+    EXPECT_ANY_THROW(miopen::ai::CompiledModel::FromBinaryFile(path));
+}
+#endif
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <gtest/gtest.h>
+#include <miopen/generic_search.hpp>
+#include <miopen/sequences.hpp>
+
+#include <random>
+#include <set>
+
+namespace {
+
+struct TestConfig
+{
+    int x = -1;
+    int y = -1;
+};
+
+auto TestRules()
+{
+    return miopen::seq::MakeRuleSet(
+        std::make_tuple(miopen::seq::Span<int, 0, 99>{}, &TestConfig::x),
+        std::make_tuple(miopen::seq::TwoPowersSpan<int, 1, 64>{}, &TestConfig::y));
+}
+
+bool IsTestConfigValid(const TestConfig& config) { return (config.x + config.y) % 3 == 0; }
+
+template <class TSequence>
+void CheckSeqNth(const TSequence& seq)
+{
+    std::size_t n = 0;
+    for(auto it = seq.begin(); it != seq.end(); ++it, ++n)
+        EXPECT_EQ(miopen::seq::SeqNth(seq, n), *it);
+    EXPECT_EQ(miopen::seq::SeqSize(seq), n);
+}
+
+} // namespace
+
+TEST(CPU_TuningConfigSpace_NONE, Decode)
+{
+    const auto space = miopen::solver::MakeConfigSpace<TestConfig>(TestRules());
+    ASSERT_EQ(space.size(), std::size_t{100 * 7});
+
+    TestConfig next;
+    TestRules().FillBegin(next);
+    for(std::size_t i = 0; i < space.size(); ++i)
+    {
+        const auto nth = space.nth(i);
+        EXPECT_EQ(nth.x, next.x);
+        EXPECT_EQ(nth.y, next.y);
+        TestRules().Next(next);
+    }
+}
+
+TEST(CPU_TuningConfigSpace_NONE, SeqNth)
+{
+    using namespace miopen::seq;
+    CheckSeqNth(Sequence<int, 3, 1, 7>{});
+    CheckSeqNth(Span<int, -2, 5>{});
+    CheckSeqNth(TwoPowersSpan<int, 4, 256>{});
+    CheckSeqNth(Multiplied<Span<int, 1, 8>, 4>{});
+    using Parts = Join<Sequence<int, 1>, Multiplied<Span<int, 1, 8>, 4>, Sequence<int, 64, 128>>;
+    CheckSeqNth(Parts{});
+}
+
+TEST(CPU_TuningConfigSpace_NONE, Shard)
+{
+    const auto space    = miopen::solver::MakeConfigSpace<TestConfig>(TestRules());
+    const auto n_shards = 3;
+
+    std::size_t total = 0;
+    for(auto shard_idx = 0; shard_idx < n_shards; ++shard_idx)
+    {
+        const auto shard = space.Shard(shard_idx, n_shards);
+        const auto first = shard.nth(0);
+        const auto ref   = space.nth(total);
+        EXPECT_EQ(first.x, ref.x);
+        EXPECT_EQ(first.y, ref.y);
+        total += shard.size();
+    }
+    EXPECT_EQ(total, space.size());
+}
+
+TEST(CPU_TuningConfigSpace_NONE, Sample)
+{
+    const auto space = miopen::solver::MakeConfigSpace<TestConfig>(TestRules());
+    std::default_random_engine rng{42};
+
+    const auto all = miopen::solver::SampleConfigSpace(space, space.size(), IsTestConfigValid, rng);
+    std::size_t n_valid = 0;
+    for(std::size_t i = 0; i < space.size(); ++i)
+        n_valid += IsTestConfigValid(space.nth(i)) ? 1 : 0;
+    EXPECT_EQ(all.size(), n_valid);
+
+    const std::size_t n_samples = 50;
+    const auto sample = miopen::solver::SampleConfigSpace(space, n_samples, IsTestConfigValid, rng);
+    EXPECT_EQ(sample.size(), n_samples);
+    EXPECT_EQ(std::set<std::size_t>(sample.begin(), sample.end()).size(), n_samples);
+    for(const auto i : sample)
+        EXPECT_TRUE(IsTestConfigValid(space.nth(i)));
+
+    // Each stratum provides exactly one sample.
+    std::vector<int> strata(n_samples);
+    for(const auto i : sample)
+        ++strata[i * n_samples / space.size()];
+    for(const auto count : strata)
+        EXPECT_EQ(count, 1);
+}
@@ -0,0 +1,176 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <miopen/conv/heuristics/decision_table.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <sstream>
+
+namespace {
+
+constexpr auto db_key = "64-56-56-3x3-64-56-56-32-1x1-1x1-1x1-0-NCHW-FP16-F_g64";
+
+miopen::conv::ProblemDescription MakeProblem(miopenTensorLayout_t layout,
+                                             const std::vector<std::size_t>& in_lengths,
+                                             const std::vector<std::size_t>& weights_lengths,
+                                             const std::vector<int>& pads,
+                                             int groups,
+                                             miopen::conv::Direction direction)
+{
+    const auto spatial_dims = in_lengths.size() - 2;
+    const auto conv         = miopen::ConvolutionDescriptor{spatial_dims,
+                                                            miopenConvolution,
+                                                            miopenPaddingDefault,
+                                                            pads,
+                                                            std::vector<int>(spatial_dims, 1),
+                                                            std::vector<int>(spatial_dims, 1),
+                                                            std::vector<int>(spatial_dims, 0),
+                                                            groups};
+    const auto in           = miopen::TensorDescriptor{miopenHalf, layout, in_lengths};
+    const auto weights      = miopen::TensorDescriptor{miopenHalf, layout, weights_lengths};
+    const auto out          = conv.GetForwardOutputTensor(in, weights, miopenHalf);
+    return direction == miopen::conv::Direction::Forward
+               ? miopen::conv::ProblemDescription{in, weights, out, conv, direction}
+               : miopen::conv::ProblemDescription{out, weights, in, conv, direction};
+}
+
+// The problem of db_key.
+miopen::conv::ProblemDescription MakeDepthwiseProblem()
+{
+    return MakeProblem(miopenTensorNCHW,
+                       {32, 64, 56, 56},
+                       {64, 1, 3, 3},
+                       {1, 1},
+                       64,
+                       miopen::conv::Direction::Forward);
+}
+
+} // namespace
+
+TEST(CPU_DecisionTable_NONE, Key)
+{
+    const auto fields = miopen::conv::DbKeyFields::Parse(db_key);
+    ASSERT_TRUE(fields.has_value());
+    EXPECT_EQ(fields->in_channels, 64);
+    EXPECT_EQ(fields->batch_size, 32);
+    EXPECT_EQ(fields->filter, (std::vector<std::size_t>{3, 3}));
+    EXPECT_EQ(fields->direction, "F");
+    EXPECT_EQ(fields->group_count, 64);
+
+    EXPECT_EQ(miopen::conv::DecisionTable::MakeKey(*fields),
+              "F-FP16-NCHW-2d-c6-k6-n5-s5x5-f3x3-u1x1-p1-l0-gdw");
+    // Problems of the same class and similar sizes share the entry.
+    EXPECT_EQ(miopen::conv::DecisionTable::MakeKey(
+                  "64-60-60-3x3-64-60-60-40-1x1-1x1-1x1-0-NCHW-FP16-F_g64"),
+              miopen::conv::DecisionTable::MakeKey(*fields));
+    EXPECT_FALSE(miopen::conv::DecisionTable::MakeKey("64-56-56").has_value());
+}
+
+TEST(CPU_DecisionTable_NONE, BuildSaveAndLoad)
+{
+    const auto naive  = miopen::solver::Id{"ConvDirectNaiveConvFwd"};
+    const auto direct = miopen::solver::Id{"ConvOclDirectFwd"};
+    ASSERT_TRUE(naive.IsValid() && direct.IsValid());
+
+    miopen::conv::DecisionTableBuilder builder;
+    ASSERT_TRUE(builder.Add(db_key, {{naive, 2.0f}, {direct, 1.0f}}));
+    ASSERT_TRUE(builder.Add("64-60-60-3x3-64-60-60-40-1x1-1x1-1x1-0-NCHW-FP16-F_g64",
+                            {{naive, 3.0f}, {direct, 1.0f}}));
+    EXPECT_FALSE(builder.Add("invalid", {{naive, 1.0f}}));
+
+    const auto table = builder.Build();
+    const auto key   = *miopen::conv::DecisionTable::MakeKey(db_key);
+    ASSERT_NE(table.Find(key), nullptr);
+    EXPECT_EQ(*table.Find(key), (std::vector<miopen::solver::Id>{direct, naive}));
+
+    const miopen::TmpDir dir{"decision_table"};
+    const auto path = dir.path / "test.dtable.txt";
+    table.Save(path);
+
+    miopen::conv::DecisionTable loaded;
+    ASSERT_TRUE(loaded.Load(path));
+    EXPECT_EQ(loaded.Size(), table.Size());
+    ASSERT_NE(loaded.Find(key), nullptr);
+    EXPECT_EQ(*loaded.Find(key), *table.Find(key));
+    EXPECT_EQ(loaded.Find("F-FP32-NCHW-2d"), nullptr);
+}
+
+TEST(CPU_DecisionTable_NONE, FromProblem)
+{
+    using miopen::conv::Direction;
+    const auto problems = std::vector<miopen::conv::ProblemDescription>{
+        MakeDepthwiseProblem(),
+        MakeProblem(
+            miopenTensorNHWC, {8, 16, 28, 28}, {32, 16, 1, 1}, {0, 0}, 1, Direction::BackwardData),
+        MakeProblem(miopenTensorNCDHW,
+                    {2, 8, 9, 10, 11},
+                    {4, 8, 3, 3, 3},
+                    {1, 0, 1},
+                    1,
+                    Direction::BackwardWeights),
+    };
+
+    for(const auto& problem : problems)
+    {
+        std::ostringstream ss;
+        problem.Serialize(ss);
+        const auto parsed = miopen::conv::DbKeyFields::Parse(ss.str());
+        const auto fields = miopen::conv::DbKeyFields::FromProblem(problem);
+        ASSERT_TRUE(parsed.has_value()) << ss.str();
+        ASSERT_TRUE(fields.has_value()) << ss.str();
+        EXPECT_EQ(miopen::conv::DecisionTable::MakeKey(*fields),
+                  miopen::conv::DecisionTable::MakeKey(*parsed))
+            << ss.str();
+    }
+}
+
+TEST(CPU_DecisionTable_NONE, Cache)
+{
+    using miopen::conv::Direction;
+    const auto problem = MakeDepthwiseProblem();
+    const auto other   = MakeProblem(
+        miopenTensorNCHW, {32, 64, 56, 56}, {64, 64, 1, 1}, {0, 0}, 1, Direction::Forward);
+    const auto naive   = miopen::solver::Id{"ConvDirectNaiveConvFwd"};
+    const auto key     = *miopen::conv::DecisionTable::MakeKey(db_key);
+
+    auto table = std::make_shared<miopen::conv::DecisionTable>();
+    table->Set(key, {naive});
+    miopen::conv::DecisionTableCache cache{table};
+    ASSERT_TRUE(cache.HasTable());
+
+    // The second queries are answered from the memoized results.
+    for(auto i = 0; i < 2; ++i)
+    {
+        EXPECT_EQ(cache.Find(problem), (std::vector<miopen::solver::Id>{naive}));
+        EXPECT_FALSE(cache.Find(other).has_value());
+    }
+
+    miopen::conv::DecisionTableCache empty{nullptr};
+    EXPECT_FALSE(empty.HasTable());
+    EXPECT_FALSE(empty.Find(problem).has_value());
+}
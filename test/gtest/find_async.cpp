@@ -0,0 +1,138 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <miopen/convolution.hpp>
+#include <miopen/find_async.hpp>
+#include <miopen/find_monitor.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/mlo_internal.hpp>
+#include <miopen/problem.hpp>
+
+#include <atomic>
+#include <memory>
+
+namespace {
+
+miopen::Problem MakeConv(std::size_t c, std::size_t h, std::size_t w)
+{
+    auto problem = miopen::Problem{};
+    problem.SetDirection(miopenProblemDirectionForward);
+    problem.SetOperatorDescriptor(miopen::ConvolutionDescriptor{{1, 1}});
+    const auto x_lengths = std::vector<std::size_t>{1, c, h, w};
+    const auto w_lengths = std::vector<std::size_t>{c, c, 3, 3};
+    problem.RegisterTensorDescriptor(miopenTensorConvolutionX,
+                                     miopen::TensorDescriptor{miopenFloat, x_lengths});
+    problem.RegisterTensorDescriptor(miopenTensorConvolutionW,
+                                     miopen::TensorDescriptor{miopenFloat, w_lengths});
+    problem.RegisterTensorDescriptor(miopenTensorConvolutionY,
+                                     miopen::TensorDescriptor{miopenFloat, x_lengths});
+    return problem;
+}
+
+miopen::ProblemContainer MakeConvProblem() { return miopen::ProblemContainer{MakeConv(8, 16, 16)}; }
+
+} // namespace
+
+TEST(CPU_FindMonitor_NONE, ReportAndCancel)
+{
+    auto reports = std::size_t{0};
+    auto monitor = miopen::FindMonitor{[&](std::size_t done, std::size_t total, float best) {
+        ++reports;
+        EXPECT_EQ(done, std::size_t{1});
+        EXPECT_EQ(total, std::size_t{2});
+        EXPECT_EQ(best, 0.5f);
+    }};
+
+    monitor.Report(1, 2, 0.5f);
+    EXPECT_EQ(reports, std::size_t{1});
+    EXPECT_FALSE(monitor.IsCancelled());
+    monitor.Cancel();
+    EXPECT_TRUE(monitor.IsCancelled());
+
+    // No callback is fine.
+    miopen::FindMonitor{}.Report(1, 2, 0.5f);
+}
+
+TEST(GPU_FindAsync_NONE, Conv)
+{
+    auto handle  = miopen::Handle{};
+    auto options = miopen::FindOptions{};
+    auto calls   = std::make_shared<std::atomic<std::size_t>>(0);
+
+    options.monitor = std::make_shared<miopen::FindMonitor>(
+        [calls](std::size_t done, std::size_t total, float) {
+            ++*calls;
+            EXPECT_LE(done, total);
+        });
+
+    auto future = miopen::FindFuture{handle, MakeConvProblem(), options, 4};
+    future.Wait();
+    EXPECT_TRUE(future.IsReady());
+
+    const auto solutions = future.Get();
+    EXPECT_FALSE(solutions.empty());
+    EXPECT_LE(solutions.size(), std::size_t{4});
+    for(const auto& solution : solutions)
+        EXPECT_FALSE(solution.IsPartial());
+    EXPECT_ANY_THROW(future.Get());
+
+    // The future uses its own monitor, so it can be cancelled independently.
+    EXPECT_FALSE(options.monitor->IsCancelled());
+}
+
+TEST(GPU_FindAsync_NONE, Cancel)
+{
+    auto handle = miopen::Handle{};
+    auto first  = miopen::FindFuture{handle, MakeConvProblem(), {}, 4};
+    auto second = miopen::FindFuture{handle, MakeConvProblem(), {}, 4};
+
+    // The second find waits for the first one, so it usually is cancelled before it starts.
+    second.Cancel();
+    EXPECT_NO_THROW(first.Get());
+    EXPECT_NO_THROW(second.Get());
+}
+
+TEST(GPU_FindAsync_NONE, CancelledTuningIsNotStored)
+{
+    auto handle = miopen::Handle{};
+    // An unusual shape, so that no other test tunes it.
+    const auto problem = MakeConv(7, 13, 11);
+
+    auto options              = miopen::FindOptions{};
+    options.exhaustive_search = true;
+    options.monitor           = std::make_shared<miopen::FindMonitor>();
+    options.monitor->Cancel();
+
+    auto solutions = std::vector<miopen::Solution>{};
+    EXPECT_NO_THROW(solutions = problem.FindSolutions(handle, options, 4));
+    for(const auto& solution : solutions)
+        EXPECT_TRUE(solution.IsPartial());
+
+    const auto ctx          = miopen::ExecutionContext{&handle};
+    const auto conv_problem = problem.AsConvolution();
+    EXPECT_FALSE(miopen::GetDb(ctx).FindRecord(conv_problem));
+}
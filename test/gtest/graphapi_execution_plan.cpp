@@ -63,6 +63,36 @@ TEST(CPU_GraphApi_NONE, ExecutionPlanBuilder)
         << "ExecutionPlanBuilder failed on missing setEngineCfg() call";
 }
 
+TEST(CPU_GraphApi_NONE, ExecutionPlanJson)
+{
+    miopenHandle_t handle;
+    auto status = miopenCreate(&handle);
+    ASSERT_EQ(status, miopenStatusSuccess) << "miopenCreate() failed";
+
+    auto plan = ExecutionPlanBuilder().setHandle(handle).setEngineCfg(EngineCfg{}).build();
+    EXPECT_ANY_THROW({ std::ignore = plan.getJsonRepresentation(); })
+        << "ExecutionPlan serialized a plan without an engine";
+
+    EXPECT_ANY_THROW({
+        ExecutionPlanBuilder().setHandle(handle).setJsonRepresentation("{").build();
+    }) << "ExecutionPlanBuilder accepted invalid json";
+
+    EXPECT_ANY_THROW({
+        ExecutionPlanBuilder()
+            .setHandle(handle)
+            .setJsonRepresentation(R"({"header": {"validation": 1, "version": 1}})")
+            .build();
+    }) << "ExecutionPlanBuilder accepted json without the execution plan header";
+
+    EXPECT_ANY_THROW({
+        ExecutionPlanBuilder()
+            .setHandle(handle)
+            .setJsonRepresentation(R"({"header": {"validation": 5569069620399064400, "version": 1,
+                                                  "miopen": "0.0.0.0", "target": ""}})")
+            .build();
+    }) << "ExecutionPlanBuilder accepted a plan serialized by another version";
+}
+
 namespace {
 
 class MockBackendEngineCfgDescriptor : public miopen::graphapi::BackendEngineCfgDescriptor
@@ -0,0 +1,89 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/graphapi/engine.hpp>
+#include <miopen/graphapi/execution_plan_cache.hpp>
+#include <miopen/graphapi/util.hpp>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+namespace gr = miopen::graphapi;
+
+gr::ExecutionPlanCache::Executors makeExecutors(size_t count)
+{
+    return gr::ExecutionPlanCache::Executors(count);
+}
+
+} // namespace
+
+TEST(CPU_GraphApiExecutionPlanCache_NONE, CanonicalKey)
+{
+    auto chain = gr::PatternGraphGenerator::Make(
+        {{"top", {"t_in"}, {"t_a"}}, {"mid", {"t_a"}, {"t_b"}}, {"bottom", {"t_b"}, {"t_out"}}});
+    auto reordered = gr::PatternGraphGenerator::Make(
+        {{"bottom", {"t_b"}, {"t_out"}}, {"top", {"t_in"}, {"t_a"}}, {"mid", {"t_a"}, {"t_b"}}});
+    // same structure with another id of the intermediate tensor
+    auto renamed = gr::PatternGraphGenerator::Make(
+        {{"top", {"t_in"}, {"t_c"}}, {"mid", {"t_c"}, {"t_b"}}, {"bottom", {"t_b"}, {"t_out"}}});
+    // same tensors with the middle nodes swapped
+    auto swapped = gr::PatternGraphGenerator::Make(
+        {{"mid", {"t_in"}, {"t_a"}}, {"top", {"t_a"}, {"t_b"}}, {"bottom", {"t_b"}, {"t_out"}}});
+
+    const auto key = chain->graph().getCanonicalKey();
+    EXPECT_EQ(key, reordered->graph().getCanonicalKey());
+    EXPECT_NE(key, renamed->graph().getCanonicalKey());
+    EXPECT_NE(key, swapped->graph().getCanonicalKey());
+}
+
+TEST(CPU_GraphApiExecutionPlanCache_NONE, Eviction)
+{
+    gr::ExecutionPlanCache cache(2);
+
+    EXPECT_FALSE(cache.get("a"));
+    cache.set("a", makeExecutors(1));
+    cache.set("b", makeExecutors(2));
+    ASSERT_TRUE(cache.get("a"));
+    EXPECT_EQ(cache.get("a")->size(), 1);
+
+    // "b" is the least recently used one
+    cache.set("c", makeExecutors(3));
+    EXPECT_FALSE(cache.get("b"));
+    EXPECT_TRUE(cache.get("a"));
+    EXPECT_TRUE(cache.get("c"));
+
+    auto stats = cache.getStats();
+    EXPECT_EQ(stats.hits, 4);
+    EXPECT_EQ(stats.misses, 2);
+    EXPECT_EQ(stats.evictions, 1);
+    EXPECT_EQ(stats.size, 2);
+
+    gr::ExecutionPlanCache disabled(0);
+    disabled.set("a", makeExecutors(1));
+    EXPECT_FALSE(disabled.get("a"));
+    EXPECT_EQ(disabled.getStats().size, 0);
+}
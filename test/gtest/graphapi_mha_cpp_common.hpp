@@ -128,6 +128,8 @@ protected:
     float mAttentionScale = 1.0f;
     float mProbDropout    = 0.0f;
     double mErrorThresh   = 5e-5;
+    // run the plan restored from its json representation
+    bool mRestorePlan = false;
 
     virtual void createMhaGraph(size_t n, size_t h, size_t s, size_t d) = 0;
     virtual void initInputs(size_t n, size_t h, size_t s, size_t d)     = 0;
@@ -324,6 +326,37 @@ protected:
             .build();
     }
 
+    gr::ExecutionPlan restorePlan(const gr::ExecutionPlan& plan)
+    {
+        auto h          = plan.getHandle();
+        const auto json = plan.getJsonRepresentation();
+
+        // Without the op graph the plan keeps the serialized key
+        auto restored = gr::ExecutionPlanBuilder().setHandle(h).setJsonRepresentation(json).build();
+        EXPECT_FALSE(restored.hasOpGraph());
+        EXPECT_EQ(nlohmann::json::parse(restored.getJsonRepresentation())["graph"],
+                  nlohmann::json::parse(json)["graph"]);
+
+        // A graph with another key is rejected
+        auto other     = nlohmann::json::parse(json);
+        other["graph"] = "another graph";
+        EXPECT_ANY_THROW({
+            std::ignore = gr::ExecutionPlanBuilder()
+                              .setHandle(h)
+                              .setJsonRepresentation(other.dump())
+                              .setOpGraph(&mGraph)
+                              .build();
+        });
+
+        restored = gr::ExecutionPlanBuilder()
+                       .setHandle(h)
+                       .setJsonRepresentation(json)
+                       .setOpGraph(&mGraph)
+                       .build();
+        EXPECT_TRUE(restored.hasOpGraph());
+        return restored;
+    }
+
     /// \todo remove virtual once backward mha is ready to execute
     virtual void executeMhaGraph()
     {
@@ -339,6 +372,10 @@ protected:
 
         auto h    = static_cast<miopenHandle_t>(&handle);
         auto plan = gr::ExecutionPlanBuilder().setEngineCfg(engine_cfg).setHandle(h).build();
+        if(mRestorePlan)
+        {
+            plan = restorePlan(plan);
+        }
 
         Workspace ws(plan.getWorkspaceSize());
 
@@ -203,6 +203,12 @@ using namespace mha_graph_test;
 
 TEST_P(GPU_MhaFwdGraph_FP32, MhaFwdGraph) { Run(MhaDir::Fwd); }
 
+TEST_P(GPU_MhaFwdGraph_FP32, MhaFwdGraphRestoredPlan)
+{
+    mRestorePlan = true;
+    Run(MhaDir::Fwd);
+}
+
 INSTANTIATE_TEST_SUITE_P(Unit,
                          GPU_MhaFwdGraph_FP32,
                          testing::Combine(testing::ValuesIn(std::vector<std::size_t>{2}),     // n
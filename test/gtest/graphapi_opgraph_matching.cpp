@@ -25,6 +25,152 @@
  *******************************************************************************/
 #include "graphapi_opgraph_common.hpp"
 
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+namespace gr = miopen::graphapi;
+
+using NodeSpecs = std::vector<gr::PatternGraphGenerator::DummyNodeGenSpec>;
+
+/// Random DAG: every node reads one to three distinct tensors, either produced by an earlier
+/// node or fresh graph inputs, and writes one or two tensors. Few names make collisions likely.
+NodeSpecs makeRandomSpecs(std::mt19937& gen, size_t num_nodes)
+{
+    const std::vector<std::string> names{"a", "b", "c"};
+    std::vector<std::string> produced;
+    NodeSpecs specs;
+    size_t num_tensors = 0;
+
+    for(size_t i = 0; i < num_nodes; ++i)
+    {
+        gr::PatternGraphGenerator::DummyNodeGenSpec spec;
+        spec.mName = names[std::uniform_int_distribution<size_t>{0, names.size() - 1}(gen)];
+
+        const auto num_ins = std::uniform_int_distribution<size_t>{1, 3}(gen);
+        for(size_t k = 0; k < num_ins; ++k)
+        {
+            std::string t;
+            if(produced.empty() || std::bernoulli_distribution{0.3}(gen))
+            {
+                t = "t" + std::to_string(num_tensors++);
+            }
+            else
+            {
+                t = produced[std::uniform_int_distribution<size_t>{0, produced.size() - 1}(gen)];
+            }
+            if(std::find(spec.mInTensors.begin(), spec.mInTensors.end(), t) ==
+               spec.mInTensors.end())
+            {
+                spec.mInTensors.emplace_back(t);
+            }
+        }
+
+        const auto num_outs = std::uniform_int_distribution<size_t>{1, 2}(gen);
+        for(size_t k = 0; k < num_outs; ++k)
+        {
+            spec.mOutTensors.emplace_back("t" + std::to_string(num_tensors++));
+            produced.emplace_back(spec.mOutTensors.back());
+        }
+        specs.emplace_back(std::move(spec));
+    }
+    return specs;
+}
+
+/// The same graph with the nodes, their inputs and the tensor names shuffled.
+NodeSpecs permute(std::mt19937& gen, NodeSpecs specs)
+{
+    std::shuffle(specs.begin(), specs.end(), gen);
+    for(auto& spec : specs)
+    {
+        std::shuffle(spec.mInTensors.begin(), spec.mInTensors.end(), gen);
+        for(auto* tensors : {&spec.mInTensors, &spec.mOutTensors})
+        {
+            for(auto& t : *tensors)
+            {
+                t = "p" + t;
+            }
+        }
+    }
+    return specs;
+}
+
+/// Reference check that tries every mapping of the nodes with equal names.
+bool bruteForceIsomorphic(const NodeSpecs& left, const NodeSpecs& right)
+{
+    if(left.size() != right.size())
+    {
+        return false;
+    }
+
+    // edges[i][j] between the nodes, index n is the source and the sink
+    const auto adjacency = [](const NodeSpecs& specs) {
+        const size_t n = specs.size();
+        std::vector<std::vector<size_t>> edges(n + 1, std::vector<size_t>(n + 1, 0));
+        for(size_t j = 0; j < n; ++j)
+        {
+            for(const auto& t : specs[j].mInTensors)
+            {
+                size_t src = n;
+                for(size_t i = 0; i < n; ++i)
+                {
+                    if(gr::internal::contains(specs[i].mOutTensors, t))
+                    {
+                        src = i;
+                    }
+                }
+                ++edges[src][j];
+            }
+        }
+        for(size_t i = 0; i < n; ++i)
+        {
+            for(const auto& t : specs[i].mOutTensors)
+            {
+                const auto consumed = std::any_of(specs.begin(), specs.end(), [&](auto& spec) {
+                    return gr::internal::contains(spec.mInTensors, t);
+                });
+                if(!consumed)
+                {
+                    ++edges[i][n];
+                }
+            }
+        }
+        return edges;
+    };
+
+    const auto l_edges = adjacency(left);
+    const auto r_edges = adjacency(right);
+    const size_t n     = left.size();
+
+    std::vector<size_t> perm(n);
+    std::iota(perm.begin(), perm.end(), 0);
+    do
+    {
+        bool same = true;
+        for(size_t i = 0; same && i <= n; ++i)
+        {
+            const size_t pi = i == n ? n : perm[i];
+            same            = i == n || left[i].mName == right[pi].mName;
+            for(size_t j = 0; same && j <= n; ++j)
+            {
+                const size_t pj = j == n ? n : perm[j];
+                same            = l_edges[i][j] == r_edges[pi][pj];
+            }
+        }
+        if(same)
+        {
+            return true;
+        }
+    } while(std::next_permutation(perm.begin(), perm.end()));
+    return false;
+}
+
+} // namespace
+
 TEST(CPU_GraphMatchingAPI_NONE, DiamondGraphMatch)
 {
     using namespace graphapi_opgraph_tests;
@@ -68,3 +214,34 @@ TEST(CPU_GraphMatchingAPI_NONE, DiamondGraphMatch)
         ASSERT_FALSE(gr::isIsomorphic(dg1->graph(), dg5->graph()));
     }
 }
+
+TEST(CPU_GraphMatchingAPI_NONE, RandomGraphMatch)
+{
+    std::mt19937 gen{2024};
+    for(size_t trial = 0; trial < 200; ++trial)
+    {
+        const size_t num_nodes = std::uniform_int_distribution<size_t>{1, 6}(gen);
+        const auto specs       = makeRandomSpecs(gen, num_nodes);
+        const auto graph       = gr::PatternGraphGenerator::Make(specs);
+
+        // permuted copies are isomorphic and have the same fingerprint
+        const auto permuted = gr::PatternGraphGenerator::Make(permute(gen, specs));
+        ASSERT_EQ(graph->graph().getFingerprint(), permuted->graph().getFingerprint());
+        ASSERT_TRUE(gr::isIsomorphic(graph->graph(), permuted->graph()));
+
+        // rewiring one input to the output of an earlier node keeps the names, the result
+        // may or may not be isomorphic and must agree with the reference check
+        auto rewired_specs = specs;
+        const size_t j     = std::uniform_int_distribution<size_t>{0, num_nodes - 1}(gen);
+        const size_t i     = std::uniform_int_distribution<size_t>{0, j}(gen);
+        auto& ins          = rewired_specs[j].mInTensors;
+        const auto& t      = rewired_specs[i].mOutTensors.front();
+        if(i != j && !gr::internal::contains(ins, t))
+        {
+            ins[std::uniform_int_distribution<size_t>{0, ins.size() - 1}(gen)] = t;
+        }
+        const auto rewired = gr::PatternGraphGenerator::Make(permute(gen, rewired_specs));
+        ASSERT_EQ(gr::isIsomorphic(graph->graph(), rewired->graph()),
+                  bruteForceIsomorphic(specs, rewired_specs));
+    }
+}
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "graphapi_opgraph_common.hpp"
+
+#include <miopen/graphapi/engine.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+namespace gr = miopen::graphapi;
+
+class TestMatcher : public gr::GraphPatternMatcher
+{
+    std::string mName;
+    const gr::OpGraph* mPattern;
+
+public:
+    TestMatcher(std::string name, const gr::OpGraph* pattern)
+        : mName(std::move(name)), mPattern(pattern)
+    {
+    }
+
+    bool matches(const gr::OpGraph* graph) const override
+    {
+        return mPattern != nullptr && gr::isIsomorphic(*graph, *mPattern);
+    }
+
+    std::vector<gr::Engine> getEngines(gr::OpGraph*) const override { return {}; }
+
+    std::string_view name() const override { return mName; }
+
+    std::optional<size_t> signature() const override
+    {
+        if(mPattern == nullptr)
+        {
+            return std::nullopt;
+        }
+        return mPattern->getSignature();
+    }
+};
+
+using Stats = gr::GraphPatternRegistry::Stats;
+
+const Stats& findStats(const std::vector<Stats>& stats, const std::string& name)
+{
+    const auto it = std::find_if(
+        stats.cbegin(), stats.cend(), [&](const auto& s) { return s.name == name; });
+    EXPECT_NE(it, stats.cend()) << name;
+    return *it;
+}
+
+} // namespace
+
+TEST(CPU_GraphPatternRegistry_NONE, SignatureDispatch)
+{
+    using namespace graphapi_opgraph_tests;
+
+    auto diamond = makeDiamondGraph();
+    auto chain   = gr::PatternGraphGenerator::Make(
+        {{"top", {"t_in"}, {"t_a"}}, {"left", {"t_a"}, {"t_b"}}, {"bottom", {"t_b"}, {"t_out"}}});
+
+    // the mirror copy has the same signature, the chain with one node less has not
+    auto mirror = gr::PatternGraphGenerator::Make({{"top", {"t_in"}, {"t_a", "t_b"}},
+                                                   {"left", {"t_b"}, {"t_d"}},
+                                                   {"right", {"t_a"}, {"t_c"}},
+                                                   {"bottom", {"t_c", "t_d"}, {"t_out"}}});
+    EXPECT_EQ(diamond->graph().getSignature(), mirror->graph().getSignature());
+    EXPECT_NE(diamond->graph().getSignature(), chain->graph().getSignature());
+
+    gr::GraphPatternRegistry registry;
+    registry.registerMatcher(std::make_unique<TestMatcher>("wildcard", nullptr));
+    registry.registerMatcher(std::make_unique<TestMatcher>("diamond", &diamond->graph()));
+    registry.registerMatcher(std::make_unique<TestMatcher>("chain", &chain->graph()));
+
+    std::ignore = registry.findEngines(&mirror->graph());
+    std::ignore = registry.findEngines(&mirror->graph());
+    std::ignore = registry.findEngines(&chain->graph());
+
+    const auto stats = registry.getStats();
+    ASSERT_EQ(stats.size(), 3);
+
+    const auto& wildcard = findStats(stats, "wildcard");
+    EXPECT_EQ(wildcard.tries, 3);
+    EXPECT_EQ(wildcard.hits, 0);
+
+    const auto& diamond_stats = findStats(stats, "diamond");
+    EXPECT_EQ(diamond_stats.tries, 2);
+    EXPECT_EQ(diamond_stats.hits, 2);
+
+    const auto& chain_stats = findStats(stats, "chain");
+    EXPECT_EQ(chain_stats.tries, 1);
+    EXPECT_EQ(chain_stats.hits, 1);
+}
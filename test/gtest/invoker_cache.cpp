@@ -0,0 +1,129 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <miopen/invoker_cache.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Identifies a registration by the value its token points to.
+struct TokenInvoker
+{
+    std::shared_ptr<int> token;
+
+    void operator()(const miopen::Handle&, const miopen::AnyInvokeParams&) const {}
+};
+
+int GetToken(const std::optional<miopen::Invoker>& invoker)
+{
+    if(!invoker)
+        return -1;
+    const auto* const target = invoker->target<TokenInvoker>();
+    return target != nullptr ? *target->token : -1;
+}
+
+} // namespace
+
+TEST(CPU_InvokerCache_NONE, Reregister)
+{
+    miopen::InvokerCache cache;
+    const auto key = miopen::InvokerCache::Key{"config", "solver"};
+    EXPECT_FALSE(cache[key].has_value());
+
+    auto first             = std::make_shared<int>(1);
+    const auto first_alive = std::weak_ptr<int>{first};
+    cache.Register(key, TokenInvoker{std::move(first)});
+    EXPECT_EQ(GetToken(cache[key]), 1);
+
+    // The replaced invoker is released, not shadowed.
+    cache.Register(key, TokenInvoker{std::make_shared<int>(2)});
+    EXPECT_EQ(GetToken(cache[key]), 2);
+    EXPECT_TRUE(first_alive.expired());
+
+    cache.SetAsFound1_0("config", "algo", "solver");
+    cache.Register({"config", "other"}, TokenInvoker{std::make_shared<int>(3)});
+    cache.SetAsFound1_0("config", "algo", "other");
+    EXPECT_EQ(cache.GetFound1_0SolverId("config", "algo"), "other");
+    EXPECT_EQ(GetToken(cache.GetFound1_0("config", "algo")), 3);
+}
+
+TEST(CPU_InvokerCache_NONE, ConcurrentLookups)
+{
+    constexpr int keys   = 500;
+    constexpr int rounds = 4;
+    miopen::InvokerCache cache;
+    std::atomic<bool> done{false};
+    std::atomic<int> errors{0};
+
+    const auto read = [&]() {
+        auto seen = std::vector<int>(keys, -1);
+        while(!done)
+        {
+            for(int i = 0; i < keys; ++i)
+            {
+                // A lookup sees the latest registration or an older one, never a torn value.
+                const auto token = GetToken(cache.Get("config", std::to_string(i)));
+                if(token != -1 && (token % keys != i || token < seen[i]))
+                    ++errors;
+                seen[i] = std::max(seen[i], token);
+            }
+        }
+    };
+    auto readers = std::vector<std::thread>{};
+    for(int i = 0; i < 4; ++i)
+        readers.emplace_back(read);
+
+    // The table grows while it is read and every key is registered again.
+    auto alive = std::vector<std::weak_ptr<int>>{};
+    for(int round = 0; round < rounds; ++round)
+    {
+        for(int i = 0; i < keys; ++i)
+        {
+            auto token = std::make_shared<int>(round * keys + i);
+            alive.emplace_back(token);
+            cache.Register({"config", std::to_string(i)}, TokenInvoker{std::move(token)});
+        }
+    }
+    done = true;
+    for(auto& reader : readers)
+        reader.join();
+    // The invokers replaced while a lookup was copying them are released by a later registration.
+    cache.Register({"other", "solver"}, TokenInvoker{std::make_shared<int>(-1)});
+
+    EXPECT_EQ(errors, 0);
+    for(int i = 0; i < keys; ++i)
+        EXPECT_EQ(GetToken(cache.Get("config", std::to_string(i))), (rounds - 1) * keys + i);
+    // Only the latest registration of each key is kept.
+    for(std::size_t i = 0; i < alive.size(); ++i)
+        EXPECT_EQ(alive[i].expired(), i < std::size_t{(rounds - 1) * keys});
+}
@@ -0,0 +1,89 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <miopen/kernel_cache.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(CPU_KernelCache_NONE, ConcurrentLookups)
+{
+    constexpr int keys_num    = 64;
+    constexpr int kernels_num = 4;
+    constexpr int readers_num = 4;
+    miopen::KernelCache cache;
+    std::atomic<bool> done{false};
+    std::atomic<int> failures{0};
+
+    // Readers only ever see complete snapshots that grow as the writer adds kernels.
+    std::vector<std::thread> readers;
+    for(auto r = 0; r < readers_num; ++r)
+    {
+        readers.emplace_back([&, r]() {
+            auto seen = std::vector<std::size_t>(keys_num);
+            while(!done.load())
+            {
+                for(auto k = r; k < keys_num + r; ++k)
+                {
+                    const auto key = k % keys_num;
+                    const auto ks  = cache.GetKernels("algo", std::to_string(key));
+                    if(ks == nullptr || ks->size() < seen[key] || ks->size() > kernels_num)
+                        ++failures;
+                    else
+                        seen[key] = ks->size();
+                    cache.HasProgram("program.cl", std::to_string(key));
+                }
+            }
+        });
+    }
+
+    for(auto i = 0; i < kernels_num; ++i)
+    {
+        for(auto key = 0; key < keys_num; ++key)
+        {
+            cache.AddKernel({"algo", std::to_string(key)}, miopen::Kernel{}, i);
+            cache.AddProgram(miopen::Program{}, "program.cl", std::to_string(key));
+        }
+    }
+    done = true;
+    for(auto& reader : readers)
+        reader.join();
+
+    EXPECT_EQ(failures.load(), 0);
+    for(auto key = 0; key < keys_num; ++key)
+    {
+        EXPECT_EQ(cache.GetKernels("algo", std::to_string(key))->size(), kernels_num);
+        EXPECT_TRUE(cache.HasProgram("program.cl", std::to_string(key)));
+    }
+
+    cache.ClearKernels("algo", "0");
+    cache.ClearProgram("program.cl", "0");
+    EXPECT_TRUE(cache.GetKernels("algo", "0")->empty());
+    EXPECT_FALSE(cache.HasProgram("program.cl", "0"));
+}
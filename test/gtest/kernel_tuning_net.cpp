@@ -3,6 +3,8 @@
 #include "get_handle.hpp"
 #include <miopen/solver.hpp>
 #include <miopen/conv/heuristics/ai_heuristics.hpp>
+#include <miopen/db_path.hpp>
+#include <miopen/filesystem.hpp>
 
 struct KernelTuningNetTestCase : AIModelTestCase
 {
@@ -214,3 +216,78 @@ INSTANTIATE_TEST_SUITE_P(ConvHipIgemmGroupBwdXdlopsParameterPredictionModelTest,
 INSTANTIATE_TEST_SUITE_P(ConvHipIgemmGroupWrwXdlopsParameterPredictionModelTest,
                          KernelTuningNetTestConvHipIgemmGroupWrwXdlops,
                          testing::ValuesIn(GetConvHipIgemmGroupWrwXdlopsTestCases()));
+
+#if MIOPEN_ENABLE_AI_KERNEL_TUNING
+namespace {
+
+// The features of ConvAsm1x1U: a diagonal 8x8 matrix of the problem sizes.
+std::vector<float> MakeConvAsm1x1UFeatures(std::size_t k)
+{
+    constexpr std::size_t n = 8;
+    std::vector<float> features(n * n, 0.0f);
+    features[0]         = k % 2 == 0 ? 2.0f : 1.0f;
+    features[n + 1]     = 1.0f;
+    features[3 * n + 3] = float(64 << (k % 4));
+    features[4 * n + 4] = float(32 << (k % 5));
+    features[5 * n + 5] = float(7 + 7 * (k % 3));
+    features[6 * n + 6] = float(7 + 7 * (k % 3));
+    features[7 * n + 7] = float(1 << (k % 6));
+    return features;
+}
+
+// Records the accepted values. At a position that depends on the problem, it rejects one value,
+// or all of them for a third of the problems, so that the problems of a batch finish their
+// decoding at different steps.
+std::function<bool(std::size_t, std::string)> MakeValidator(std::size_t k,
+                                                            std::vector<std::string>& accepted)
+{
+    return [k, &accepted](std::size_t i, std::string value) {
+        if(i == k % 8 && (k % 3 == 0 || value == "4"))
+            return false;
+        accepted.push_back(std::to_string(i) + ":" + value);
+        return true;
+    };
+}
+
+} // namespace
+#endif
+
+TEST(CPU_KernelTuningNetBatch_NONE, ModelSetParamsMatchesSingleProblems)
+{
+#if MIOPEN_ENABLE_AI_KERNEL_TUNING
+    const std::string arch   = "gfx908";
+    const std::string solver = "ConvAsm1x1U";
+
+    const auto encoder = miopen::GetSystemDbPath() / (arch + "_" + solver + "_encoder.ktn.model");
+    if(!miopen::fs::exists(encoder))
+        GTEST_SKIP();
+
+    constexpr std::size_t batch_size = 11;
+    std::vector<std::vector<float>> features;
+    std::vector<std::vector<std::string>> expected(batch_size);
+    std::vector<bool> expected_set;
+    for(std::size_t k = 0; k < batch_size; ++k)
+    {
+        features.push_back(MakeConvAsm1x1UFeatures(k));
+        expected_set.push_back(miopen::ai::tuning::ModelSetParams(arch,
+                                                                  solver,
+                                                                  miopen::conv::Direction::Forward,
+                                                                  features.back(),
+                                                                  true,
+                                                                  MakeValidator(k, expected[k])));
+    }
+
+    std::vector<std::vector<std::string>> accepted(batch_size);
+    std::vector<std::function<bool(std::size_t, std::string)>> validators;
+    for(std::size_t k = 0; k < batch_size; ++k)
+        validators.push_back(MakeValidator(k, accepted[k]));
+    const auto set = miopen::ai::tuning::ModelSetParams(
+        arch, solver, miopen::conv::Direction::Forward, features, true, validators);
+
+    EXPECT_EQ(set, expected_set);
+    for(std::size_t k = 0; k < batch_size; ++k)
+        EXPECT_EQ(accepted[k], expected[k]) << "problem " << k;
+#else
+    GTEST_SKIP();
+#endif
+}
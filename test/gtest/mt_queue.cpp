@@ -27,6 +27,7 @@
 #include <miopen/mt_queue.hpp>
 #include <thread>
 #include <chrono>
+#include <memory>
 
 #include "random.hpp"
 
@@ -79,3 +80,111 @@ TEST(UtilMultiThreadQueue, Basic)
         std::cout << tmp << std::endl;
     EXPECT_EQ(num_prod, num_cons);
 }
+
+TEST(UtilMultiThreadQueue, BoundedClose)
+{
+    const int capacity = 4;
+    ThreadSafeQueue<int> comp_queue(capacity);
+    std::atomic<int> pushed{};
+
+    std::thread prod([&]() {
+        for(auto idx = 0; idx < data_len; ++idx)
+        {
+            if(!comp_queue.push(int{idx}))
+                break;
+            pushed.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    // The producer must not run further ahead than the capacity allows.
+    for(auto idx = 0; idx < 10; ++idx)
+    {
+        EXPECT_EQ(comp_queue.pop(), idx);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        EXPECT_LE(pushed.load(), idx + 1 + capacity);
+    }
+
+    // Closing the queue cancels the blocked producer.
+    comp_queue.close();
+    prod.join();
+    EXPECT_LT(pushed.load(), data_len);
+
+    int remaining = 0;
+    while(comp_queue.try_pop())
+        ++remaining;
+    EXPECT_EQ(10 + remaining, pushed.load());
+    EXPECT_FALSE(comp_queue.push(0));
+}
+
+TEST(UtilMultiThreadQueue, TryAndTimeout)
+{
+    ThreadSafeQueue<int> comp_queue(2);
+    EXPECT_EQ(comp_queue.get_capacity(), std::size_t{2});
+    EXPECT_FALSE(comp_queue.try_pop());
+    EXPECT_FALSE(comp_queue.pop_for(std::chrono::milliseconds(10)));
+
+    EXPECT_TRUE(comp_queue.try_push(1));
+    EXPECT_TRUE(comp_queue.push_for(2, std::chrono::milliseconds(10)));
+    EXPECT_FALSE(comp_queue.try_push(3));
+    EXPECT_FALSE(comp_queue.push_for(3, std::chrono::milliseconds(10)));
+    EXPECT_EQ(comp_queue.size(), std::size_t{2});
+
+    EXPECT_EQ(comp_queue.pop_for(std::chrono::milliseconds(10)), 1);
+    EXPECT_TRUE(comp_queue.try_push(3));
+    EXPECT_EQ(comp_queue.pop(), 2);
+    EXPECT_EQ(comp_queue.try_pop(), 3);
+
+    // A closed queue still gives out its items, then stops waiting.
+    std::thread cons([&]() { EXPECT_FALSE(comp_queue.pop_for(std::chrono::hours(1))); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    comp_queue.close();
+    cons.join();
+    EXPECT_FALSE(comp_queue.try_push(4));
+}
+
+TEST(UtilMultiThreadQueue, StressMoveOnly)
+{
+    constexpr int producers_num = 4;
+    constexpr int consumers_num = 4;
+    constexpr int items_num     = 20000;
+    ThreadSafeQueue<std::unique_ptr<int>> comp_queue(8);
+    std::atomic<long long> sum{};
+    std::atomic<int> popped{};
+
+    std::vector<std::thread> threads;
+    for(auto idx = 0; idx < producers_num; ++idx)
+    {
+        threads.emplace_back([&, idx]() {
+            for(auto item = idx; item < items_num; item += producers_num)
+            {
+                auto ptr = std::make_unique<int>(item);
+                if(item % 2 == 0)
+                {
+                    ASSERT_TRUE(comp_queue.push(std::move(ptr)));
+                    continue;
+                }
+                while(!comp_queue.try_push(std::move(ptr)))
+                    ASSERT_TRUE(ptr); // a failed push leaves the item alone
+            }
+        });
+    }
+    for(auto idx = 0; idx < consumers_num; ++idx)
+    {
+        threads.emplace_back([&]() {
+            while(popped.load() < items_num)
+            {
+                auto ptr = comp_queue.pop_for(std::chrono::milliseconds(1));
+                if(!ptr)
+                    continue;
+                sum += **ptr;
+                ++popped;
+            }
+        });
+    }
+    for(auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(popped.load(), items_num);
+    EXPECT_EQ(sum.load(), static_cast<long long>(items_num) * (items_num - 1) / 2);
+    EXPECT_FALSE(comp_queue.try_pop());
+}
@@ -0,0 +1,137 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/par_for.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST(CPU_ParFor_NONE, EveryIndexOnce)
+{
+    for(std::size_t n : {0, 1, 7, 1000, 100003})
+    {
+        std::vector<std::atomic<int>> visits(n);
+        miopen::par_for(n, miopen::min_grain{1}, [&](auto i) { ++visits[i]; });
+        for(std::size_t i = 0; i < n; ++i)
+            ASSERT_EQ(visits[i].load(), 1) << "n=" << n << " i=" << i;
+
+        std::vector<std::atomic<int>> strided(n);
+        miopen::par_for_strided(n, miopen::max_threads{5}, [&](auto i) { ++strided[i]; });
+        for(std::size_t i = 0; i < n; ++i)
+            ASSERT_EQ(strided[i].load(), 1) << "n=" << n << " i=" << i;
+    }
+}
+
+TEST(CPU_ParFor_NONE, Nested)
+{
+    constexpr std::size_t outer = 64;
+    constexpr std::size_t inner = 1000;
+    std::vector<std::atomic<int>> visits(outer * inner);
+    miopen::par_for(outer, miopen::min_grain{1}, [&](auto i) {
+        miopen::par_for(inner, miopen::min_grain{1}, [&](auto j) { ++visits[i * inner + j]; });
+    });
+    for(const auto& v : visits)
+        ASSERT_EQ(v.load(), 1);
+}
+
+TEST(CPU_ParFor_NONE, Exception)
+{
+    std::atomic<std::size_t> calls{0};
+    EXPECT_THROW(miopen::par_for(10000,
+                                 miopen::min_grain{1},
+                                 [&](auto i) {
+                                     ++calls;
+                                     if(i == 5000)
+                                         throw std::runtime_error("par_for");
+                                 }),
+                 std::runtime_error);
+    EXPECT_LE(calls.load(), 10000);
+
+    // the pool is still usable
+    std::atomic<std::size_t> sum{0};
+    miopen::par_for(100, miopen::min_grain{1}, [&](auto i) { sum += i; });
+    EXPECT_EQ(sum.load(), 4950);
+}
+
+TEST(CPU_ParFor_NONE, ConcurrentCallers)
+{
+    // Threads outside the pool submit at the same time, so the workers race with the submitters.
+    constexpr std::size_t callers = 8;
+    constexpr std::size_t n       = 10000;
+    std::vector<std::atomic<int>> visits(callers * n);
+    std::vector<std::thread> threads;
+    for(std::size_t c = 0; c < callers; ++c)
+    {
+        threads.emplace_back([&, c] {
+            for(int repeat = 0; repeat < 10; ++repeat)
+                miopen::par_for(n, miopen::min_grain{1}, [&](auto i) { ++visits[c * n + i]; });
+        });
+    }
+    for(auto& t : threads)
+        t.join();
+    for(const auto& v : visits)
+        ASSERT_EQ(v.load(), 10);
+
+    // the tasks of the finished calls which are still queued do nothing
+    while(miopen::thread_pool::get().run_pending())
+    {
+    }
+    for(const auto& v : visits)
+        ASSERT_EQ(v.load(), 10);
+}
+
+TEST(CPU_ParFor_NONE, WaiterRunsOnlyItsTasks)
+{
+    auto& pool = miopen::thread_pool::get();
+    if(pool.size() == 0)
+        GTEST_SKIP() << "the pool has no workers";
+
+    // Tasks of someone else, which wait for the par_for call below. One more than the workers,
+    // so one of them stays queued while the call waits for its own tasks.
+    std::atomic<bool> finished{false};
+    std::atomic<std::size_t> foreign{pool.size() + 1};
+    for(std::size_t k = 0; k < pool.size() + 1; ++k)
+    {
+        pool.submit([&] {
+            while(!finished)
+                std::this_thread::yield();
+            --foreign;
+        });
+    }
+
+    std::vector<std::atomic<int>> visits(1000);
+    miopen::par_for(visits.size(), miopen::min_grain{1}, [&](auto i) { ++visits[i]; });
+    finished = true;
+    for(const auto& v : visits)
+        ASSERT_EQ(v.load(), 1);
+
+    while(foreign != 0)
+        std::this_thread::yield();
+}
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/pooling/problem_description.hpp>
+#include <miopen/problem_key.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+miopen::conv::ProblemDescription MakeConvProblem(int pad, miopenDataType_t type = miopenFloat)
+{
+    const auto in      = miopen::TensorDescriptor{type, {16, 64, 56, 56}};
+    const auto weights = miopen::TensorDescriptor{type, {64, 64, 3, 3}};
+    const auto out     = miopen::TensorDescriptor{type, {16, 64, 56, 56}};
+    const auto conv    = miopen::ConvolutionDescriptor{{pad, pad}, {1, 1}, {1, 1}};
+    return {in, weights, out, conv, miopen::conv::Direction::Forward};
+}
+
+std::string Serialize(const miopen::conv::ProblemDescription& problem)
+{
+    std::ostringstream ss;
+    problem.Serialize(ss);
+    return ss.str();
+}
+
+} // namespace
+
+TEST(CPU_ProblemKey_NONE, Convolution)
+{
+    const auto problem = MakeConvProblem(1);
+    EXPECT_TRUE(problem.MakeKey().IsValid());
+    EXPECT_EQ(problem.MakeKey(), MakeConvProblem(1).MakeKey());
+    EXPECT_EQ(problem.MakeKey().Hash(), MakeConvProblem(1).MakeKey().Hash());
+    EXPECT_NE(problem.MakeKey(), MakeConvProblem(0).MakeKey());
+    EXPECT_NE(problem.MakeKey(), MakeConvProblem(1, miopenHalf).MakeKey());
+
+    // The text forms must not depend on whether they are cached.
+    for(const auto& p : {MakeConvProblem(1), MakeConvProblem(0), MakeConvProblem(1, miopenHalf)})
+    {
+        miopen::ProblemKeyTextCache::SetEnabled(false);
+        const auto config = p.MakeNetworkConfig().ToString();
+        const auto db_key = Serialize(p);
+        miopen::ProblemKeyTextCache::SetEnabled(true);
+        EXPECT_EQ(p.MakeNetworkConfig().ToString(), config);
+        EXPECT_EQ(p.MakeNetworkConfig().ToString(), config);
+        EXPECT_EQ(Serialize(p), db_key);
+    }
+}
+
+TEST(CPU_ProblemKey_NONE, TextCacheEviction)
+{
+    // More problems than the cache holds, so their texts replace each other.
+    auto configs = std::vector<std::string>{};
+    miopen::ProblemKeyTextCache::SetEnabled(false);
+    for(int pad = 0; pad < 1500; ++pad)
+        configs.push_back(MakeConvProblem(pad).MakeNetworkConfig().ToString());
+    miopen::ProblemKeyTextCache::SetEnabled(true);
+    for(int round = 0; round < 2; ++round)
+    {
+        for(int pad = 0; pad < 1500; ++pad)
+            EXPECT_EQ(MakeConvProblem(pad).MakeNetworkConfig().ToString(), configs[pad]);
+    }
+}
+
+TEST(CPU_ProblemKey_NONE, PoolingFitsCapacity)
+{
+    const auto pooling = miopen::PoolingDescriptor{
+        miopenPoolingMax, miopenPaddingDefault, {3, 3, 3}, {2, 2, 2}, {1, 1, 1}};
+    const auto x       = miopen::TensorDescriptor{miopenFloat, {8, 16, 32, 32, 32}};
+    const auto y       = miopen::TensorDescriptor{miopenFloat, {8, 16, 16, 16, 16}};
+    // The backward problems have the longest keys.
+    const auto problem = miopen::pooling::ProblemDescription{pooling, x, y, x, y};
+    EXPECT_TRUE(problem.MakeKey().IsValid());
+}
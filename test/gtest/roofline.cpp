@@ -0,0 +1,84 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <miopen/conv/heuristics/roofline.hpp>
+#include <miopen/conv/problem_description.hpp>
+
+namespace {
+
+miopen::conv::ProblemDescription MakeProblem(std::size_t k, miopenDataType_t type = miopenHalf)
+{
+    const auto in      = miopen::TensorDescriptor{type, std::vector<std::size_t>{32, 256, 56, 56}};
+    const auto weights = miopen::TensorDescriptor{type, std::vector<std::size_t>{k, 256, 1, 1}};
+    const auto out     = miopen::TensorDescriptor{type, std::vector<std::size_t>{32, k, 56, 56}};
+    const auto conv    = miopen::ConvolutionDescriptor{{0, 0}, {1, 1}, {1, 1}};
+    return miopen::conv::ProblemDescription{
+        in, weights, out, conv, miopen::conv::Direction::Forward};
+}
+
+} // namespace
+
+TEST(CPU_Roofline_NONE, Device)
+{
+    const auto full = miopen::conv::RooflineDevice::Get("gfx90a", 110);
+    const auto half = miopen::conv::RooflineDevice::Get("gfx90a:sramecc+:xnack-", 55);
+    EXPECT_GT(full.matrix_flops, 0.0);
+    EXPECT_DOUBLE_EQ(full.vector_flops, 2.0 * half.vector_flops);
+    EXPECT_DOUBLE_EQ(full.bandwidth, 2.0 * half.bandwidth);
+    EXPECT_GT(full.GetPeakFlops(miopenHalf, true), full.GetPeakFlops(miopenFloat, true));
+    EXPECT_GT(full.GetPeakFlops(miopenHalf, true), full.GetPeakFlops(miopenHalf, false));
+
+    // Targets without matrix cores and unknown ones use the vector units.
+    const auto navi = miopen::conv::RooflineDevice::Get("gfx1030", 80);
+    EXPECT_DOUBLE_EQ(navi.GetPeakFlops(miopenHalf, true), navi.GetPeakFlops(miopenHalf, false));
+    EXPECT_GT(miopen::conv::RooflineDevice::Get("gfx9999", 64).vector_flops, 0.0);
+}
+
+TEST(CPU_Roofline_NONE, EstimateTime)
+{
+    const auto device  = miopen::conv::RooflineDevice::Get("gfx90a", 110);
+    const auto problem = MakeProblem(256);
+
+    auto params = miopen::conv::RooflineParams{};
+    EXPECT_LT(miopen::conv::EstimateTime(device, problem, params, 0), 0.0f);
+
+    params.efficiency = 0.1f;
+    params.tile_m     = 64;
+    params.tile_n     = 64;
+    const auto vector = miopen::conv::EstimateTime(device, problem, params, 0);
+    EXPECT_GT(vector, 0.0f);
+
+    // A workspace adds memory traffic, the matrix cores add compute throughput.
+    EXPECT_GT(miopen::conv::EstimateTime(device, problem, params, std::size_t{1} << 32), vector);
+    params.matrix_cores = true;
+    EXPECT_LT(miopen::conv::EstimateTime(device, problem, params, 0), vector);
+    params.matrix_cores = false;
+
+    // One more output channel takes another row of tiles.
+    const auto padded = miopen::conv::EstimateTime(device, MakeProblem(257), params, 0);
+    EXPECT_GT(padded, 1.1f * vector);
+}
@@ -0,0 +1,91 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <miopen/perf_field.hpp>
+#include <miopen/timing_policy.hpp>
+
+#include <cstddef>
+#include <sstream>
+
+TEST(CPU_TimingPolicy_NONE, OutlierRejection)
+{
+    const auto result = miopen::GetTimingResult({1.0f, 1.1f, 0.9f, 1.0f, 10.0f}, 3.0f);
+    EXPECT_FLOAT_EQ(result.time, 1.0f);
+    EXPECT_EQ(result.outliers, std::size_t{1});
+    EXPECT_LT(result.variance, 0.01f);
+
+    const auto all = miopen::GetTimingResult({1.0f, 1.1f, 0.9f, 1.0f, 10.0f}, 0.0f);
+    EXPECT_EQ(all.outliers, std::size_t{0});
+    EXPECT_GT(all.variance, 1.0f);
+}
+
+TEST(CPU_TimingPolicy_NONE, Measure)
+{
+    miopen::TimingPolicy policy;
+    policy.warmup_runs = 2;
+
+    // Stable timings stop as soon as min_runs are done, warm-up runs are not counted.
+    std::size_t calls = 0;
+    auto result       = miopen::MeasureTime(policy, [&]() {
+        ++calls;
+        return calls <= policy.warmup_runs ? 100.0f : 2.0f;
+    });
+    EXPECT_FLOAT_EQ(result.time, 2.0f);
+    EXPECT_EQ(result.runs, policy.min_runs);
+    EXPECT_EQ(calls, policy.warmup_runs + policy.min_runs);
+
+    // Noisy timings of a candidate which is clearly slower than the best one.
+    calls  = 0;
+    result = miopen::MeasureTime(
+        policy, [&]() { return (++calls % 2 == 0) ? 4.0f : 5.0f; }, 1.0f);
+    EXPECT_TRUE(result.eliminated);
+    EXPECT_LT(result.runs, policy.max_runs);
+
+    // Noisy timings never get below the confidence interval and stop at max_runs.
+    calls  = 0;
+    result = miopen::MeasureTime(policy, [&]() { return (++calls % 2 == 0) ? 1.0f : 3.0f; });
+    EXPECT_FALSE(result.eliminated);
+    EXPECT_EQ(result.runs, policy.max_runs);
+}
+
+TEST(CPU_TimingPolicy_NONE, FindDbData)
+{
+    miopen::FindDbData data{1.5f, 64, "miopenConvolutionFwdAlgoDirect", "median", 0.25f};
+    std::ostringstream ss;
+    data.Serialize(ss);
+
+    miopen::FindDbData loaded;
+    ASSERT_TRUE(loaded.Deserialize(ss.str()));
+    EXPECT_EQ(loaded.statistic, "median");
+    EXPECT_FLOAT_EQ(loaded.variance, 0.25f);
+
+    // Records of older versions have no statistic and variance.
+    ASSERT_TRUE(loaded.Deserialize("1.5,64,miopenConvolutionFwdAlgoDirect"));
+    EXPECT_FLOAT_EQ(loaded.time, 1.5f);
+    EXPECT_EQ(loaded.workspace, std::size_t{64});
+    EXPECT_TRUE(loaded.statistic.empty());
+}
@@ -0,0 +1,144 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <miopen/env.hpp>
+#include <miopen/tmp_dir.hpp>
+#include <miopen/trace.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_TRACE_FILE)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_TRACE_MAX_EVENTS, 1000000)
+
+namespace {
+
+void TracedWork()
+{
+    MIOPEN_TRACE_SCOPE_DETAIL("test", "TraceTestOuter", std::string{"detail"});
+    {
+        MIOPEN_TRACE_SCOPE("test", "TraceTestInner");
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+}
+
+} // namespace
+
+TEST(CPU_Trace_NONE, Disabled)
+{
+    miopen::env::clear(MIOPEN_TRACE_FILE);
+    const miopen::trace::Span span{"test", "TraceTestDisabled"};
+    EXPECT_FALSE(span.IsActive());
+}
+
+TEST(CPU_Trace_NONE, ChromeTraceEvents)
+{
+    const miopen::TmpDir dir{"trace"};
+    const auto path = dir.path / "trace.json";
+    miopen::env::update(MIOPEN_TRACE_FILE, path.string());
+
+    TracedWork();
+    std::thread{TracedWork}.join();
+    miopen::trace::Write();
+    miopen::env::clear(MIOPEN_TRACE_FILE);
+
+    std::ifstream file(path);
+    const auto trace = nlohmann::json::parse(file);
+
+    auto outer = std::vector<nlohmann::json>{};
+    auto inner = std::vector<nlohmann::json>{};
+    for(const auto& event : trace.at("traceEvents"))
+    {
+        EXPECT_EQ(event.at("ph"), "X");
+        if(event.at("name") == "TraceTestOuter")
+            outer.push_back(event);
+        if(event.at("name") == "TraceTestInner")
+            inner.push_back(event);
+    }
+
+    ASSERT_EQ(outer.size(), std::size_t{2});
+    ASSERT_EQ(inner.size(), std::size_t{2});
+    EXPECT_NE(outer[0].at("tid"), outer[1].at("tid"));
+
+    for(auto i = 0; i < 2; ++i)
+    {
+        EXPECT_EQ(outer[i].at("cat"), "test");
+        EXPECT_EQ(outer[i].at("args").at("detail"), "detail");
+        EXPECT_FALSE(inner[i].contains("args"));
+        EXPECT_EQ(inner[i].at("tid"), outer[i].at("tid"));
+
+        // The inner span is nested in the outer one.
+        const auto outer_start = outer[i].at("ts").get<double>();
+        const auto inner_start = inner[i].at("ts").get<double>();
+        EXPECT_GE(inner[i].at("dur").get<double>(), 1000.0);
+        EXPECT_LE(outer_start, inner_start);
+        EXPECT_LE(inner_start + inner[i].at("dur").get<double>(),
+                  outer_start + outer[i].at("dur").get<double>());
+    }
+}
+
+TEST(CPU_Trace_NONE, MaxEvents)
+{
+    const miopen::TmpDir dir{"trace"};
+    const auto path = dir.path / "trace.json";
+    miopen::env::update(MIOPEN_TRACE_FILE, path.string());
+    miopen::env::update(MIOPEN_TRACE_MAX_EVENTS, 1);
+
+    // The spans of the other tests may already fill the trace, so at most one of these is kept.
+    for(auto i = 0; i < 10; ++i)
+    {
+        const miopen::trace::Span span{"test", "TraceTestMaxEvents"};
+    }
+
+    // The trace is written as soon as the first span is dropped.
+    {
+        std::ifstream file(path);
+        ASSERT_TRUE(file.good());
+        const auto trace = nlohmann::json::parse(file);
+        EXPECT_EQ(trace.at("otherData").at("dropped_events"), 1);
+    }
+
+    miopen::trace::Write();
+    miopen::env::clear(MIOPEN_TRACE_MAX_EVENTS);
+    miopen::env::clear(MIOPEN_TRACE_FILE);
+
+    std::ifstream file(path);
+    const auto trace = nlohmann::json::parse(file);
+    std::size_t kept = 0;
+    for(const auto& event : trace.at("traceEvents"))
+    {
+        if(event.at("name") == "TraceTestMaxEvents")
+            ++kept;
+    }
+    EXPECT_LE(kept, std::size_t{1});
+    EXPECT_GE(trace.at("otherData").at("dropped_events").get<std::size_t>(), std::size_t{9});
+}
@@ -1,4 +1,5 @@
 #include <gtest/ai_heuristics.hpp>
+#include <miopen/anyramdb.hpp>
 #include <miopen/conv/heuristics/ai_heuristics.hpp>
 #include "../tensor_holder.hpp"
 #include "get_handle.hpp"
@@ -181,3 +182,77 @@ INSTANTIATE_TEST_SUITE_P(Gfx90aTestSolverPredictionModelHalfTest,
 INSTANTIATE_TEST_SUITE_P(Gfx90aTestSolverPredictionModelBF16Test,
                          TunaNetTestBF16,
                          testing::ValuesIn(GetGfx90aBF16TestCases()));
+
+#if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
+namespace {
+
+miopen::conv::ProblemDescription MakeProblem(AIModelTestCase test_case)
+{
+    const auto input     = miopen::TensorDescriptor(
+        test_case.data_type, test_case.layout, test_case.conv.GetInput());
+    const auto weights   = miopen::TensorDescriptor(
+        test_case.data_type, test_case.layout, test_case.conv.GetWeights());
+    const auto conv_desc = test_case.conv.GetConv();
+    const auto output    = conv_desc.GetForwardOutputTensor(input, weights, test_case.data_type);
+    if(test_case.direction == miopen::conv::Direction::Forward)
+        return {input, weights, output, conv_desc, test_case.direction};
+    return {output, weights, input, conv_desc, test_case.direction};
+}
+
+} // namespace
+#endif
+
+TEST(GPU_TunaNetBatch_NONE, PredictSolversMatchesPredictSolver)
+{
+#if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
+    auto&& handle      = get_handle();
+    std::string device = handle.GetDeviceName();
+    miopen::ExecutionContext ctx;
+    ctx.SetStream(&handle);
+
+    // More than one tile of the batched layers, with the problems of every data type mixed.
+    std::vector<miopen::conv::ProblemDescription> problems;
+    for(const auto& test_cases : {GetGfx908FloatTestCases(),
+                                  GetGfx908HalfTestCases(),
+                                  GetGfx908BF16TestCases(),
+                                  GetGfx90aFloatTestCases(),
+                                  GetGfx90aHalfTestCases(),
+                                  GetGfx90aBF16TestCases()})
+    {
+        for(auto test_case : test_cases)
+        {
+            if(test_case.device_architecture != device)
+                continue;
+            for(std::size_t n : {1, 3, 16})
+            {
+                test_case.conv.N = n;
+                problems.push_back(MakeProblem(test_case));
+            }
+        }
+    }
+    if(problems.empty())
+        GTEST_SKIP();
+
+    // The rankings are cached per device, drop them so that every query below runs the model.
+    auto& db = miopen::AnyRamDb::GetCached(":memory:" + device);
+    for(const auto& problem : problems)
+        db.RemoveRecord(problem);
+    std::vector<std::vector<uint64_t>> expected;
+    for(const auto& problem : problems)
+        expected.push_back(miopen::ai::immed_mode::PredictSolver(problem, ctx, device));
+
+    // The first problem stays cached, the others go through one batched forward pass.
+    for(std::size_t i = 1; i < problems.size(); ++i)
+        db.RemoveRecord(problems[i]);
+    const auto solvers = miopen::ai::immed_mode::PredictSolvers(problems, ctx, device);
+    ASSERT_EQ(solvers.size(), problems.size());
+    for(std::size_t i = 0; i < problems.size(); ++i)
+        EXPECT_EQ(solvers[i], expected[i]) << "problem " << i;
+
+    // The batched results are cached too.
+    for(std::size_t i = 0; i < problems.size(); ++i)
+        EXPECT_EQ(miopen::ai::immed_mode::PredictSolver(problems[i], ctx, device), expected[i]);
+#else
+    GTEST_SKIP();
+#endif
+}
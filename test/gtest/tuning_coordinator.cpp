@@ -0,0 +1,159 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <gtest/gtest.h>
+#include <miopen/tmp_dir.hpp>
+#include <miopen/tuning_coordinator.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const std::string job = "ConvAsm3x3U:1x2x3";
+
+// Reports the slice index as the time, so slice 0 is the best one.
+miopen::solver::TuningSliceResult Search(const miopen::solver::TuningSlice& slice)
+{
+    miopen::solver::TuningSliceResult result;
+    result.config = "cfg" + std::to_string(slice.index);
+    result.time   = 1.0f + static_cast<float>(slice.index);
+    return result;
+}
+
+void CheckCoordinator(miopen::solver::TuningCoordinator& coordinator)
+{
+    std::mutex mutex;
+    std::vector<std::size_t> claimed;
+    std::vector<std::optional<miopen::solver::TuningSliceResult>> bests(4);
+    std::vector<std::thread> workers;
+    for(auto& best : bests)
+    {
+        workers.emplace_back([&]() {
+            best = coordinator.Run(job, std::chrono::seconds{10}, [&](const auto& slice) {
+                EXPECT_EQ(slice.count, coordinator.GetSliceCount());
+                std::lock_guard<std::mutex> lock(mutex);
+                claimed.push_back(slice.index);
+                return Search(slice);
+            });
+        });
+    }
+    for(auto& worker : workers)
+        worker.join();
+
+    // Every slice is claimed exactly once and every worker gets the same result.
+    std::sort(claimed.begin(), claimed.end());
+    ASSERT_EQ(claimed.size(), coordinator.GetSliceCount());
+    for(std::size_t i = 0; i < claimed.size(); ++i)
+        EXPECT_EQ(claimed[i], i);
+    for(const auto& best : bests)
+    {
+        ASSERT_TRUE(best);
+        EXPECT_EQ(best->slice, std::size_t{0});
+        EXPECT_EQ(best->config, "cfg0");
+    }
+
+    // Other jobs are independent.
+    EXPECT_TRUE(coordinator.Acquire(job + "x"));
+    EXPECT_FALSE(coordinator.Acquire(job));
+}
+
+// The coordinator has 2 slices and a lease time of 200 ms.
+void CheckLeases(miopen::solver::TuningCoordinator& coordinator)
+{
+    // A worker which dies after claiming a slice.
+    const auto dead = coordinator.Acquire(job);
+    ASSERT_TRUE(dead);
+
+    // A worker which searches longer than the lease time keeps its slice.
+    auto renewed = false;
+    auto best    = coordinator.Run(job, std::chrono::seconds{0}, [&](const auto& slice) {
+        std::this_thread::sleep_for(3 * coordinator.GetLeaseTime());
+        // This may claim the slice of the dead worker, which is left unreported as well.
+        const auto other = coordinator.Acquire(job);
+        renewed          = !other || other->index != slice.index;
+        return Search(slice);
+    });
+    EXPECT_TRUE(renewed);
+    EXPECT_FALSE(best); // The slice of the dead worker is not reported in time.
+
+    // Once the lease expires, the slice is searched again.
+    std::vector<std::size_t> searched;
+    best = coordinator.Run(job, std::chrono::seconds{10}, [&](const auto& slice) {
+        searched.push_back(slice.index);
+        return Search(slice);
+    });
+    ASSERT_EQ(searched.size(), std::size_t{1});
+    EXPECT_EQ(searched[0], dead->index);
+    ASSERT_TRUE(best);
+    EXPECT_EQ(best->slice, std::size_t{0});
+
+    // The late result of the dead worker is rejected.
+    auto late  = Search(*dead);
+    late.slice = dead->index;
+    late.lease = dead->lease;
+    EXPECT_FALSE(coordinator.Report(job, late));
+    EXPECT_FALSE(coordinator.Renew(job, *dead));
+    EXPECT_EQ(coordinator.Collect(job).size(), std::size_t{2});
+}
+
+} // namespace
+
+TEST(CPU_TuningCoordinator_NONE, Local)
+{
+    miopen::solver::LocalTuningCoordinator coordinator{7};
+    CheckCoordinator(coordinator);
+}
+
+TEST(CPU_TuningCoordinator_NONE, File)
+{
+    const miopen::TmpDir dir{"tuning_coordinator"};
+    miopen::solver::FileTuningCoordinator coordinator{dir.path, 7};
+    CheckCoordinator(coordinator);
+
+    // Another worker sharing the directory sees the same state.
+    miopen::solver::FileTuningCoordinator other{dir.path, 7};
+    EXPECT_FALSE(other.Acquire(job));
+    EXPECT_EQ(other.Collect(job).size(), std::size_t{7});
+
+    miopen::solver::FileTuningCoordinator mismatch{dir.path, 3};
+    EXPECT_ANY_THROW(mismatch.Acquire(job));
+}
+
+TEST(CPU_TuningCoordinator_NONE, LocalLeases)
+{
+    miopen::solver::LocalTuningCoordinator coordinator{2, std::chrono::milliseconds{200}};
+    CheckLeases(coordinator);
+}
+
+TEST(CPU_TuningCoordinator_NONE, FileLeases)
+{
+    const miopen::TmpDir dir{"tuning_coordinator"};
+    miopen::solver::FileTuningCoordinator coordinator{
+        dir.path, 2, std::chrono::milliseconds{200}};
+    CheckLeases(coordinator);
+}
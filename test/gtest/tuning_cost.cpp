@@ -0,0 +1,95 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/tmp_dir.hpp>
+#include <miopen/tuning_cost.hpp>
+
+#include <sstream>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_TUNING_DRY_RUN)
+
+TEST(CPU_TuningStats_NONE, SaveAndLoad)
+{
+    const miopen::TmpDir dir{"tuning_stats"};
+    const auto path = dir.path / "tuning_stats.txt";
+
+    bool known = true;
+    {
+        miopen::solver::TuningStats stats{path};
+        stats.GetCompileTime("a.s", known);
+        EXPECT_FALSE(known);
+
+        stats.AddCompileTime("a.s", 100.0f);
+        stats.AddCompileTime("a.s", 300.0f);
+        stats.AddCompileTime("b.cpp", 500.0f);
+        stats.AddMeasureTime("ConvAsm3x3U", 2.0f);
+        stats.Save();
+    }
+
+    // Another process appends to the same file.
+    {
+        miopen::solver::TuningStats stats{path};
+        stats.AddMeasureTime("ConvAsm3x3U", 4.0f);
+        stats.Save();
+    }
+
+    const miopen::solver::TuningStats stats{path};
+    EXPECT_FLOAT_EQ(stats.GetCompileTime("a.s", known), 200.0f);
+    EXPECT_TRUE(known);
+    EXPECT_FLOAT_EQ(stats.GetMeasureTime("ConvAsm3x3U", known), 3.0f);
+    EXPECT_TRUE(known);
+    // Unknown kernels are expected to take the mean time of all the known ones.
+    EXPECT_FLOAT_EQ(stats.GetCompileTime("c.cl", known), 300.0f);
+    EXPECT_FALSE(known);
+}
+
+TEST(CPU_TuningCost_NONE, SkipSearchInDryRun)
+{
+    miopen::env::clear(MIOPEN_TUNING_DRY_RUN);
+    EXPECT_NO_THROW(miopen::solver::SkipSearchInDryRun("ConvOclDirectFwd"));
+
+    miopen::env::update(MIOPEN_TUNING_DRY_RUN, true);
+    try
+    {
+        miopen::solver::SkipSearchInDryRun("ConvOclDirectFwd");
+        ADD_FAILURE() << "The search has not been skipped";
+    }
+    catch(const miopen::Exception& ex)
+    {
+        EXPECT_EQ(ex.status, miopenStatusGpuOperationsSkipped);
+    }
+    miopen::env::clear(MIOPEN_TUNING_DRY_RUN);
+
+    auto estimate      = miopen::solver::TuningCostEstimate{};
+    estimate.solver    = "ConvOclDirectFwd";
+    estimate.estimated = false;
+    std::ostringstream ss;
+    ss << estimate;
+    EXPECT_NE(ss.str().find("not estimated"), std::string::npos);
+}
@@ -0,0 +1,63 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <miopen/convolution.hpp>
+#include <miopen/tensor.hpp>
+#include <miopen/tuning_warm_start.hpp>
+
+#include <cmath>
+
+TEST(CPU_TuningWarmStart_NONE, NeighborProblems)
+{
+    const auto in   = miopen::TensorDescriptor{miopenFloat, {16, 64, 28, 28}};
+    const auto wei  = miopen::TensorDescriptor{miopenFloat, {128, 64, 3, 3}};
+    const auto out  = miopen::TensorDescriptor{miopenFloat, {16, 128, 26, 26}};
+    const auto conv = miopen::ConvolutionDescriptor{};
+    const auto problem =
+        miopen::conv::ProblemDescription{in, wei, out, conv, miopen::conv::Direction::Forward};
+
+    const auto neighbors = miopen::solver::GetNeighborProblems(problem);
+    ASSERT_FALSE(neighbors.empty());
+
+    auto prev_distance = 0.0;
+    for(const auto& neighbor : neighbors)
+    {
+        // Only the batch size differs, and the nearest batch sizes go first.
+        EXPECT_NE(neighbor.GetBatchSize(), problem.GetBatchSize());
+        EXPECT_EQ(neighbor.GetInChannels(), problem.GetInChannels());
+        EXPECT_EQ(neighbor.GetOutChannels(), problem.GetOutChannels());
+        EXPECT_EQ(neighbor.GetWeights(), problem.GetWeights());
+        EXPECT_EQ(neighbor.GetIn().GetLengths()[0], neighbor.GetOut().GetLengths()[0]);
+
+        const auto distance = std::abs(std::log2(static_cast<double>(neighbor.GetBatchSize()) /
+                                                 static_cast<double>(problem.GetBatchSize())));
+        EXPECT_GE(distance, prev_distance);
+        prev_distance = distance;
+    }
+    EXPECT_TRUE(neighbors.front().GetBatchSize() * 2 == problem.GetBatchSize() ||
+                neighbors.front().GetBatchSize() == problem.GetBatchSize() * 2);
+}
@@ -174,6 +174,7 @@ struct RuleSetTest
         IsInTest();
         NextTest();
         CompareTest();
+        FillNthTest();
     }
 
 private:
@@ -246,6 +247,41 @@ private:
         EXPECT(!TestRuleSet().Compare(data1, data3));
         EXPECT(!TestRuleSet().Compare(data1, data4));
     }
+
+    void FillNthTest() const
+    {
+        EXPECT_EQUAL(TestRuleSet().Size(), 4);
+
+        TestData next{-1, -1, 5};
+        TestRuleSet().FillBegin(next);
+        for(std::size_t i = 0; i < TestRuleSet().Size(); ++i)
+        {
+            TestData nth{-1, -1, 5};
+            TestRuleSet().FillNth(nth, i);
+            EXPECT(TestRuleSet().Compare(nth, next));
+            EXPECT_EQUAL(nth.z, 5);
+            TestRuleSet().Next(next);
+        }
+
+        // clang-format off
+        const auto rules = MakeRuleSet(
+            std::make_tuple(Span<int, 0, 9>{}, &TestData::x),
+            std::make_tuple(TwoPowersSpan<int, 1, 8>{}, &TestData::y),
+            std::make_tuple(Join<Sequence<int, 1, 2>, Span<int, 5, 6>>{}, &TestData::z)
+        );
+        // clang-format on
+        EXPECT_EQUAL(rules.Size(), 10 * 4 * 4);
+
+        TestData data{};
+        rules.FillNth(data, 10 * 4 * 4 - 1);
+        EXPECT_EQUAL(data.x, 9);
+        EXPECT_EQUAL(data.y, 8);
+        EXPECT_EQUAL(data.z, 6);
+        rules.FillNth(data, 3 + 10 * 2 + 10 * 4 * 2);
+        EXPECT_EQUAL(data.x, 3);
+        EXPECT_EQUAL(data.y, 4);
+        EXPECT_EQUAL(data.z, 5);
+    }
 };
 
 } // namespace tests
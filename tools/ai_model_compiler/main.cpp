@@ -0,0 +1,69 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Compiles a TunaNet or KernelTuningNet model from its frugally-deep JSON into the binary the
+// library loads instead, after checking the compiled model against the Keras reference outputs
+// stored in the JSON.
+//
+// Usage: ai_model_compiler <model> <output.bin> [tolerance]
+
+#include <miopen/conv/heuristics/compiled_model.hpp>
+#include <miopen/errors.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+int main(int argc, const char* argv[])
+{
+    if(argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <model> <output.bin> [tolerance]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const auto tolerance = argc > 3 ? std::stof(argv[3]) : 1e-4f;
+
+    try
+    {
+        const auto model = miopen::ai::CompiledModel::FromJsonFile(argv[1]);
+        const auto error = model.MaxTestError();
+        if(!(error <= tolerance))
+        {
+            std::cerr << argv[1] << ": the outputs differ from the reference by " << error
+                      << ", more than " << tolerance << std::endl;
+            return EXIT_FAILURE;
+        }
+        model.SaveBinary(argv[2]);
+        if(model.GetTests().empty())
+            std::cout << argv[1] << ": no reference outputs to check" << std::endl;
+    }
+    catch(const miopen::Exception& ex)
+    {
+        std::cerr << argv[1] << ": " << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
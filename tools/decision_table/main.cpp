@@ -0,0 +1,313 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// Generates the immediate mode decision table of a target from the contents of its find-db and
+// reports how often the table agrees with the measured results and, with --check, with the full
+// fallback path (TunaNet, roofline or WTI) on the current GPU. --check also compares the roofline
+// cost model with WTI: how they order the measured solvers which are applicable on the current
+// GPU.
+//
+// Usage: decision_table <find-db.txt> <output.dtable.txt> [--check]
+//
+// Install the output as <db basename>.dtable.txt into the system or user db directory, or point
+// MIOPEN_CONV_DECISION_TABLE_PATH to it.
+
+#include <miopen/any_solver.hpp>
+#include <miopen/conv/heuristics/decision_table.hpp>
+#include <miopen/conv/heuristics/roofline.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/stringutils.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Record
+{
+    std::string db_key;
+    std::vector<std::pair<miopen::solver::Id, float>> times;
+};
+
+// <db key>=<solver>:<time>,<workspace>,<algorithm>[,...];...
+// Old files have the algorithm as the id and the solver as the first value.
+std::optional<Record> ParseRecord(const std::string& line)
+{
+    const auto separator = line.find('=');
+    if(separator == std::string::npos)
+        return std::nullopt;
+
+    auto record   = Record{};
+    record.db_key = line.substr(0, separator);
+    for(const auto& entry : miopen::SplitDelim(line.substr(separator + 1), ';'))
+    {
+        const auto colon = entry.find(':');
+        if(colon == std::string::npos)
+            continue;
+        auto values = miopen::SplitDelim(entry.substr(colon + 1), ',');
+        auto name   = entry.substr(0, colon);
+        if(miopen::StartsWith(name, "miopenConvolution") && !values.empty())
+        {
+            name = values.front();
+            values.erase(values.begin());
+        }
+        const auto id = miopen::solver::Id{name};
+        // The immediate mode fallback uses only dynamic solvers.
+        if(values.empty() || !id.IsValid() || !id.GetSolver().IsDynamic())
+            continue;
+        record.times.emplace_back(id, std::strtof(values.front().c_str(), nullptr));
+    }
+    return record;
+}
+
+std::optional<miopenDataType_t> ParseDataType(const std::string& name)
+{
+    if(name == "FP32")
+        return miopenFloat;
+    if(name == "FP16")
+        return miopenHalf;
+    if(name == "BF16")
+        return miopenBFloat16;
+    if(name == "INT8")
+        return miopenInt8;
+    return std::nullopt;
+}
+
+// Only the problems with the default layout and a single data type are rebuilt.
+std::optional<miopen::conv::ProblemDescription> MakeProblem(const miopen::conv::DbKeyFields& f)
+{
+    const auto type = ParseDataType(f.data_types);
+    if(!type || !f.cast_types.empty() || f.layouts.size() != 1 ||
+       (f.layouts[0] != "NCHW" && f.layouts[0] != "NCDHW"))
+        return std::nullopt;
+
+    auto direction = miopen::conv::Direction::Forward;
+    if(f.direction == "B")
+        direction = miopen::conv::Direction::BackwardData;
+    else if(f.direction == "W")
+        direction = miopen::conv::Direction::BackwardWeights;
+
+    // The in tensor is y for the backward directions.
+    const auto is_forward = direction == miopen::conv::Direction::Forward;
+    const auto x_channels = is_forward ? f.in_channels : f.out_channels;
+    const auto y_channels = is_forward ? f.out_channels : f.in_channels;
+
+    auto in_lens      = std::vector<std::size_t>{f.batch_size, f.in_channels};
+    auto weights_lens = std::vector<std::size_t>{y_channels, x_channels / f.group_count};
+    auto out_lens     = std::vector<std::size_t>{f.batch_size, f.out_channels};
+    in_lens.insert(in_lens.end(), f.in_spatial.begin(), f.in_spatial.end());
+    weights_lens.insert(weights_lens.end(), f.filter.begin(), f.filter.end());
+    out_lens.insert(out_lens.end(), f.out_spatial.begin(), f.out_spatial.end());
+
+    const auto to_int = [](const std::vector<std::size_t>& values) {
+        return std::vector<int>{values.begin(), values.end()};
+    };
+    const auto conv = miopen::ConvolutionDescriptor{f.spatial_dims,
+                                                    miopenConvolution,
+                                                    miopenPaddingDefault,
+                                                    to_int(f.pads),
+                                                    to_int(f.strides),
+                                                    to_int(f.dilations),
+                                                    std::vector<int>(f.spatial_dims, 0),
+                                                    static_cast<int>(f.group_count)};
+
+    return miopen::conv::ProblemDescription{miopen::TensorDescriptor{*type, in_lens},
+                                            miopen::TensorDescriptor{*type, weights_lens},
+                                            miopen::TensorDescriptor{*type, out_lens},
+                                            conv,
+                                            direction,
+                                            f.bias};
+}
+
+double Percent(std::size_t part, std::size_t total)
+{
+    return total == 0 ? 0.0 : 100.0 * static_cast<double>(part) / static_cast<double>(total);
+}
+
+// How well the estimates of a fallback order the measured times of the solvers.
+struct OrderStats
+{
+    std::size_t problems = 0;
+    std::size_t agree    = 0;
+    std::size_t pairs    = 0;
+    std::size_t ordered  = 0;
+    double log_slowdown  = 0.0;
+
+    // The pairs are <measured time, estimated time>.
+    void Add(const std::vector<std::pair<float, float>>& times)
+    {
+        if(times.empty())
+            return;
+        ++problems;
+        const auto fastest = std::min_element(times.begin(), times.end());
+        const auto picked  = std::min_element(
+            times.begin(), times.end(), [](auto& l, auto& r) { return l.second < r.second; });
+        if(picked->first == fastest->first)
+            ++agree;
+        log_slowdown += std::log(picked->first / fastest->first);
+        for(std::size_t i = 0; i < times.size(); ++i)
+        {
+            for(std::size_t j = i + 1; j < times.size(); ++j)
+            {
+                ++pairs;
+                if((times[i].first < times[j].first) == (times[i].second < times[j].second))
+                    ++ordered;
+            }
+        }
+    }
+
+    void Print(const std::string& name) const
+    {
+        const auto count = static_cast<double>(std::max<std::size_t>(problems, 1));
+        std::cout << name << " picks the fastest measured solver: " << agree << " of " << problems
+                  << " (" << Percent(agree, problems) << "%), orders " << Percent(ordered, pairs)
+                  << "% of the solver pairs correctly, mean slowdown "
+                  << std::exp(log_slowdown / count) << "x" << std::endl;
+    }
+};
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    if(argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <find-db.txt> <output.dtable.txt> [--check]"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+    const auto check = argc > 3 && std::string{argv[3]} == "--check";
+    if(check)
+    {
+        // The fallback path to compare with must not use the table itself.
+        miopen::env::setEnvironmentVariable("MIOPEN_DEBUG_DISABLE_CONV_DECISION_TABLE", "1");
+    }
+
+    std::ifstream in(argv[1]);
+    if(!in)
+    {
+        std::cerr << "Unable to open " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto records = std::vector<Record>{};
+    auto builder = miopen::conv::DecisionTableBuilder{};
+    std::string line;
+    while(std::getline(in, line))
+    {
+        auto record = ParseRecord(line);
+        if(record && !record->times.empty() && builder.Add(record->db_key, record->times))
+            records.push_back(std::move(*record));
+    }
+
+    const auto table = builder.Build();
+    table.Save(argv[2]);
+    std::cout << "Records: " << records.size() << ", table entries: " << table.Size()
+              << std::endl;
+
+    // How often the first solver of the entry is the fastest measured one.
+    std::size_t measured_agree = 0;
+    for(const auto& record : records)
+    {
+        const auto best    = std::min_element(record.times.begin(),
+                                           record.times.end(),
+                                           [](auto& l, auto& r) { return l.second < r.second; });
+        const auto solvers = table.Find(*miopen::conv::DecisionTable::MakeKey(record.db_key));
+        if(solvers != nullptr && !solvers->empty() && solvers->front() == best->first)
+            ++measured_agree;
+    }
+    std::cout << "Agrees with the fastest measured solver: " << measured_agree << " of "
+              << records.size() << " (" << Percent(measured_agree, records.size()) << "%)"
+              << std::endl;
+
+    if(!check)
+        return EXIT_SUCCESS;
+
+    // How often the first applicable solver of the entry is the first one of the full fallback.
+    auto handle                = miopen::Handle{};
+    auto ctx                   = miopen::ExecutionContext{&handle};
+    const auto device          = miopen::conv::RooflineDevice::Get(ctx);
+    std::size_t checked        = 0;
+    std::size_t fallback_agree = 0;
+    auto roofline              = OrderStats{};
+    auto wti                   = OrderStats{};
+    for(const auto& record : records)
+    {
+        const auto fields  = miopen::conv::DbKeyFields::Parse(record.db_key);
+        const auto problem = fields ? MakeProblem(*fields) : std::nullopt;
+        if(!problem)
+            continue;
+        const auto solvers = table.Find(miopen::conv::DecisionTable::MakeKey(*fields));
+        auto table_best    = std::optional<miopen::solver::Id>{};
+        for(const auto id : solvers != nullptr ? *solvers : std::vector<miopen::solver::Id>{})
+        {
+            if(id.GetSolver().IsApplicable(ctx, *problem))
+            {
+                table_best = id;
+                break;
+            }
+        }
+        const auto fallback = problem->GetConv().GetSolutionsFallback(ctx, *problem, 1);
+        ++checked;
+        if(table_best && !fallback.empty() && table_best->Value() == fallback[0].solution_id)
+            ++fallback_agree;
+
+        // The measured and the estimated times of the applicable solvers. WTI is a throughput,
+        // so its inverse orders the solvers like a time.
+        auto roofline_times = std::vector<std::pair<float, float>>{};
+        auto wti_times      = std::vector<std::pair<float, float>>{};
+        for(const auto& [id, time] : record.times)
+        {
+            const auto solver = id.GetSolver();
+            if(time <= 0.0f || !solver.IsApplicable(ctx, *problem))
+                continue;
+            const auto ws       = solver.GetWorkspaceSize(ctx, *problem);
+            const auto estimate = miopen::conv::EstimateSolverTime(device, ctx, *problem, id, ws);
+            if(estimate > 0.0f)
+                roofline_times.emplace_back(time, estimate);
+            const auto solver_wti = solver.GetWti(ctx, *problem);
+            if(solver_wti > 0.0f)
+                wti_times.emplace_back(time, 1.0f / solver_wti);
+        }
+        roofline.Add(roofline_times);
+        wti.Add(wti_times);
+    }
+    std::cout << "Agrees with the full fallback path: " << fallback_agree << " of " << checked
+              << " (" << Percent(fallback_agree, checked) << "%)" << std::endl;
+    roofline.Print("Roofline");
+    wti.Print("WTI");
+    return EXIT_SUCCESS;
+}